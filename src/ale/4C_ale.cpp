@@ -290,9 +290,8 @@ int ALE::Ale::solve()
   int errorcode = 0;
   if (msht_ == Inpar::ALE::no_meshtying)
   {
-    Core::LinAlg::SolverParams solver_params;
-    solver_params.refactor = true;
-    errorcode = solver_->solve(sysmat_->epetra_operator(), disi_, rhs, solver_params);
+    errorcode = ALE::Utils::solve_with_reused_setup(
+        *solver_, sysmat_->epetra_operator(), disi_, rhs, refactor_linear_solver());
   }
   else
     errorcode = meshtying_->solve_meshtying(*solver_, sysmat_, disi_, rhs, dispnp_);
@@ -857,9 +856,17 @@ bool ALE::Ale::evaluate_element_quality()
 ALE::AleLinear::AleLinear(std::shared_ptr<Core::FE::Discretization> actdis,
     std::shared_ptr<Core::LinAlg::Solver> solver, std::shared_ptr<Teuchos::ParameterList> params_in,
     std::shared_ptr<Core::IO::DiscretizationWriter> output)
-    : Ale(actdis, solver, params_in, output), validsysmat_(false), updateeverystep_(false)
+    : Ale(actdis, solver, params_in, output),
+      validsysmat_(false),
+      updateeverystep_(false),
+      reusesolversetup_(false),
+      validsolversetup_(false),
+      dbc_type_(ALE::Utils::MapExtractor::dbc_set_std)
 {
   updateeverystep_ = params().get<bool>("UPDATEMATRIX");
+
+  // local systems rotate the system matrix in every evaluation
+  reusesolversetup_ = params().get<bool>("REUSE_SOLVER_SETUP") and locsys_manager() == nullptr;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -890,6 +897,7 @@ void ALE::AleLinear::evaluate_elements()
     Ale::evaluate_elements();
 
     validsysmat_ = true;
+    validsolversetup_ = false;
   }
   else if (system_matrix())
     system_matrix()->Apply(*dispnp(), *write_access_residual());
@@ -901,4 +909,23 @@ void ALE::AleLinear::evaluate_elements()
   return;
 }
 
+/*----------------------------------------------------------------------------*/
+void ALE::AleLinear::evaluate(std::shared_ptr<const Core::LinAlg::Vector<double>> stepinc,
+    ALE::Utils::MapExtractor::AleDBCSetType dbc_type)
+{
+  if (dbc_type != dbc_type_) validsolversetup_ = false;
+  dbc_type_ = dbc_type;
+
+  Ale::evaluate(stepinc, dbc_type);
+}
+
+/*----------------------------------------------------------------------------*/
+bool ALE::AleLinear::refactor_linear_solver()
+{
+  const bool refactor = not validsolversetup_;
+  validsolversetup_ = reusesolversetup_;
+
+  return refactor;
+}
+
 FOUR_C_NAMESPACE_CLOSE
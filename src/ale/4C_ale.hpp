@@ -367,6 +367,12 @@ namespace ALE
    private:
     virtual bool update_sys_mat_every_step() const { return true; }
 
+    /*! \brief Does the linear solver need to set up its factorization/preconditioner again?
+     *
+     *  Called once right before each linear solve of the system without meshtying.
+     */
+    virtual bool refactor_linear_solver() { return true; }
+
     //! @name Misc
 
     //! ALE discretization
@@ -588,18 +594,45 @@ namespace ALE
      */
     void evaluate_elements() override;
 
+    /*! \brief Evaluate and apply the Dirichlet set \p dbc_type
+     *
+     *  A change of the Dirichlet set changes the rows of the system matrix. Hence, the setup of
+     *  the linear solver cannot be reused anymore.
+     */
+    void evaluate(std::shared_ptr<const Core::LinAlg::Vector<double>> stepinc = nullptr,
+        ALE::Utils::MapExtractor::AleDBCSetType dbc_type =
+            ALE::Utils::MapExtractor::dbc_set_std) override;
+
     //@}
 
    protected:
    private:
     bool update_sys_mat_every_step() const override { return updateeverystep_; }
 
+    /*! \brief Reuse the setup of the linear solver as long as #sysmat_ is unchanged
+     *
+     *  The mesh motion is a linear function of the prescribed (interface) displacements. With an
+     *  unchanged system matrix, the factorization of a direct solver or the preconditioner of an
+     *  iterative solver is reused, such that each coupling iteration only costs a forward/backward
+     *  substitution or a few preconditioned iterations, respectively.
+     */
+    bool refactor_linear_solver() override;
+
     //! Is the #sysmat_ valid (true) or does it need to be re-evaluated (false)
     bool validsysmat_;
 
     //! \brief Update stiffness matrix oncer per time step ?
     bool updateeverystep_;
 
+    //! Reuse the setup of the linear solver for an unchanged #sysmat_ ?
+    bool reusesolversetup_;
+
+    //! Is the setup of the linear solver still valid for #sysmat_ ?
+    bool validsolversetup_;
+
+    //! Dirichlet set applied in the last evaluation
+    ALE::Utils::MapExtractor::AleDBCSetType dbc_type_;
+
   };  // class AleLinear
 
 }  // namespace ALE
@@ -0,0 +1,34 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_ale_utils.hpp"
+
+#include "4C_linear_solver_method_linalg.hpp"
+
+FOUR_C_NAMESPACE_OPEN
+
+/*----------------------------------------------------------------------------*/
+int ALE::Utils::solve_with_reused_setup(Core::LinAlg::Solver& solver,
+    std::shared_ptr<Epetra_Operator> matrix, std::shared_ptr<Core::LinAlg::Vector<double>> x,
+    std::shared_ptr<Core::LinAlg::Vector<double>> b, const bool refactor)
+{
+  Core::LinAlg::SolverParams solver_params;
+  solver_params.refactor = refactor;
+  int errorcode = solver.solve(matrix, x, b, solver_params);
+
+  // fall back to a new setup of the linear solver if the reused one failed
+  if (errorcode != 0 and not refactor)
+  {
+    x->PutScalar(0.0);
+    solver_params.refactor = true;
+    errorcode = solver.solve(matrix, x, b, solver_params);
+  }
+
+  return errorcode;
+}
+
+FOUR_C_NAMESPACE_CLOSE
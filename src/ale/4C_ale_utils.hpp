@@ -21,6 +21,11 @@ namespace Core::FE
   class Discretization;
 }  // namespace Core::FE
 
+namespace Core::LinAlg
+{
+  class Solver;
+}  // namespace Core::LinAlg
+
 namespace ALE
 {
   namespace Utils
@@ -69,6 +74,18 @@ namespace ALE
      private:
       std::shared_ptr<std::set<int>> condelements_;
     };
+
+    /*! \brief Solve the linear system, possibly reusing the setup of the linear solver
+     *
+     *  With \p refactor being false, the factorization of a direct solver or the preconditioner of
+     *  an iterative solver from the previous solve is reused. If this solve fails, the system is
+     *  solved again with a new setup.
+     *
+     *  \return error code of the last solve
+     */
+    int solve_with_reused_setup(Core::LinAlg::Solver& solver,
+        std::shared_ptr<Epetra_Operator> matrix, std::shared_ptr<Core::LinAlg::Vector<double>> x,
+        std::shared_ptr<Core::LinAlg::Vector<double>> b, bool refactor);
   }  // namespace Utils
 }  // namespace ALE
 
@@ -0,0 +1,93 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_ale_utils.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_io_pstream.hpp"
+#include "4C_linalg_sparsematrix.hpp"
+#include "4C_linear_solver_method_linalg.hpp"
+
+#include <Teuchos_ParameterList.hpp>
+
+namespace
+{
+  using namespace FourC;
+
+  //! Laplacian-like mesh motion system of a chain of 10 nodes, the first node is fixed
+  class AleSolveWithReusedSetupTest : public ::testing::Test
+  {
+   protected:
+    static constexpr int numdofs = 10;
+
+    AleSolveWithReusedSetupTest()
+        : dofrowmap_(numdofs, 0, Core::Communication::as_epetra_comm(MPI_COMM_WORLD)),
+          sysmat_(std::make_shared<Core::LinAlg::SparseMatrix>(dofrowmap_, 3, false, true))
+    {
+      for (int lid = 0; lid < dofrowmap_.NumMyElements(); ++lid)
+      {
+        const int row = dofrowmap_.GID(lid);
+        sysmat_->assemble(row == numdofs - 1 ? 1.0 : 2.0, row, row);
+        if (row > 0) sysmat_->assemble(-1.0, row, row - 1);
+        if (row < numdofs - 1) sysmat_->assemble(-1.0, row, row + 1);
+      }
+      sysmat_->complete();
+
+      Teuchos::ParameterList solverparams;
+      solverparams.set("solver", "umfpack");
+      solver_ = std::make_shared<Core::LinAlg::Solver>(
+          solverparams, MPI_COMM_WORLD, nullptr, Core::IO::minimal, false);
+    }
+
+    //! solve for the right hand side b_i = scale * (i + 1) and return the norm of the residual
+    double solve_and_compute_residual(const double scale, const bool refactor)
+    {
+      auto rhs = std::make_shared<Core::LinAlg::Vector<double>>(dofrowmap_, true);
+      for (int lid = 0; lid < dofrowmap_.NumMyElements(); ++lid)
+        (*rhs)[lid] = scale * (dofrowmap_.GID(lid) + 1);
+      const Core::LinAlg::Vector<double> b(*rhs);
+
+      auto disi = std::make_shared<Core::LinAlg::Vector<double>>(dofrowmap_, true);
+      EXPECT_EQ(ALE::Utils::solve_with_reused_setup(
+                    *solver_, sysmat_->epetra_operator(), disi, rhs, refactor),
+          0);
+
+      Core::LinAlg::Vector<double> residual(dofrowmap_, true);
+      sysmat_->multiply(false, *disi, residual);
+      residual.Update(-1.0, b, 1.0);
+
+      double norm = 0.0;
+      residual.Norm2(&norm);
+      return norm;
+    }
+
+    Epetra_Map dofrowmap_;
+    std::shared_ptr<Core::LinAlg::SparseMatrix> sysmat_;
+    std::shared_ptr<Core::LinAlg::Solver> solver_;
+  };
+
+  TEST_F(AleSolveWithReusedSetupTest, ReusedFactorizationSolvesNewRightHandSides)
+  {
+    EXPECT_LT(solve_and_compute_residual(1.0, true), 1.0e-10);
+
+    // the coupling iterations only change the prescribed displacements, i.e. the right hand side
+    EXPECT_LT(solve_and_compute_residual(-0.5, false), 1.0e-10);
+    EXPECT_LT(solve_and_compute_residual(3.0, false), 1.0e-10);
+  }
+
+  TEST_F(AleSolveWithReusedSetupTest, NewSetupForReevaluatedMatrix)
+  {
+    EXPECT_LT(solve_and_compute_residual(1.0, true), 1.0e-10);
+
+    // a re-evaluated system matrix needs a new setup of the linear solver
+    sysmat_->scale(4.0);
+    EXPECT_LT(solve_and_compute_residual(1.0, true), 1.0e-10);
+    EXPECT_LT(solve_and_compute_residual(2.0, false), 1.0e-10);
+  }
+}  // namespace
@@ -10,6 +10,7 @@
 #include "4C_art_net_art_junction.hpp"
 #include "4C_art_net_artery_ele_action.hpp"
 #include "4C_art_net_artery_resulttest.hpp"
+#include "4C_art_net_utils.hpp"
 #include "4C_fem_condition_utils.hpp"
 #include "4C_fem_general_element.hpp"
 #include "4C_global_data.hpp"
@@ -40,7 +41,8 @@ Arteries::ArtNetExplicitTimeInt::ArtNetExplicitTimeInt(
     std::shared_ptr<Core::FE::Discretization> actdis, const int linsolvernumber,
     const Teuchos::ParameterList& probparams, const Teuchos::ParameterList& artparams,
     Core::IO::DiscretizationWriter& output)
-    : TimInt(actdis, linsolvernumber, probparams, artparams, output)
+    : TimInt(actdis, linsolvernumber, probparams, artparams, output),
+      lumped_mass_(artparams.get<bool>("LUMPED_MASS"))
 {
   //  exit(1);
 
@@ -112,6 +114,8 @@ void Arteries::ArtNetExplicitTimeInt::init(const Teuchos::ParameterList& globalt
   // initialize standard (stabilized) system matrix
   sysmat_ = std::make_shared<Core::LinAlg::SparseMatrix>(*dofrowmap, 6, false, true);
 
+  if (lumped_mass_) residual_ = Core::LinAlg::create_vector(*dofrowmap, true);
+
   // Vectors passed to the element
   // -----------------------------
   // Volumetric flow rate at time n+1, n and n-1
@@ -284,8 +288,12 @@ void Arteries::ArtNetExplicitTimeInt::solve(
       TEUCHOS_FUNC_TIME_MONITOR("      + element calls");
     }
 
+    // the system matrix is the constant mass matrix, hence it is only assembled once if the
+    // lumped mass matrix is used for the update
+    const bool assemble_sysmat = !lumped_mass_ or invlumpedmass_ == nullptr;
+
     // set both system matrix and rhs vector to zero
-    sysmat_->zero();
+    if (assemble_sysmat) sysmat_->zero();
     rhs_->PutScalar(0.0);
 
 
@@ -305,11 +313,16 @@ void Arteries::ArtNetExplicitTimeInt::solve(
 
 
     // call standard loop over all elements
-    discret_->evaluate(eleparams, sysmat_, rhs_);
+    discret_->evaluate(eleparams, assemble_sysmat ? sysmat_ : nullptr, rhs_);
     discret_->clear_state();
 
-    // finalize the complete matrix
-    sysmat_->complete();
+    if (assemble_sysmat)
+    {
+      // finalize the complete matrix
+      sysmat_->complete();
+
+      if (lumped_mass_) setup_lumped_mass();
+    }
   }
   // end time measurement for element
 
@@ -336,8 +349,8 @@ void Arteries::ArtNetExplicitTimeInt::solve(
         std::shared_ptr<std::map<const int, std::shared_ptr<Arteries::Utils::JunctionNodeParams>>>>(
         "Junctions Parameters", junc_nodal_vals_);
 
-    // call standard loop over all elements
-    discret_->evaluate(eleparams, sysmat_, rhs_);
+    // call standard loop over all elements (only nodal values are computed, nothing is assembled)
+    discret_->evaluate(eleparams, nullptr, nullptr, nullptr, nullptr, nullptr);
   }
 
   // Solve the boundary conditions
@@ -372,41 +385,55 @@ void Arteries::ArtNetExplicitTimeInt::solve(
     // solve junction boundary conditions
     artjun_->solve(eleparams);
 
-    // call standard loop over all elements
-    discret_->evaluate(eleparams, sysmat_, rhs_);
+    // call standard loop over all elements (only nodal values are computed, nothing is assembled)
+    discret_->evaluate(eleparams, nullptr, nullptr, nullptr, nullptr, nullptr);
   }
 
 
-  // -------------------------------------------------------------------
-  // Apply the BCs to the system matrix and rhs
-  // -------------------------------------------------------------------
+  if (lumped_mass_)
   {
-    // time measurement: application of dbc
-    if (!coupledTo3D_)
-    {
-      TEUCHOS_FUNC_TIME_MONITOR("      + apply DBC");
-    }
-    Core::LinAlg::apply_dirichlet_to_system(*sysmat_, *qanp_, *rhs_, *bcval_, *dbctog_);
-  }
+    // get cpu time
+    const double tcpusolve = Teuchos::Time::wallTime();
 
-  //-------solve for total new velocities and pressures
-  // get cpu time
-  const double tcpusolve = Teuchos::Time::wallTime();
+    // matrix-free update with the constant system matrix, which is the consistent mass matrix
+    Arteries::Utils::lumped_mass_update(
+        *system_matrix(), *invlumpedmass_, *rhs_, *bcval_, *dbctog_, *qanp_, *residual_);
+
+    dtsolve_ = Teuchos::Time::wallTime() - tcpusolve;
+  }
+  else
   {
-    // time measurement: solver
-    if (!coupledTo3D_)
+    // -------------------------------------------------------------------
+    // Apply the BCs to the system matrix and rhs
+    // -------------------------------------------------------------------
     {
-      TEUCHOS_FUNC_TIME_MONITOR("      + solver calls");
+      // time measurement: application of dbc
+      if (!coupledTo3D_)
+      {
+        TEUCHOS_FUNC_TIME_MONITOR("      + apply DBC");
+      }
+      Core::LinAlg::apply_dirichlet_to_system(*sysmat_, *qanp_, *rhs_, *bcval_, *dbctog_);
     }
 
-    // call solver
-    Core::LinAlg::SolverParams solver_params;
-    solver_params.refactor = true;
-    solver_params.reset = true;
-    solver_->solve(sysmat_->epetra_operator(), qanp_, rhs_, solver_params);
+    //-------solve for total new velocities and pressures
+    // get cpu time
+    const double tcpusolve = Teuchos::Time::wallTime();
+    {
+      // time measurement: solver
+      if (!coupledTo3D_)
+      {
+        TEUCHOS_FUNC_TIME_MONITOR("      + solver calls");
+      }
+
+      // call solver
+      Core::LinAlg::SolverParams solver_params;
+      solver_params.refactor = true;
+      solver_params.reset = true;
+      solver_->solve(sysmat_->epetra_operator(), qanp_, rhs_, solver_params);
+    }
+    // end time measurement for solver
+    dtsolve_ = Teuchos::Time::wallTime() - tcpusolve;
   }
-  // end time measurement for solver
-  dtsolve_ = Teuchos::Time::wallTime() - tcpusolve;
 
   if (myrank_ == 0) std::cout << "te=" << dtele_ << ", ts=" << dtsolve_ << "\n\n";
 
@@ -432,6 +459,17 @@ void Arteries::ArtNetExplicitTimeInt::solve(
 }  // ArtNetExplicitTimeInt:Solve
 
 
+/*----------------------------------------------------------------------*
+ | lumped inverse of the constant mass matrix                           |
+ *----------------------------------------------------------------------*/
+void Arteries::ArtNetExplicitTimeInt::setup_lumped_mass()
+{
+  // the system matrix of the explicit Taylor-Galerkin scheme is the constant mass matrix, it is
+  // not assembled again and serves as mass matrix of the update
+  invlumpedmass_ = Arteries::Utils::inverse_lumped_mass(*system_matrix());
+}
+
+
 void Arteries::ArtNetExplicitTimeInt::solve_scatra()
 {
   {
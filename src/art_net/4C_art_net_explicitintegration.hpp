@@ -166,9 +166,21 @@ namespace Arteries
 
 
    protected:
+    /// compute the lumped inverse of the constant mass matrix for the matrix-free update
+    void setup_lumped_mass();
+
     /// (standard) mass matrix
     std::shared_ptr<Core::LinAlg::SparseOperator> massmat_;
 
+    /// flag for the matrix-free update with the lumped mass matrix instead of a linear solve
+    const bool lumped_mass_;
+
+    /// inverse of the lumped mass matrix
+    std::shared_ptr<Core::LinAlg::Vector<double>> invlumpedmass_;
+
+    /// residual of the matrix-free update
+    std::shared_ptr<Core::LinAlg::Vector<double>> residual_;
+
     /// maps for scatra Dirichlet and free DOF sets
     std::shared_ptr<Core::LinAlg::Vector<double>> nodeIds_;
     std::shared_ptr<Core::LinAlg::Vector<double>> scatra_bcval_;
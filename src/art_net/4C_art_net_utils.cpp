@@ -12,6 +12,7 @@
 #include "4C_art_net_impl_stationary.hpp"
 #include "4C_fem_general_utils_createdis.hpp"
 #include "4C_global_data.hpp"
+#include "4C_linalg_utils_sparse_algebra_assemble.hpp"
 #include "4C_mat_par_bundle.hpp"
 #include "4C_scatra_ele.hpp"
 
@@ -170,4 +171,35 @@ std::map<std::string, std::string> Arteries::ArteryScatraCloneStrategy::conditio
       {"ArtScatraCouplConNodeToPoint", "ArtScatraCouplConNodeToPoint"}};
 }
 
+/*----------------------------------------------------------------------*
+ | inverse of the lumped mass matrix                                    |
+ *----------------------------------------------------------------------*/
+std::shared_ptr<Core::LinAlg::Vector<double>> Arteries::Utils::inverse_lumped_mass(
+    const Core::LinAlg::SparseMatrix& massmat)
+{
+  // all entries of the mass matrix are positive, hence the inverse absolute row sums are the
+  // inverse of the lumped mass matrix
+  auto invlumpedmass = std::make_shared<Core::LinAlg::Vector<double>>(massmat.row_map(), true);
+  int err = massmat.epetra_matrix()->InvRowSums(invlumpedmass->get_ref_of_Epetra_Vector());
+  if (err) FOUR_C_THROW("Computation of the lumped mass matrix failed with err = %d", err);
+
+  return invlumpedmass;
+}
+
+
+/*----------------------------------------------------------------------*
+ | matrix-free update with the lumped mass matrix                       |
+ *----------------------------------------------------------------------*/
+void Arteries::Utils::lumped_mass_update(const Core::LinAlg::SparseMatrix& massmat,
+    const Core::LinAlg::Vector<double>& invlumpedmass, Core::LinAlg::Vector<double>& rhs,
+    const Core::LinAlg::Vector<double>& bcval, const Core::LinAlg::Vector<double>& dbctog,
+    Core::LinAlg::Vector<double>& qanp, Core::LinAlg::Vector<double>& residual)
+{
+  Core::LinAlg::apply_dirichlet_to_system(qanp, rhs, bcval, dbctog);
+  massmat.multiply(false, qanp, residual);
+  residual.Update(1.0, rhs, -1.0);
+  qanp.Multiply(1.0, invlumpedmass, residual, 1.0);
+  Core::LinAlg::apply_dirichlet_to_system(qanp, rhs, bcval, dbctog);
+}
+
 FOUR_C_NAMESPACE_CLOSE
@@ -29,6 +29,9 @@ namespace Core::FE
 namespace Core::LinAlg
 {
   class Solver;
+  class SparseMatrix;
+  template <typename T>
+  class Vector;
 }
 
 namespace Core::Elements
@@ -83,6 +86,18 @@ namespace Arteries
     //! set material pointers
     void set_material_pointers_matching_grid(
         const Core::FE::Discretization& sourcedis, const Core::FE::Discretization& targetdis);
+
+    //! inverse of the row sum lumped mass matrix
+    std::shared_ptr<Core::LinAlg::Vector<double>> inverse_lumped_mass(
+        const Core::LinAlg::SparseMatrix& massmat);
+
+    /*! matrix-free update qanp = qanp + M_L^{-1} (rhs - M qanp) of the explicit Taylor-Galerkin
+     *  scheme, the values prescribed by the terminal and junction conditions (dbctog) are inserted
+     *  before and after the update */
+    void lumped_mass_update(const Core::LinAlg::SparseMatrix& massmat,
+        const Core::LinAlg::Vector<double>& invlumpedmass, Core::LinAlg::Vector<double>& rhs,
+        const Core::LinAlg::Vector<double>& bcval, const Core::LinAlg::Vector<double>& dbctog,
+        Core::LinAlg::Vector<double>& qanp, Core::LinAlg::Vector<double>& residual);
   }  // namespace Utils
 }  // namespace Arteries
 
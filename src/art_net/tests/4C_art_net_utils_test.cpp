@@ -0,0 +1,163 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_art_net_utils.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_linalg_sparsematrix.hpp"
+#include "4C_linalg_vector.hpp"
+
+#include <Epetra_Map.h>
+
+#include <cmath>
+#include <functional>
+
+namespace
+{
+  using namespace FourC;
+
+  /** Artery of linear elements with length h and the cross-sectional area and the volumetric
+   *  flow rate as unknowns at every node, the values at both ends are prescribed by terminal
+   *  conditions.
+   *
+   *  The element mass matrix of each unknown is h/6 | 2 1 |. The consistent solve of M qanp = rhs
+   *                                                   | 1 2 |
+   *  with rhs = M q reproduces q, while the lumped update qanp = qan + M_L^{-1} (rhs - M qan)
+   *  yields qan_i + d_i + h^2/6 d''_i for an increment d = q - qan, which vanishes at both ends,
+   *  at the interior nodes.
+   */
+  class LumpedMassUpdateTest : public testing::Test
+  {
+   protected:
+    static constexpr int numele = 10;
+    static constexpr double h = 0.1;
+
+    LumpedMassUpdateTest()
+        : dofrowmap_(2 * (numele + 1), 0, Core::Communication::as_epetra_comm(MPI_COMM_WORLD)),
+          massmat_(dofrowmap_, 6, false, true),
+          bcval_(dofrowmap_, true),
+          dbctog_(dofrowmap_, true)
+    {
+      for (int ele = 0; ele < numele; ++ele)
+      {
+        for (int i = 0; i < 2; ++i)
+        {
+          for (int dof = 0; dof < 2; ++dof)
+          {
+            const int row = 2 * (ele + i) + dof;
+            if (not dofrowmap_.MyGID(row)) continue;
+            massmat_.assemble(h / 3.0, row, row);
+            massmat_.assemble(h / 6.0, row, 2 * (ele + 1 - i) + dof);
+          }
+        }
+      }
+      massmat_.complete();
+    }
+
+    //! nodal values of the area and the flow rate
+    Core::LinAlg::Vector<double> nodal_values(
+        const std::function<double(double)>& area, const std::function<double(double)>& flow)
+    {
+      Core::LinAlg::Vector<double> values(dofrowmap_, true);
+      for (int lid = 0; lid < dofrowmap_.NumMyElements(); ++lid)
+      {
+        const int gid = dofrowmap_.GID(lid);
+        const double x = h * (gid / 2);
+        values[lid] = (gid % 2 == 0) ? area(x) : flow(x);
+      }
+      return values;
+    }
+
+    //! prescribe the values of q at both ends of the artery
+    void set_terminal_values(const Core::LinAlg::Vector<double>& q)
+    {
+      for (int lid = 0; lid < dofrowmap_.NumMyElements(); ++lid)
+      {
+        const int node = dofrowmap_.GID(lid) / 2;
+        if (node != 0 and node != numele) continue;
+        bcval_[lid] = q[lid];
+        dbctog_[lid] = 1.0;
+      }
+    }
+
+    //! lumped mass update starting from qan towards the solution q of the consistent system
+    Core::LinAlg::Vector<double> lumped_update(
+        const Core::LinAlg::Vector<double>& qan, const Core::LinAlg::Vector<double>& q)
+    {
+      Core::LinAlg::Vector<double> rhs(dofrowmap_, true);
+      massmat_.multiply(false, q, rhs);
+      set_terminal_values(q);
+
+      Core::LinAlg::Vector<double> qanp(qan);
+      Core::LinAlg::Vector<double> residual(dofrowmap_, true);
+      const std::shared_ptr<Core::LinAlg::Vector<double>> invlumpedmass =
+          Arteries::Utils::inverse_lumped_mass(massmat_);
+      Arteries::Utils::lumped_mass_update(
+          massmat_, *invlumpedmass, rhs, bcval_, dbctog_, qanp, residual);
+      return qanp;
+    }
+
+    Epetra_Map dofrowmap_;
+    Core::LinAlg::SparseMatrix massmat_;
+    Core::LinAlg::Vector<double> bcval_;
+    Core::LinAlg::Vector<double> dbctog_;
+  };
+
+  TEST_F(LumpedMassUpdateTest, InverseLumpedMass)
+  {
+    const std::shared_ptr<Core::LinAlg::Vector<double>> invlumpedmass =
+        Arteries::Utils::inverse_lumped_mass(massmat_);
+
+    for (int lid = 0; lid < dofrowmap_.NumMyElements(); ++lid)
+    {
+      const int node = dofrowmap_.GID(lid) / 2;
+      const double lumpedmass = (node == 0 or node == numele) ? 0.5 * h : h;
+      EXPECT_NEAR((*invlumpedmass)[lid], 1.0 / lumpedmass, 1.0e-12);
+    }
+  }
+
+  TEST_F(LumpedMassUpdateTest, TerminalValuesOfSteadyStateMatchConsistentSolve)
+  {
+    // the state only changes at both ends of the artery, the update inserts the terminal values
+    // before the residual is computed, hence no spurious increment is spread to the interior
+    const Core::LinAlg::Vector<double> q =
+        nodal_values([](double x) { return 1.0 + x * x; }, [](double x) { return std::sin(x); });
+    Core::LinAlg::Vector<double> qan(q);
+    for (int lid = 0; lid < dofrowmap_.NumMyElements(); ++lid)
+    {
+      const int node = dofrowmap_.GID(lid) / 2;
+      if (node == 0 or node == numele) qan[lid] += 0.5;
+    }
+
+    const Core::LinAlg::Vector<double> qanp = lumped_update(qan, q);
+    for (int lid = 0; lid < dofrowmap_.NumMyElements(); ++lid)
+      EXPECT_NEAR(qanp[lid], q[lid], 1.0e-12);
+  }
+
+  TEST_F(LumpedMassUpdateTest, QuadraticIncrementDeviatesByLumpingError)
+  {
+    // the increment vanishes at both ends of the artery, its second derivative is -2 for the area
+    // and 4 for the flow rate
+    const Core::LinAlg::Vector<double> qan =
+        nodal_values([](double x) { return 1.0 + x; }, [](double x) { return std::cos(x); });
+    const Core::LinAlg::Vector<double> q =
+        nodal_values([](double x) { return 1.0 + x + x * (1.0 - x); },
+            [](double x) { return std::cos(x) - 2.0 * x * (1.0 - x); });
+
+    const Core::LinAlg::Vector<double> qanp = lumped_update(qan, q);
+    for (int lid = 0; lid < dofrowmap_.NumMyElements(); ++lid)
+    {
+      const int gid = dofrowmap_.GID(lid);
+      const int node = gid / 2;
+      const double d2 = (gid % 2 == 0) ? -2.0 : 4.0;
+      const double error = (node == 0 or node == numele) ? 0.0 : h * h / 6.0 * d2;
+      EXPECT_NEAR(qanp[lid], q[lid] + error, 1.0e-12);
+    }
+  }
+}  // namespace
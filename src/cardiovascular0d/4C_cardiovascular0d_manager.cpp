@@ -15,6 +15,7 @@
 #include "4C_cardiovascular0d_mor_pod.hpp"
 #include "4C_cardiovascular0d_respiratory_syspulperiphcirculation.hpp"
 #include "4C_cardiovascular0d_resulttest.hpp"
+#include "4C_cardiovascular0d_schur_complement.hpp"
 #include "4C_cardiovascular0d_syspulcirculation.hpp"
 #include "4C_fem_condition.hpp"
 #include "4C_global_data.hpp"
@@ -33,6 +34,7 @@
 #include <Teuchos_ParameterList.hpp>
 #include <Teuchos_StandardParameterEntryValidators.hpp>
 
+#include <cmath>
 #include <iostream>
 
 FOUR_C_NAMESPACE_OPEN
@@ -100,6 +102,7 @@ Utils::Cardiovascular0DManager::Cardiovascular0DManager(
       tolres_cardvasc0d_(cv0dparams.get("TOL_CARDVASC0D_RES", 1.0e-8)),
       algochoice_(Teuchos::getIntegralValue<Inpar::Cardiovascular0D::Cardvasc0DSolveAlgo>(
           cv0dparams, "SOLALGORITHM")),
+      schur_solver_(nullptr),
       dirichtoggle_(nullptr),
       zeros_(Core::LinAlg::create_vector(*(actdisc_->dof_row_map()), true)),
       theta_(cv0dparams.get("TIMINT_THETA", 0.5)),
@@ -211,6 +214,11 @@ Utils::Cardiovascular0DManager::Cardiovascular0DManager(
     redcardiovascular0dmap_ = Core::LinAlg::allreduce_e_map(*cardiovascular0dmap_);
     cardvasc0dimpo_ =
         std::make_shared<Epetra_Export>(*redcardiovascular0dmap_, *cardiovascular0dmap_);
+    if (algochoice_ == Inpar::Cardiovascular0D::cardvasc0dsolve_schur)
+    {
+      schur_solver_ = std::make_shared<Cardiovascular0D::SchurComplementSolver>(
+          *cardiovascular0dmap_, cv0dparams.get("SCHUR_REFRESH_TOL", 0.0));
+    }
     cv0ddofincrement_ = std::make_shared<Core::LinAlg::Vector<double>>(*cardiovascular0dmap_);
     cv0ddof_n_ = std::make_shared<Core::LinAlg::Vector<double>>(*cardiovascular0dmap_);
     cv0ddof_np_ = std::make_shared<Core::LinAlg::Vector<double>>(*cardiovascular0dmap_);
@@ -961,6 +969,40 @@ int Utils::Cardiovascular0DManager::solve(Core::LinAlg::SparseMatrix& mat_struct
     mat_structstiff.replace_diagonal_values(*diag3D);
   }
 
+  if (algochoice_ == Inpar::Cardiovascular0D::cardvasc0dsolve_schur)
+  {
+    if (have_mor_)
+      FOUR_C_THROW("Schur complement solver not available with model order reduction!");
+
+    double norm_res_struct, norm_res_cardvasc0d;
+    rhsstruct.Norm2(&norm_res_struct);
+    rhscardvasc0d.Norm2(&norm_res_cardvasc0d);
+
+    // solve with the structural solver and its own preconditioner
+    Core::LinAlg::SolverParams solver_params;
+    if (isadapttol_ && counter_)
+    {
+      solver_params.nonlin_tolerance = tolres_struct_;
+      solver_params.nonlin_residual =
+          std::sqrt(norm_res_struct * norm_res_struct + norm_res_cardvasc0d * norm_res_cardvasc0d);
+      solver_params.lin_tol_better = adaptolbetter_;
+    }
+    solver_params.refactor = true;
+    solver_params.reset = counter_ == 0;
+    linsolveerror_ = schur_solver_->solve(*solver_, mat_structstiff, *mat_dcardvasc0d_dd,
+        *mat_dstruct_dcv0ddof, *mat_cardvasc0dstiff, dispinc, cv0ddofincr, rhsstruct,
+        rhscardvasc0d, solver_params);
+
+    cv0ddofincrement_->Update(1., cv0ddofincr, 0.);
+
+    counter_++;
+
+    // update 0D cardiovascular dofs
+    update_cv0_d_dof(cv0ddofincr);
+
+    return linsolveerror_;
+  }
+
   // merge maps to one large map
   std::shared_ptr<Epetra_Map> mergedmap =
       Core::LinAlg::merge_map(standrowmap, cardvasc0drowmap, false);
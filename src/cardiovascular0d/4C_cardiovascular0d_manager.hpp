@@ -46,6 +46,7 @@ namespace Core::LinAlg
 namespace Cardiovascular0D
 {
   class ProperOrthogonalDecomposition;
+  class SchurComplementSolver;
 }
 
 namespace Utils
@@ -411,6 +412,8 @@ namespace Utils
     double tolres_struct_;      ///< tolerace for structural residual
     double tolres_cardvasc0d_;  ///< tolerace for cardiovascular0d residual
     Inpar::Cardiovascular0D::Cardvasc0DSolveAlgo algochoice_;
+    std::shared_ptr<Cardiovascular0D::SchurComplementSolver>
+        schur_solver_;  ///< solver eliminating the structural unknowns (SOLALGORITHM schur)
     std::shared_ptr<Core::LinAlg::Vector<double>>
         dirichtoggle_;                                     ///< \b only for compatibility: dirichlet
                                                            ///< toggle -- monitor its target change!
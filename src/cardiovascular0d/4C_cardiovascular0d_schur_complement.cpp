@@ -0,0 +1,138 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_cardiovascular0d_schur_complement.hpp"
+
+#include "4C_linalg_serialdensematrix.hpp"
+#include "4C_linalg_serialdensevector.hpp"
+#include "4C_linalg_sparsematrix.hpp"
+#include "4C_linalg_utils_densematrix_communication.hpp"
+#include "4C_linear_solver_method_linalg.hpp"
+#include "4C_utils_exceptions.hpp"
+
+#include <Teuchos_SerialDenseSolver.hpp>
+
+#include <cmath>
+
+FOUR_C_NAMESPACE_OPEN
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+Cardiovascular0D::SchurComplementSolver::SchurComplementSolver(
+    const Epetra_Map& cv0ddofrowmap, const double refresh_tol)
+    : cv0ddofrowmap_(cv0ddofrowmap),
+      redcv0ddofrowmap_(Core::LinAlg::allreduce_e_map(cv0ddofrowmap)),
+      cv0dexport_(*redcv0ddofrowmap_, cv0ddofrowmap),
+      refresh_tol_(refresh_tol)
+{
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+int Cardiovascular0D::SchurComplementSolver::solve(Core::LinAlg::Solver& solver,
+    Core::LinAlg::SparseMatrix& structstiff, const Core::LinAlg::SparseMatrix& dcv0d_dd,
+    const Core::LinAlg::SparseMatrix& dstruct_dcv0ddof,
+    const Core::LinAlg::SparseMatrix& cv0dstiff, Core::LinAlg::Vector<double>& dispinc,
+    Core::LinAlg::Vector<double>& cv0ddofincr, const Core::LinAlg::Vector<double>& rhsstruct,
+    const Core::LinAlg::Vector<double>& rhscv0d, const Core::LinAlg::SolverParams& solver_params)
+{
+  const int num_cv0ddofs = redcv0ddofrowmap_->NumGlobalElements();
+  const Epetra_Map& dofrowmap = structstiff.row_map();
+
+  // check whether the structural solutions of the coupling columns are outdated
+  const double norm_structstiff = structstiff.norm_frobenius();
+  refreshed_ =
+      columns_ == nullptr or refresh_tol_ <= 0.0 or
+      std::abs(norm_structstiff - norm_structstiff_) > refresh_tol_ * norm_structstiff_;
+
+  // unit vectors of the 0D dofs, column j belongs to the j-th dof of the redundant map
+  Core::LinAlg::MultiVector<double> unit(cv0ddofrowmap_, num_cv0ddofs, true);
+  for (int j = 0; j < num_cv0ddofs; ++j)
+  {
+    const int gid = redcv0ddofrowmap_->GID(j);
+    if (cv0ddofrowmap_.MyGID(gid)) unit.ReplaceGlobalValue(gid, j, 1.0);
+  }
+
+  // right hand sides of the structural solve: residual and (if necessary) coupling columns
+  const int num_rhs = refreshed_ ? num_cv0ddofs + 1 : 1;
+  auto rhs = std::make_shared<Core::LinAlg::MultiVector<double>>(dofrowmap, num_rhs, true);
+  auto sol = std::make_shared<Core::LinAlg::MultiVector<double>>(dofrowmap, num_rhs, true);
+  (*rhs)(0).Update(1.0, rhsstruct, 0.0);
+  if (refreshed_)
+  {
+    Core::LinAlg::MultiVector<double> columns(dofrowmap, num_cv0ddofs, true);
+    dstruct_dcv0ddof.multiply(false, unit, columns);
+    for (int j = 0; j < num_cv0ddofs; ++j) (*rhs)(j + 1).Update(1.0, columns(j), 0.0);
+  }
+
+  // solve with the structural solver and its own preconditioner
+  const int error =
+      solver.solve_with_multi_vector(structstiff.epetra_operator(), sol, rhs, solver_params);
+  solver.reset_tolerance();
+
+  if (refreshed_)
+  {
+    norm_structstiff_ = norm_structstiff;
+    columns_ = std::make_shared<Core::LinAlg::MultiVector<double>>(dofrowmap, num_cv0ddofs, false);
+    for (int j = 0; j < num_cv0ddofs; ++j) (*columns_)(j).Update(1.0, (*sol)(j + 1), 0.0);
+
+    // Schur complement S = A - C Y, where C is the transpose of dcv0d_dd
+    Core::LinAlg::MultiVector<double> schur(cv0ddofrowmap_, num_cv0ddofs, true);
+    Core::LinAlg::MultiVector<double> coupling(cv0ddofrowmap_, num_cv0ddofs, true);
+    cv0dstiff.multiply(false, unit, schur);
+    dcv0d_dd.multiply(true, *columns_, coupling);
+    schur.Update(-1.0, coupling, 1.0);
+
+    // make the Schur complement redundant
+    Core::LinAlg::MultiVector<double> schur_red(*redcv0ddofrowmap_, num_cv0ddofs, true);
+    schur_red.Import(*schur.get_ptr_of_Epetra_MultiVector(), cv0dexport_, Insert);
+
+    schur_complement_ =
+        std::make_shared<Core::LinAlg::SerialDenseMatrix>(num_cv0ddofs, num_cv0ddofs);
+    for (int j = 0; j < num_cv0ddofs; ++j)
+      for (int i = 0; i < num_cv0ddofs; ++i) (*schur_complement_)(i, j) = schur_red(j)[i];
+  }
+
+  // right hand side of the Schur complement system g = -f - C z
+  Core::LinAlg::Vector<double> schur_rhs(cv0ddofrowmap_, true);
+  dcv0d_dd.multiply(true, (*sol)(0), schur_rhs);
+  schur_rhs.Update(-1.0, rhscv0d, -1.0);
+
+  Core::LinAlg::Vector<double> schur_rhs_red(*redcv0ddofrowmap_, true);
+  schur_rhs_red.Import(schur_rhs, cv0dexport_, Insert);
+
+  // solve the small dense system redundantly on all procs
+  Core::LinAlg::SerialDenseMatrix schur_complement(*schur_complement_);
+  Core::LinAlg::SerialDenseVector cv0ddofincr_red(num_cv0ddofs);
+  Core::LinAlg::SerialDenseVector schur_rhs_dense(num_cv0ddofs);
+  for (int i = 0; i < num_cv0ddofs; ++i) schur_rhs_dense(i) = schur_rhs_red[i];
+
+  Teuchos::SerialDenseSolver<int, double> schur_solver;
+  schur_solver.setMatrix(Teuchos::rcpFromRef(schur_complement));
+  schur_solver.setVectors(
+      Teuchos::rcpFromRef(cv0ddofincr_red), Teuchos::rcpFromRef(schur_rhs_dense));
+  schur_solver.factorWithEquilibration(true);
+  int err = schur_solver.factor();
+  if (err != 0) FOUR_C_THROW("Factorization of the 0D Schur complement failed with error %d", err);
+  err = schur_solver.solve();
+  if (err != 0) FOUR_C_THROW("Solution of the 0D Schur complement failed with error %d", err);
+
+  // distribute the 0D increment and recover the structural increment d = z - Y p
+  for (int j = 0; j < num_cv0ddofs; ++j)
+  {
+    const int lid = cv0ddofrowmap_.LID(redcv0ddofrowmap_->GID(j));
+    if (lid >= 0) cv0ddofincr[lid] = cv0ddofincr_red(j);
+  }
+
+  dispinc.Update(1.0, (*sol)(0), 0.0);
+  for (int j = 0; j < num_cv0ddofs; ++j)
+    dispinc.Update(-cv0ddofincr_red(j), (*columns_)(j), 1.0);
+
+  return error;
+}
+
+FOUR_C_NAMESPACE_CLOSE
@@ -0,0 +1,106 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_CARDIOVASCULAR0D_SCHUR_COMPLEMENT_HPP
+#define FOUR_C_CARDIOVASCULAR0D_SCHUR_COMPLEMENT_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_linalg_multi_vector.hpp"
+#include "4C_linalg_vector.hpp"
+
+#include <Epetra_Export.h>
+#include <Epetra_Map.h>
+
+#include <memory>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Core::LinAlg
+{
+  class SerialDenseMatrix;
+  class SparseMatrix;
+  class Solver;
+  struct SolverParams;
+}  // namespace Core::LinAlg
+
+namespace Cardiovascular0D
+{
+  /*!
+   * \brief Solve the coupled 3D-0D system by eliminating the structural unknowns
+   *
+   *   [ K  B ] [ d ]   [  r ]
+   *   [ C  A ] [ p ] = [ -f ]
+   *
+   * The 0D coupling has rank k (number of 0D dofs), hence Y = K^{-1} B needs k structural solves
+   * which are done together with z = K^{-1} r as one multi-vector solve. The small dense Schur
+   * complement S = A - C Y is solved redundantly on all procs and the structural increment
+   * follows from d = z - Y p. Y and S are kept as long as the Frobenius norm of K does not change
+   * by more than the refresh tolerance, which results in an inexact Newton direction in between
+   * the refreshes.
+   */
+  class SchurComplementSolver
+  {
+   public:
+    SchurComplementSolver(const Epetra_Map& cv0ddofrowmap, double refresh_tol);
+
+    /*!
+     * \brief Solve the coupled system
+     *
+     * \param solver            (in): structural solver
+     * \param structstiff       (in): structural stiffness K
+     * \param dcv0d_dd          (in): transpose of the 0D-structure coupling C
+     * \param dstruct_dcv0ddof  (in): structure-0D coupling B
+     * \param cv0dstiff         (in): 0D stiffness A
+     * \param dispinc          (out): structural increment d
+     * \param cv0ddofincr      (out): 0D increment p
+     * \param rhsstruct         (in): structural right hand side r
+     * \param rhscv0d           (in): 0D residual f
+     * \param solver_params     (in): parameters of the structural solve
+     * \return error of the structural solve
+     */
+    int solve(Core::LinAlg::Solver& solver, Core::LinAlg::SparseMatrix& structstiff,
+        const Core::LinAlg::SparseMatrix& dcv0d_dd,
+        const Core::LinAlg::SparseMatrix& dstruct_dcv0ddof,
+        const Core::LinAlg::SparseMatrix& cv0dstiff, Core::LinAlg::Vector<double>& dispinc,
+        Core::LinAlg::Vector<double>& cv0ddofincr, const Core::LinAlg::Vector<double>& rhsstruct,
+        const Core::LinAlg::Vector<double>& rhscv0d,
+        const Core::LinAlg::SolverParams& solver_params);
+
+    //! true if the coupling columns and the Schur complement were recomputed in the last solve
+    bool refreshed() const { return refreshed_; }
+
+   private:
+    //! row map of the 0D dofs
+    Epetra_Map cv0ddofrowmap_;
+
+    //! redundant map of the 0D dofs
+    std::shared_ptr<Epetra_Map> redcv0ddofrowmap_;
+
+    //! exporter between the redundant and the distributed 0D dofs
+    Epetra_Export cv0dexport_;
+
+    //! relative stiffness change triggering new coupling columns
+    const double refresh_tol_;
+
+    //! norm of the stiffness the coupling columns belong to
+    double norm_structstiff_ = 0.0;
+
+    //! structural solutions K^{-1} B for the 0D coupling columns B
+    std::shared_ptr<Core::LinAlg::MultiVector<double>> columns_;
+
+    //! redundant Schur complement A - C K^{-1} B of the 0D block
+    std::shared_ptr<Core::LinAlg::SerialDenseMatrix> schur_complement_;
+
+    //! flag whether the last solve recomputed the coupling columns
+    bool refreshed_ = false;
+  };
+}  // namespace Cardiovascular0D
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
@@ -0,0 +1,155 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_cardiovascular0d_schur_complement.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_io_pstream.hpp"
+#include "4C_linalg_sparsematrix.hpp"
+#include "4C_linear_solver_method_linalg.hpp"
+
+#include <Teuchos_ParameterList.hpp>
+
+namespace
+{
+  using namespace FourC;
+
+  /** Coupled system of a tridiagonal structural stiffness K with 12 dofs and 3 0D dofs, which
+   *  are coupled to the structure by dense columns B and rows C:
+   *
+   *    [ K  B ] [ d ]   [  r ]
+   *    [ C  A ] [ p ] = [ -f ]
+   */
+  class SchurComplementSolverTest : public testing::Test
+  {
+   protected:
+    static constexpr int num_struct_dofs = 12;
+    static constexpr int num_cv0d_dofs = 3;
+
+    SchurComplementSolverTest()
+        : structmap_(num_struct_dofs, 0, Core::Communication::as_epetra_comm(MPI_COMM_WORLD)),
+          cv0dmap_(num_cv0d_dofs, 0, Core::Communication::as_epetra_comm(MPI_COMM_WORLD)),
+          structstiff_(structmap_, 3, false, true),
+          dstruct_dcv0ddof_(structmap_, num_cv0d_dofs, false, true),
+          dcv0d_dd_(structmap_, num_cv0d_dofs, false, true),
+          cv0dstiff_(cv0dmap_, num_cv0d_dofs, false, true),
+          rhsstruct_(structmap_, true),
+          rhscv0d_(cv0dmap_, true)
+    {
+      for (int lid = 0; lid < structmap_.NumMyElements(); ++lid)
+      {
+        const int row = structmap_.GID(lid);
+        structstiff_.assemble(4.0, row, row);
+        if (row > 0) structstiff_.assemble(-1.0, row, row - 1);
+        if (row < num_struct_dofs - 1) structstiff_.assemble(-1.0, row, row + 1);
+
+        for (int j = 0; j < num_cv0d_dofs; ++j)
+        {
+          dstruct_dcv0ddof_.assemble(0.1 * (row + 1) * (j + 1) / num_struct_dofs, row, j);
+          dcv0d_dd_.assemble(0.2 * ((row + j) % 4) - 0.3, row, j);
+        }
+        rhsstruct_[lid] = 1.0 - 0.1 * row;
+      }
+      structstiff_.complete();
+      dstruct_dcv0ddof_.complete(cv0dmap_, structmap_);
+      dcv0d_dd_.complete(cv0dmap_, structmap_);
+
+      for (int lid = 0; lid < cv0dmap_.NumMyElements(); ++lid)
+      {
+        const int row = cv0dmap_.GID(lid);
+        for (int j = 0; j < num_cv0d_dofs; ++j)
+          cv0dstiff_.assemble(row == j ? 3.0 : 0.5, row, j);
+        rhscv0d_[lid] = 0.5 * row - 0.2;
+      }
+      cv0dstiff_.complete();
+
+      Teuchos::ParameterList solverparams;
+      solverparams.set("solver", "umfpack");
+      solver_ = std::make_shared<Core::LinAlg::Solver>(
+          solverparams, MPI_COMM_WORLD, nullptr, Core::IO::minimal, false);
+    }
+
+    //! solve the coupled system and return the norm of its residual
+    double solve_and_compute_residual(Cardiovascular0D::SchurComplementSolver& schur_solver)
+    {
+      Core::LinAlg::Vector<double> dispinc(structmap_, true);
+      Core::LinAlg::Vector<double> cv0ddofincr(cv0dmap_, true);
+
+      Core::LinAlg::SolverParams solver_params;
+      solver_params.refactor = true;
+      solver_params.reset = true;
+      const int error = schur_solver.solve(*solver_, structstiff_, dcv0d_dd_, dstruct_dcv0ddof_,
+          cv0dstiff_, dispinc, cv0ddofincr, rhsstruct_, rhscv0d_, solver_params);
+      EXPECT_EQ(error, 0);
+
+      // K d + B p - r
+      Core::LinAlg::Vector<double> res_struct(structmap_, true);
+      Core::LinAlg::Vector<double> coupling_struct(structmap_, true);
+      structstiff_.multiply(false, dispinc, res_struct);
+      dstruct_dcv0ddof_.multiply(false, cv0ddofincr, coupling_struct);
+      res_struct.Update(1.0, coupling_struct, -1.0, rhsstruct_, 1.0);
+
+      // C d + A p + f
+      Core::LinAlg::Vector<double> res_cv0d(cv0dmap_, true);
+      Core::LinAlg::Vector<double> coupling_cv0d(cv0dmap_, true);
+      cv0dstiff_.multiply(false, cv0ddofincr, res_cv0d);
+      dcv0d_dd_.multiply(true, dispinc, coupling_cv0d);
+      res_cv0d.Update(1.0, coupling_cv0d, 1.0, rhscv0d_, 1.0);
+
+      double norm_struct = 0.0, norm_cv0d = 0.0;
+      res_struct.Norm2(&norm_struct);
+      res_cv0d.Norm2(&norm_cv0d);
+      return norm_struct + norm_cv0d;
+    }
+
+    Epetra_Map structmap_;
+    Epetra_Map cv0dmap_;
+    Core::LinAlg::SparseMatrix structstiff_;
+    Core::LinAlg::SparseMatrix dstruct_dcv0ddof_;
+    Core::LinAlg::SparseMatrix dcv0d_dd_;
+    Core::LinAlg::SparseMatrix cv0dstiff_;
+    Core::LinAlg::Vector<double> rhsstruct_;
+    Core::LinAlg::Vector<double> rhscv0d_;
+    std::shared_ptr<Core::LinAlg::Solver> solver_;
+  };
+
+  TEST_F(SchurComplementSolverTest, SolvesCoupledSystem)
+  {
+    Cardiovascular0D::SchurComplementSolver schur_solver(cv0dmap_, 0.0);
+
+    EXPECT_LT(solve_and_compute_residual(schur_solver), 1.0e-10);
+    EXPECT_TRUE(schur_solver.refreshed());
+
+    // without refresh tolerance the coupling columns are recomputed in every solve
+    EXPECT_LT(solve_and_compute_residual(schur_solver), 1.0e-10);
+    EXPECT_TRUE(schur_solver.refreshed());
+  }
+
+  TEST_F(SchurComplementSolverTest, KeepsCouplingColumnsWithinRefreshTolerance)
+  {
+    Cardiovascular0D::SchurComplementSolver schur_solver(cv0dmap_, 0.1);
+
+    EXPECT_LT(solve_and_compute_residual(schur_solver), 1.0e-10);
+    EXPECT_TRUE(schur_solver.refreshed());
+
+    // an unchanged stiffness keeps the coupling columns and the solution is still exact
+    EXPECT_LT(solve_and_compute_residual(schur_solver), 1.0e-10);
+    EXPECT_FALSE(schur_solver.refreshed());
+
+    // a small change of the stiffness keeps the outdated coupling columns, the solution is inexact
+    structstiff_.scale(1.05);
+    EXPECT_GT(solve_and_compute_residual(schur_solver), 1.0e-6);
+    EXPECT_FALSE(schur_solver.refreshed());
+
+    // a large change triggers new coupling columns and the exact solution
+    structstiff_.scale(1.2);
+    EXPECT_LT(solve_and_compute_residual(schur_solver), 1.0e-10);
+    EXPECT_TRUE(schur_solver.refreshed());
+  }
+}  // namespace
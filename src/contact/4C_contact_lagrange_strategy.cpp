@@ -5655,7 +5655,7 @@ void CONTACT::LagrangeStrategy::condense_friction(
   std::shared_ptr<Core::LinAlg::SparseMatrix> dhat =
       std::make_shared<Core::LinAlg::SparseMatrix>(*gactivedofs_, 10);
   if (aset && iset)
-    dhat = Core::LinAlg::matrix_multiply(*invda, false, *dai, false, false, false, true);
+    dhat = condensation_products_["invda*dai"](*invda, false, *dai, false, false, false);
   dhat->complete(*gidofs, *gactivedofs_);
 
   // active part of mmatrix
@@ -5668,7 +5668,8 @@ void CONTACT::LagrangeStrategy::condense_friction(
   std::shared_ptr<Core::LinAlg::SparseMatrix> mhataam =
       std::make_shared<Core::LinAlg::SparseMatrix>(*gactivedofs_, 10);
   if (aset)
-    mhataam = Core::LinAlg::matrix_multiply(*invda, false, *mmatrixa, false, false, false, true);
+    mhataam = condensation_products_["invda*mmatrixa"](
+        *invda, false, *mmatrixa, false, false, false);
   mhataam->complete(*gmdofrowmap_, *gactivedofs_);
 
   // for the case without full linearization, we still need the
@@ -5700,7 +5701,7 @@ void CONTACT::LagrangeStrategy::condense_friction(
       std::make_shared<Core::LinAlg::SparseMatrix>(*gmdofrowmap_, 100);
   kmnmod->add(*kmn, false, 1.0, 1.0);
   std::shared_ptr<Core::LinAlg::SparseMatrix> kmnadd =
-      Core::LinAlg::matrix_multiply(*mhataam, true, *kan, false, false, false, true);
+      condensation_products_["mhataam^T*kan"](*mhataam, true, *kan, false, false, false);
   kmnmod->add(*kmnadd, false, 1.0, 1.0);
   kmnmod->complete(kmn->domain_map(), kmn->row_map());
 
@@ -5709,7 +5710,7 @@ void CONTACT::LagrangeStrategy::condense_friction(
       std::make_shared<Core::LinAlg::SparseMatrix>(*gmdofrowmap_, 100);
   kmmmod->add(*kmm, false, 1.0, 1.0);
   std::shared_ptr<Core::LinAlg::SparseMatrix> kmmadd =
-      Core::LinAlg::matrix_multiply(*mhataam, true, *kam, false, false, false, true);
+      condensation_products_["mhataam^T*kam"](*mhataam, true, *kam, false, false, false);
   kmmmod->add(*kmmadd, false, 1.0, 1.0);
   kmmmod->complete(kmm->domain_map(), kmm->row_map());
 
@@ -5720,7 +5721,7 @@ void CONTACT::LagrangeStrategy::condense_friction(
     kmimod = std::make_shared<Core::LinAlg::SparseMatrix>(*gmdofrowmap_, 100);
     kmimod->add(*kmi, false, 1.0, 1.0);
     std::shared_ptr<Core::LinAlg::SparseMatrix> kmiadd =
-        Core::LinAlg::matrix_multiply(*mhataam, true, *kai, false, false, false, true);
+        condensation_products_["mhataam^T*kai"](*mhataam, true, *kai, false, false, false);
     kmimod->add(*kmiadd, false, 1.0, 1.0);
     kmimod->complete(kmi->domain_map(), kmi->row_map());
   }
@@ -5732,7 +5733,7 @@ void CONTACT::LagrangeStrategy::condense_friction(
     kmamod = std::make_shared<Core::LinAlg::SparseMatrix>(*gmdofrowmap_, 100);
     kmamod->add(*kma, false, 1.0, 1.0);
     std::shared_ptr<Core::LinAlg::SparseMatrix> kmaadd =
-        Core::LinAlg::matrix_multiply(*mhataam, true, *kaa, false, false, false, true);
+        condensation_products_["mhataam^T*kaa"](*mhataam, true, *kaa, false, false, false);
     kmamod->add(*kmaadd, false, 1.0, 1.0);
     kmamod->complete(kma->domain_map(), kma->row_map());
   }
@@ -5745,7 +5746,7 @@ void CONTACT::LagrangeStrategy::condense_friction(
   if (aset && iset)
   {
     std::shared_ptr<Core::LinAlg::SparseMatrix> kinadd =
-        Core::LinAlg::matrix_multiply(*dhat, true, *kan, false, false, false, true);
+        condensation_products_["dhat^T*kan"](*dhat, true, *kan, false, false, false);
     kinmod->add(*kinadd, false, -1.0, 1.0);
   }
   kinmod->complete(kin->domain_map(), kin->row_map());
@@ -5757,7 +5758,7 @@ void CONTACT::LagrangeStrategy::condense_friction(
   if (aset && iset)
   {
     std::shared_ptr<Core::LinAlg::SparseMatrix> kimadd =
-        Core::LinAlg::matrix_multiply(*dhat, true, *kam, false, false, false, true);
+        condensation_products_["dhat^T*kam"](*dhat, true, *kam, false, false, false);
     kimmod->add(*kimadd, false, -1.0, 1.0);
   }
   kimmod->complete(kim->domain_map(), kim->row_map());
@@ -5771,7 +5772,7 @@ void CONTACT::LagrangeStrategy::condense_friction(
     if (aset)
     {
       std::shared_ptr<Core::LinAlg::SparseMatrix> kiiadd =
-          Core::LinAlg::matrix_multiply(*dhat, true, *kai, false, false, false, true);
+          condensation_products_["dhat^T*kai"](*dhat, true, *kai, false, false, false);
       kiimod->add(*kiiadd, false, -1.0, 1.0);
     }
     kiimod->complete(kii->domain_map(), kii->row_map());
@@ -5784,7 +5785,7 @@ void CONTACT::LagrangeStrategy::condense_friction(
     kiamod = std::make_shared<Core::LinAlg::SparseMatrix>(*gidofs, 100);
     kiamod->add(*kia, false, 1.0, 1.0);
     std::shared_ptr<Core::LinAlg::SparseMatrix> kiaadd =
-        Core::LinAlg::matrix_multiply(*dhat, true, *kaa, false, false, false, true);
+        condensation_products_["dhat^T*kaa"](*dhat, true, *kaa, false, false, false);
     kiamod->add(*kiaadd, false, -1.0, 1.0);
     kiamod->complete(kia->domain_map(), kia->row_map());
   }
@@ -5798,42 +5799,47 @@ void CONTACT::LagrangeStrategy::condense_friction(
   std::shared_ptr<Core::LinAlg::SparseMatrix> kstnmod;
   if (stickset)
   {
-    kstnmod = Core::LinAlg::matrix_multiply(*linstickLM_, false, *invdst, true, false, false, true);
-    kstnmod = Core::LinAlg::matrix_multiply(*kstnmod, false, *kan, false, false, false, true);
+    kstnmod = condensation_products_["linstickLM_*invdst^T"](
+        *linstickLM_, false, *invdst, true, false, false);
+    kstnmod = condensation_products_["kstnmod*kan"](*kstnmod, false, *kan, false, false, false);
   }
 
   // kstm: multiply with linstickLM
   std::shared_ptr<Core::LinAlg::SparseMatrix> kstmmod;
   if (stickset)
   {
-    kstmmod = Core::LinAlg::matrix_multiply(*linstickLM_, false, *invdst, true, false, false, true);
-    kstmmod = Core::LinAlg::matrix_multiply(*kstmmod, false, *kam, false, false, false, true);
+    kstmmod = condensation_products_["linstickLM_*invdst^T"](
+        *linstickLM_, false, *invdst, true, false, false);
+    kstmmod = condensation_products_["kstmmod*kam"](*kstmmod, false, *kam, false, false, false);
   }
 
   // ksti: multiply with linstickLM
   std::shared_ptr<Core::LinAlg::SparseMatrix> kstimod;
   if (stickset && iset)
   {
-    kstimod = Core::LinAlg::matrix_multiply(*linstickLM_, false, *invdst, true, false, false, true);
-    kstimod = Core::LinAlg::matrix_multiply(*kstimod, false, *kai, false, false, false, true);
+    kstimod = condensation_products_["linstickLM_*invdst^T"](
+        *linstickLM_, false, *invdst, true, false, false);
+    kstimod = condensation_products_["kstimod*kai"](*kstimod, false, *kai, false, false, false);
   }
 
   // kstsl: multiply with linstickLM
   std::shared_ptr<Core::LinAlg::SparseMatrix> kstslmod;
   if (stickset && slipset)
   {
-    kstslmod =
-        Core::LinAlg::matrix_multiply(*linstickLM_, false, *invdst, true, false, false, true);
-    kstslmod = Core::LinAlg::matrix_multiply(*kstslmod, false, *kasl, false, false, false, true);
+    kstslmod = condensation_products_["linstickLM_*invdst^T"](
+        *linstickLM_, false, *invdst, true, false, false);
+    kstslmod = condensation_products_["kstslmod*kasl"](
+        *kstslmod, false, *kasl, false, false, false);
   }
 
   // kststmod: multiply with linstickLM
   std::shared_ptr<Core::LinAlg::SparseMatrix> kststmod;
   if (stickset)
   {
-    kststmod =
-        Core::LinAlg::matrix_multiply(*linstickLM_, false, *invdst, true, false, false, true);
-    kststmod = Core::LinAlg::matrix_multiply(*kststmod, false, *kast, false, false, false, true);
+    kststmod = condensation_products_["linstickLM_*invdst^T"](
+        *linstickLM_, false, *invdst, true, false, false);
+    kststmod = condensation_products_["kststmod*kast"](
+        *kststmod, false, *kast, false, false, false);
   }
 
   //--------------------------------------------------------- SIXTH LINE
@@ -5843,40 +5849,47 @@ void CONTACT::LagrangeStrategy::condense_friction(
   std::shared_ptr<Core::LinAlg::SparseMatrix> kslnmod;
   if (slipset)
   {
-    kslnmod = Core::LinAlg::matrix_multiply(*linslipLM_, false, *invdsl, true, false, false, true);
-    kslnmod = Core::LinAlg::matrix_multiply(*kslnmod, false, *kan, false, false, false, true);
+    kslnmod = condensation_products_["linslipLM_*invdsl^T"](
+        *linslipLM_, false, *invdsl, true, false, false);
+    kslnmod = condensation_products_["kslnmod*kan"](*kslnmod, false, *kan, false, false, false);
   }
 
   // kslm: multiply with linslipLM
   std::shared_ptr<Core::LinAlg::SparseMatrix> kslmmod;
   if (slipset)
   {
-    kslmmod = Core::LinAlg::matrix_multiply(*linslipLM_, false, *invdsl, true, false, false, true);
-    kslmmod = Core::LinAlg::matrix_multiply(*kslmmod, false, *kam, false, false, false, true);
+    kslmmod = condensation_products_["linslipLM_*invdsl^T"](
+        *linslipLM_, false, *invdsl, true, false, false);
+    kslmmod = condensation_products_["kslmmod*kam"](*kslmmod, false, *kam, false, false, false);
   }
 
   // ksli: multiply with linslipLM
   std::shared_ptr<Core::LinAlg::SparseMatrix> kslimod;
   if (slipset && iset)
   {
-    kslimod = Core::LinAlg::matrix_multiply(*linslipLM_, false, *invdsl, true, false, false, true);
-    kslimod = Core::LinAlg::matrix_multiply(*kslimod, false, *kai, false, false, false, true);
+    kslimod = condensation_products_["linslipLM_*invdsl^T"](
+        *linslipLM_, false, *invdsl, true, false, false);
+    kslimod = condensation_products_["kslimod*kai"](*kslimod, false, *kai, false, false, false);
   }
 
   // kslsl: multiply with linslipLM
   std::shared_ptr<Core::LinAlg::SparseMatrix> kslslmod;
   if (slipset)
   {
-    kslslmod = Core::LinAlg::matrix_multiply(*linslipLM_, false, *invdsl, true, false, false, true);
-    kslslmod = Core::LinAlg::matrix_multiply(*kslslmod, false, *kasl, false, false, false, true);
+    kslslmod = condensation_products_["linslipLM_*invdsl^T"](
+        *linslipLM_, false, *invdsl, true, false, false);
+    kslslmod = condensation_products_["kslslmod*kasl"](
+        *kslslmod, false, *kasl, false, false, false);
   }
 
   // slstmod: multiply with linslipLM
   std::shared_ptr<Core::LinAlg::SparseMatrix> kslstmod;
   if (slipset && stickset)
   {
-    kslstmod = Core::LinAlg::matrix_multiply(*linslipLM_, false, *invdsl, true, false, false, true);
-    kslstmod = Core::LinAlg::matrix_multiply(*kslstmod, false, *kast, false, false, false, true);
+    kslstmod = condensation_products_["linslipLM_*invdsl^T"](
+        *linslipLM_, false, *invdsl, true, false, false);
+    kslstmod = condensation_products_["kslstmod*kast"](
+        *kslstmod, false, *kast, false, false, false);
   }
 
   /********************************************************************/
@@ -5927,7 +5940,8 @@ void CONTACT::LagrangeStrategy::condense_friction(
     else
       fstmod = std::make_shared<Core::LinAlg::Vector<double>>(*gstickt);
     std::shared_ptr<Core::LinAlg::SparseMatrix> temp1 =
-        Core::LinAlg::matrix_multiply(*linstickLM_, false, *invdst, true, false, false, true);
+        condensation_products_["linstickLM_*invdst^T"](
+            *linstickLM_, false, *invdst, true, false, false);
     temp1->multiply(false, *fa, *fstmod);
 
     if (constr_direction_ == Inpar::CONTACT::constr_xyz)
@@ -5951,7 +5965,8 @@ void CONTACT::LagrangeStrategy::condense_friction(
     else
       fslmod = std::make_shared<Core::LinAlg::Vector<double>>(*gslipt_);
     std::shared_ptr<Core::LinAlg::SparseMatrix> temp =
-        Core::LinAlg::matrix_multiply(*linslipLM_, false, *invdsl, true, false, false, true);
+        condensation_products_["linslipLM_*invdsl^T"](
+            *linslipLM_, false, *invdsl, true, false, false);
     temp->multiply(false, *fa, *fslmod);
 
     if (constr_direction_ == Inpar::CONTACT::constr_xyz)
@@ -6468,7 +6483,7 @@ void CONTACT::LagrangeStrategy::condense_frictionless(
   std::shared_ptr<Core::LinAlg::SparseMatrix> dhat =
       std::make_shared<Core::LinAlg::SparseMatrix>(*gactivedofs_, 10);
   if (aset && iset)
-    dhat = Core::LinAlg::matrix_multiply(*invda, false, *dai, false, false, false, true);
+    dhat = condensation_products_["invda*dai"](*invda, false, *dai, false, false, false);
   dhat->complete(*gidofs, *gactivedofs_);
 
   // active part of mmatrix
@@ -6481,7 +6496,8 @@ void CONTACT::LagrangeStrategy::condense_frictionless(
   std::shared_ptr<Core::LinAlg::SparseMatrix> mhataam =
       std::make_shared<Core::LinAlg::SparseMatrix>(*gactivedofs_, 10);
   if (aset)
-    mhataam = Core::LinAlg::matrix_multiply(*invda, false, *mmatrixa, false, false, false, true);
+    mhataam = condensation_products_["invda*mmatrixa"](
+        *invda, false, *mmatrixa, false, false, false);
   mhataam->complete(*gmdofrowmap_, *gactivedofs_);
 
   // for the case without full linearization, we still need the
@@ -6512,7 +6528,7 @@ void CONTACT::LagrangeStrategy::condense_frictionless(
       std::make_shared<Core::LinAlg::SparseMatrix>(*gmdofrowmap_, 100);
   kmnmod->add(*kmn, false, 1.0, 1.0);
   std::shared_ptr<Core::LinAlg::SparseMatrix> kmnadd =
-      Core::LinAlg::matrix_multiply(*mhataam, true, *kan, false, false, false, true);
+      condensation_products_["mhataam^T*kan"](*mhataam, true, *kan, false, false, false);
   kmnmod->add(*kmnadd, false, 1.0, 1.0);
   kmnmod->complete(kmn->domain_map(), kmn->row_map());
 
@@ -6521,7 +6537,7 @@ void CONTACT::LagrangeStrategy::condense_frictionless(
       std::make_shared<Core::LinAlg::SparseMatrix>(*gmdofrowmap_, 100);
   kmmmod->add(*kmm, false, 1.0, 1.0);
   std::shared_ptr<Core::LinAlg::SparseMatrix> kmmadd =
-      Core::LinAlg::matrix_multiply(*mhataam, true, *kam, false, false, false, true);
+      condensation_products_["mhataam^T*kam"](*mhataam, true, *kam, false, false, false);
   kmmmod->add(*kmmadd, false, 1.0, 1.0);
   kmmmod->complete(kmm->domain_map(), kmm->row_map());
 
@@ -6532,7 +6548,7 @@ void CONTACT::LagrangeStrategy::condense_frictionless(
     kmimod = std::make_shared<Core::LinAlg::SparseMatrix>(*gmdofrowmap_, 100);
     kmimod->add(*kmi, false, 1.0, 1.0);
     std::shared_ptr<Core::LinAlg::SparseMatrix> kmiadd =
-        Core::LinAlg::matrix_multiply(*mhataam, true, *kai, false, false, false, true);
+        condensation_products_["mhataam^T*kai"](*mhataam, true, *kai, false, false, false);
     kmimod->add(*kmiadd, false, 1.0, 1.0);
     kmimod->complete(kmi->domain_map(), kmi->row_map());
   }
@@ -6544,7 +6560,7 @@ void CONTACT::LagrangeStrategy::condense_frictionless(
     kmamod = std::make_shared<Core::LinAlg::SparseMatrix>(*gmdofrowmap_, 100);
     kmamod->add(*kma, false, 1.0, 1.0);
     std::shared_ptr<Core::LinAlg::SparseMatrix> kmaadd =
-        Core::LinAlg::matrix_multiply(*mhataam, true, *kaa, false, false, false, true);
+        condensation_products_["mhataam^T*kaa"](*mhataam, true, *kaa, false, false, false);
     kmamod->add(*kmaadd, false, 1.0, 1.0);
     kmamod->complete(kma->domain_map(), kma->row_map());
   }
@@ -6558,7 +6574,7 @@ void CONTACT::LagrangeStrategy::condense_frictionless(
   if (aset && iset)
   {
     std::shared_ptr<Core::LinAlg::SparseMatrix> kinadd =
-        Core::LinAlg::matrix_multiply(*dhat, true, *kan, false, false, false, true);
+        condensation_products_["dhat^T*kan"](*dhat, true, *kan, false, false, false);
     kinmod->add(*kinadd, false, -1.0, 1.0);
   }
   kinmod->complete(kin->domain_map(), kin->row_map());
@@ -6570,7 +6586,7 @@ void CONTACT::LagrangeStrategy::condense_frictionless(
   if (aset && iset)
   {
     std::shared_ptr<Core::LinAlg::SparseMatrix> kimadd =
-        Core::LinAlg::matrix_multiply(*dhat, true, *kam, false, false, false, true);
+        condensation_products_["dhat^T*kam"](*dhat, true, *kam, false, false, false);
     kimmod->add(*kimadd, false, -1.0, 1.0);
   }
   kimmod->complete(kim->domain_map(), kim->row_map());
@@ -6584,7 +6600,7 @@ void CONTACT::LagrangeStrategy::condense_frictionless(
     if (aset)
     {
       std::shared_ptr<Core::LinAlg::SparseMatrix> kiiadd =
-          Core::LinAlg::matrix_multiply(*dhat, true, *kai, false, false, false, true);
+          condensation_products_["dhat^T*kai"](*dhat, true, *kai, false, false, false);
       kiimod->add(*kiiadd, false, -1.0, 1.0);
     }
     kiimod->complete(kii->domain_map(), kii->row_map());
@@ -6597,7 +6613,7 @@ void CONTACT::LagrangeStrategy::condense_frictionless(
     kiamod = std::make_shared<Core::LinAlg::SparseMatrix>(*gidofs, 100);
     kiamod->add(*kia, false, 1.0, 1.0);
     std::shared_ptr<Core::LinAlg::SparseMatrix> kiaadd =
-        Core::LinAlg::matrix_multiply(*dhat, true, *kaa, false, false, false, true);
+        condensation_products_["dhat^T*kaa"](*dhat, true, *kaa, false, false, false);
     kiamod->add(*kiaadd, false, -1.0, 1.0);
     kiamod->complete(kia->domain_map(), kia->row_map());
   }
@@ -6610,32 +6626,36 @@ void CONTACT::LagrangeStrategy::condense_frictionless(
   std::shared_ptr<Core::LinAlg::SparseMatrix> kanmod;
   if (aset)
   {
-    kanmod = Core::LinAlg::matrix_multiply(*tmatrix_, false, *invda, true, false, false, true);
-    kanmod = Core::LinAlg::matrix_multiply(*kanmod, false, *kan, false, false, false, true);
+    kanmod = condensation_products_["tmatrix_*invda^T"](
+        *tmatrix_, false, *invda, true, false, false);
+    kanmod = condensation_products_["kanmod*kan"](*kanmod, false, *kan, false, false, false);
   }
 
   // kam: multiply tmatrix with invda and kam
   std::shared_ptr<Core::LinAlg::SparseMatrix> kammod;
   if (aset)
   {
-    kammod = Core::LinAlg::matrix_multiply(*tmatrix_, false, *invda, true, false, false, true);
-    kammod = Core::LinAlg::matrix_multiply(*kammod, false, *kam, false, false, false, true);
+    kammod = condensation_products_["tmatrix_*invda^T"](
+        *tmatrix_, false, *invda, true, false, false);
+    kammod = condensation_products_["kammod*kam"](*kammod, false, *kam, false, false, false);
   }
 
   // kai: multiply tmatrix with invda and kai
   std::shared_ptr<Core::LinAlg::SparseMatrix> kaimod;
   if (aset && iset)
   {
-    kaimod = Core::LinAlg::matrix_multiply(*tmatrix_, false, *invda, true, false, false, true);
-    kaimod = Core::LinAlg::matrix_multiply(*kaimod, false, *kai, false, false, false, true);
+    kaimod = condensation_products_["tmatrix_*invda^T"](
+        *tmatrix_, false, *invda, true, false, false);
+    kaimod = condensation_products_["kaimod*kai"](*kaimod, false, *kai, false, false, false);
   }
 
   // kaa: multiply tmatrix with invda and kaa
   std::shared_ptr<Core::LinAlg::SparseMatrix> kaamod;
   if (aset)
   {
-    kaamod = Core::LinAlg::matrix_multiply(*tmatrix_, false, *invda, true, false, false, true);
-    kaamod = Core::LinAlg::matrix_multiply(*kaamod, false, *kaa, false, false, false, true);
+    kaamod = condensation_products_["tmatrix_*invda^T"](
+        *tmatrix_, false, *invda, true, false, false);
+    kaamod = condensation_products_["kaamod*kaa"](*kaamod, false, *kaa, false, false, false);
   }
 
   /**********************************************************************/
@@ -6672,7 +6692,8 @@ void CONTACT::LagrangeStrategy::condense_frictionless(
     else
       famod = std::make_shared<Core::LinAlg::Vector<double>>(*gactivet_);
 
-    tinvda = Core::LinAlg::matrix_multiply(*tmatrix_, false, *invda, true, false, false, true);
+    tinvda = condensation_products_["tmatrix_*invda^T"](
+        *tmatrix_, false, *invda, true, false, false);
     tinvda->multiply(false, *fa, *famod);
   }
 
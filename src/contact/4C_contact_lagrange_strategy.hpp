@@ -11,6 +11,10 @@
 #include "4C_config.hpp"
 
 #include "4C_contact_abstract_strategy.hpp"
+#include "4C_linalg_utils_sparse_algebra_math.hpp"
+
+#include <map>
+#include <string>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -550,6 +554,10 @@ namespace CONTACT
     std::shared_ptr<Core::LinAlg::SparseMatrix> ksm_;  //< stiffness block K_sm (needed for LM)
     std::shared_ptr<Core::LinAlg::SparseMatrix> kss_;  //< stiffness block K_ss (needed for LM)
 
+    //! sparse matrix products of the condensation, which only compute the numerical product as
+    //! long as the sparsity patterns of their operands do not change (i.e. a stable active set)
+    std::map<std::string, Core::LinAlg::MatrixMultiply> condensation_products_;
+
     std::shared_ptr<Core::LinAlg::SparseMatrix>
         linslipLM_;  //< global matrix containing derivatives (LM) of slip condition
     std::shared_ptr<Core::LinAlg::SparseMatrix>
@@ -0,0 +1,109 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_fem_general_utils_nurbs_bezier_extraction.hpp"
+
+#include "4C_fem_general_utils_bspline.hpp"
+#include "4C_utils_exceptions.hpp"
+
+#include <Teuchos_SerialDenseSolver.hpp>
+
+#include <cmath>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  /*!
+  \brief Bernstein polynomial j of degree p on the reference interval [-1,1]
+  */
+  double bernstein_polynomial(const int p, const int j, const double u)
+  {
+    const double t = 0.5 * (u + 1.0);
+
+    double binomial = 1.0;
+    for (int k = 1; k <= j; ++k) binomial *= static_cast<double>(p - j + k) / k;
+
+    return binomial * std::pow(t, j) * std::pow(1.0 - t, p - j);
+  }
+}  // namespace
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+Core::LinAlg::SerialDenseMatrix Core::FE::Nurbs::bezier_extraction_operator(
+    const Core::LinAlg::SerialDenseVector& eleknots, const int degree)
+{
+  if (eleknots.length() != 2 * degree + 2)
+  {
+    FOUR_C_THROW("Expected %d knots for a local knot span of degree %d, got %d.", 2 * degree + 2,
+        degree, eleknots.length());
+  }
+
+  const double du = eleknots(degree + 1) - eleknots(degree);
+  if (std::abs(du) < 1e-12)
+    FOUR_C_THROW("Cannot compute the Bezier extraction operator of a zero sized element.");
+
+  const int num_bsplines = degree + 1;
+
+  // Both the bsplines and the Bernstein polynomials span the polynomials of the element
+  // degree. Collocation at interior points of the element determines the coefficients exactly:
+  //
+  //   sum_j B_j(u_k) * C_ij = N_i(xi(u_k))
+  //
+  // Interior points avoid any ambiguity of the bspline evaluation at the element boundaries.
+  Core::FE::Nurbs::BsplinePolynomial bspline(degree, eleknots);
+
+  Core::LinAlg::SerialDenseMatrix bernstein(num_bsplines, num_bsplines);
+  Core::LinAlg::SerialDenseMatrix coefficients(num_bsplines, num_bsplines);
+  Core::LinAlg::SerialDenseMatrix bsplines(num_bsplines, num_bsplines);
+  for (int k = 0; k < num_bsplines; ++k)
+  {
+    const double u = 2.0 * (k + 0.5) / num_bsplines - 1.0;
+    const double xi = eleknots(degree) + 0.5 * (u + 1.0) * du;
+
+    for (int j = 0; j < num_bsplines; ++j) bernstein(k, j) = bernstein_polynomial(degree, j, u);
+
+    for (int i = 0; i < num_bsplines; ++i)
+    {
+      double value;
+      bspline.evaluate_bspline(value, xi, i);
+      bsplines(k, i) = value;
+    }
+  }
+
+  Teuchos::SerialDenseSolver<int, double> solver;
+  solver.setMatrix(Teuchos::rcpFromRef(bernstein));
+  solver.setVectors(Teuchos::rcpFromRef(coefficients), Teuchos::rcpFromRef(bsplines));
+  solver.factorWithEquilibration(true);
+  if (solver.factor() != 0 or solver.solve() != 0)
+    FOUR_C_THROW("Solving for the Bezier extraction operator failed.");
+
+  Core::LinAlg::SerialDenseMatrix extraction(num_bsplines, num_bsplines);
+  for (int i = 0; i < num_bsplines; ++i)
+    for (int j = 0; j < num_bsplines; ++j) extraction(i, j) = coefficients(j, i);
+
+  return extraction;
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+Core::FE::Nurbs::BezierExtraction Core::FE::Nurbs::bezier_extraction(
+    const std::vector<Core::LinAlg::SerialDenseVector>& eleknots)
+{
+  BezierExtraction extraction;
+  extraction.operators.reserve(eleknots.size());
+
+  for (const auto& knots : eleknots)
+  {
+    const int degree = knots.length() / 2 - 1;
+    extraction.operators.emplace_back(bezier_extraction_operator(knots, degree));
+  }
+
+  return extraction;
+}
+
+FOUR_C_NAMESPACE_CLOSE
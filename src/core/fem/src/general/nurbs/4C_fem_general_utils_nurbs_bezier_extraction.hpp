@@ -0,0 +1,217 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_FEM_GENERAL_UTILS_NURBS_BEZIER_EXTRACTION_HPP
+#define FOUR_C_FEM_GENERAL_UTILS_NURBS_BEZIER_EXTRACTION_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_fem_general_cell_type_traits.hpp"
+#include "4C_fem_general_utils_local_connectivity_matrices.hpp"
+#include "4C_linalg_serialdensematrix.hpp"
+#include "4C_linalg_serialdensevector.hpp"
+
+#include <array>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Core::FE::Nurbs
+{
+  /*!
+  \brief Bezier extraction operators of a nurbs element
+
+  Restricted to one element, the bsplines which are nonzero in this element are polynomials
+  of the element degree. Hence, they are linear combinations of the Bernstein polynomials on
+  the reference interval [-1,1]
+
+  \verbatim
+
+               +----+
+                \
+     N_{i}(u) =  +    C_{ij} * B_{j}(u)
+                /
+               +----+
+                 j
+
+  \endverbatim
+
+  The operator C only depends on the local knot span of the element. It is stored for each
+  parameter direction separately, the tensor product structure of the basis is exploited
+  during evaluation.
+  */
+  struct BezierExtraction
+  {
+    //! extraction operator C of each parameter direction, size (degree+1) x (degree+1)
+    std::vector<Core::LinAlg::SerialDenseMatrix> operators;
+  };
+
+  /*!
+  \brief Compute the extraction operator of one parameter direction
+
+  \param eleknots (i) local knot span of the element (2*degree+2 knots)
+  \param degree   (i) degree of the bspline polynomials
+
+  \return extraction operator, row i holds the Bernstein coefficients of bspline i
+  */
+  Core::LinAlg::SerialDenseMatrix bezier_extraction_operator(
+      const Core::LinAlg::SerialDenseVector& eleknots, int degree);
+
+  /*!
+  \brief Compute the extraction operators of all parameter directions of an element
+
+  \param eleknots (i) local knot spans of the element as returned by Knotvector::get_ele_knots
+  */
+  BezierExtraction bezier_extraction(const std::vector<Core::LinAlg::SerialDenseVector>& eleknots);
+
+  /*!
+  \brief Evaluate the Bernstein polynomials and their first derivatives on [-1,1]
+
+  The polynomials of degree p-1 are built with the recursion
+
+  \verbatim
+     B^{k}_{j} = (1-t) * B^{k-1}_{j} + t * B^{k-1}_{j-1},   t = (u+1)/2
+  \endverbatim
+
+  and give the derivatives dB^{p}_{j}/du = p/2 * (B^{p-1}_{j-1} - B^{p-1}_{j}) before the last
+  step of the recursion.
+  */
+  template <int degree>
+  void bernstein_polynomials_and_derivs(const double u, std::array<double, degree + 1>& values,
+      std::array<double, degree + 1>& derivs)
+  {
+    const double t = 0.5 * (u + 1.0);
+
+    values.fill(0.0);
+    values[0] = 1.0;
+    for (int k = 1; k < degree; ++k)
+    {
+      for (int j = k; j > 0; --j) values[j] = (1.0 - t) * values[j] + t * values[j - 1];
+      values[0] *= (1.0 - t);
+    }
+
+    for (int j = 0; j <= degree; ++j)
+    {
+      const double left = j > 0 ? values[j - 1] : 0.0;
+      const double right = j < degree ? values[j] : 0.0;
+      derivs[j] = 0.5 * degree * (left - right);
+    }
+
+    if constexpr (degree > 0)
+    {
+      for (int j = degree; j > 0; --j) values[j] = (1.0 - t) * values[j] + t * values[j - 1];
+      values[0] *= (1.0 - t);
+    }
+  }
+
+  /*!
+  \brief Evaluate nurbs basis functions and first derivatives using precomputed Bezier
+         extraction operators
+
+  This is equivalent to nurbs_get_funct_deriv with the element knot vector, but replaces
+  the bspline recursion by the evaluation of the Bernstein polynomials and a small dense
+  product with the extraction operator of each direction. The derivatives are computed with
+  respect to the reference coordinates uv in [-1,1]^dim.
+
+  \param nurbs_shape_funct  (o) nurbs basis functions
+  \param nurbs_shape_deriv  (o) first derivatives of the nurbs basis functions
+  \param uv                 (i) point in the reference element
+  \param extraction         (i) Bezier extraction operators of the element
+  \param weights            (i) weights of the control points of the element
+
+  \return TRUE if successful
+  */
+  template <Core::FE::CellType distype, class VF, class MD, class UV, class WG>
+  bool nurbs_get_funct_deriv(VF& nurbs_shape_funct, MD& nurbs_shape_deriv, const UV& uv,
+      const BezierExtraction& extraction, const WG& weights)
+  {
+    static_assert(Core::FE::is_nurbs<distype>, "Bezier extraction requires a nurbs cell type");
+
+    constexpr int degree = Core::FE::DisTypeToDegree<distype>::degree;
+    constexpr int dim = Core::FE::dim<distype>;
+    constexpr int size = Core::FE::num_nodes<distype>;
+    constexpr int num_bsplines = degree + 1;
+
+    // ---------------------------------------------------
+    //  PART I: BSPLINES OF EACH DIRECTION FROM BERNSTEIN
+    // ---------------------------------------------------
+    std::array<std::array<double, num_bsplines>, dim> bspline_value;
+    std::array<std::array<double, num_bsplines>, dim> bspline_deriv;
+    for (int dir = 0; dir < dim; ++dir)
+    {
+      std::array<double, num_bsplines> bernstein_value;
+      std::array<double, num_bsplines> bernstein_deriv;
+      bernstein_polynomials_and_derivs<degree>(uv(dir), bernstein_value, bernstein_deriv);
+
+      const Core::LinAlg::SerialDenseMatrix& C = extraction.operators[dir];
+      for (int i = 0; i < num_bsplines; ++i)
+      {
+        double value = 0.0;
+        double deriv = 0.0;
+        for (int j = 0; j < num_bsplines; ++j)
+        {
+          value += C(i, j) * bernstein_value[j];
+          deriv += C(i, j) * bernstein_deriv[j];
+        }
+        bspline_value[dir][i] = value;
+        bspline_deriv[dir][i] = deriv;
+      }
+    }
+
+    // ---------------------------------------------------
+    //  PART II: WEIGHTED TENSOR PRODUCT BASIS FUNCTIONS
+    // ---------------------------------------------------
+    double sum_funct_weight = 0.0;
+    std::array<double, dim> sum_deriv_weight;
+    sum_deriv_weight.fill(0.0);
+
+    for (int id = 0; id < size; ++id)
+    {
+      // same numbering as in nurbs_get_3d_funct_deriv: id = rr + (degree+1)*(mm + nn*(degree+1))
+      std::array<int, dim> index;
+      for (int dir = 0, stride = 1; dir < dim; ++dir, stride *= num_bsplines)
+        index[dir] = (id / stride) % num_bsplines;
+
+      double value = weights(id);
+      for (int dir = 0; dir < dim; ++dir) value *= bspline_value[dir][index[dir]];
+      nurbs_shape_funct(id) = value;
+      sum_funct_weight += value;
+
+      for (int mm = 0; mm < dim; ++mm)
+      {
+        double deriv = weights(id);
+        for (int dir = 0; dir < dim; ++dir)
+          deriv *= (dir == mm) ? bspline_deriv[dir][index[dir]] : bspline_value[dir][index[dir]];
+        nurbs_shape_deriv(mm, id) = deriv;
+        sum_deriv_weight[mm] += deriv;
+      }
+    }
+
+    if (sum_funct_weight == 0.0) return false;
+
+    // ---------------------------------------------------
+    //  PART III: PROJECTING TO NURBS SHAPE FUNCTIONS
+    // ---------------------------------------------------
+    for (int id = 0; id < size; ++id)
+    {
+      nurbs_shape_funct(id) /= sum_funct_weight;
+
+      for (int mm = 0; mm < dim; ++mm)
+      {
+        nurbs_shape_deriv(mm, id) =
+            (nurbs_shape_deriv(mm, id) - nurbs_shape_funct(id) * sum_deriv_weight[mm]) /
+            sum_funct_weight;
+      }
+    }
+
+    return true;
+  }
+}  // namespace Core::FE::Nurbs
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
@@ -20,88 +20,259 @@
 
 FOUR_C_NAMESPACE_OPEN
 
-/*----------------------------------------------------------------------------*
- *----------------------------------------------------------------------------*/
-std::shared_ptr<Core::LinAlg::MultiVector<double>> Core::FE::evaluate_and_solve_nodal_l2_projection(
-    Core::FE::Discretization& dis, const Epetra_Map& noderowmap, const std::string& statename,
-    const int& numvec, Teuchos::ParameterList& params, const Teuchos::ParameterList& solverparams,
-    const std::function<const Teuchos::ParameterList&(int)> get_solver_params,
-    const Epetra_Map& fullnoderowmap, const std::map<int, int>& slavetomastercolnodesmap)
+namespace
 {
-  // create empty matrix
-  Core::LinAlg::SparseMatrix massmatrix(noderowmap, 108, false, true);
-  // create empty right hand side
-  Core::LinAlg::MultiVector<double> rhs(noderowmap, numvec);
+  /*--------------------------------------------------------------------------*
+   * build inverse map from pbc slave to master nodes
+   *--------------------------------------------------------------------------*/
+  std::map<int, int> build_slave_to_master_col_nodes_map(Core::FE::Discretization& dis)
+  {
+    std::map<int, int> slavetomastercolnodesmap;
+
+    std::map<int, std::vector<int>>* allcoupledcolnodes = dis.get_all_pbc_coupled_col_nodes();
+    if (allcoupledcolnodes)
+    {
+      for (auto [master_gid, slave_gids] : *allcoupledcolnodes)
+      {
+        for (const auto slave_gid : slave_gids)
+        {
+          slavetomastercolnodesmap[slave_gid] = master_gid;
+        }
+      }
+    }
 
-  std::vector<int> lm;
-  std::vector<int> lmowner;
-  std::vector<int> lmstride;
-  Core::Elements::LocationArray la(dis.num_dof_sets());
+    return slavetomastercolnodesmap;
+  }
 
-  // define element matrices and vectors
-  Core::LinAlg::SerialDenseMatrix elematrix1;
-  Core::LinAlg::SerialDenseMatrix elematrix2;
-  Core::LinAlg::SerialDenseVector elevector1;
-  Core::LinAlg::SerialDenseVector elevector2;
-  Core::LinAlg::SerialDenseVector elevector3;
+  /*--------------------------------------------------------------------------*
+   * node row map which does not include pbc slave nodes
+   *--------------------------------------------------------------------------*/
+  std::shared_ptr<Epetra_Map> build_reduced_node_row_map(
+      const Epetra_Map& fullnoderowmap, const std::map<int, int>& slavetomastercolnodesmap)
+  {
+    std::vector<int> reducednoderowmap;
+    // a little more memory than necessary is possibly reserved here
+    reducednoderowmap.reserve(fullnoderowmap.NumMyElements());
+    for (int i = 0; i < fullnoderowmap.NumMyElements(); ++i)
+    {
+      const int nodeid = fullnoderowmap.GID(i);
+      // do not add slave pbc nodes here
+      if (slavetomastercolnodesmap.empty() or slavetomastercolnodesmap.count(nodeid) == 0)
+      {
+        reducednoderowmap.push_back(nodeid);
+      }
+    }
 
-  // loop column elements
+    return std::make_shared<Epetra_Map>(-1, static_cast<int>(reducednoderowmap.size()),
+        reducednoderowmap.data(), 0, fullnoderowmap.Comm());
+  }
 
-  for (auto* actele : dis.my_col_element_range())
+  /*--------------------------------------------------------------------------*
+   * assemble the right hand sides and (if requested) the mass matrix
+   *--------------------------------------------------------------------------*/
+  void assemble_nodal_l2_projection(Core::FE::Discretization& dis, Teuchos::ParameterList& params,
+      const int numvec, const std::map<int, int>& slavetomastercolnodesmap,
+      Core::LinAlg::SparseMatrix* massmatrix, Core::LinAlg::MultiVector<double>& rhs)
   {
-    const int numnode = actele->num_node();
+    std::vector<int> lm;
+    std::vector<int> lmowner;
+    std::vector<int> lmstride;
+    Core::Elements::LocationArray la(dis.num_dof_sets());
 
-    actele->location_vector(dis, la, false);
-    lmowner = la[0].lmowner_;
-    lmstride = la[0].stride_;
-    lm = la[0].lm_;
+    // define element matrices and vectors
+    Core::LinAlg::SerialDenseMatrix elematrix1;
+    Core::LinAlg::SerialDenseMatrix elematrix2;
+    Core::LinAlg::SerialDenseVector elevector1;
+    Core::LinAlg::SerialDenseVector elevector2;
+    Core::LinAlg::SerialDenseVector elevector3;
 
-    // Reshape element matrices and vectors and initialize to zero
-    elevector1.size(numnode);
-    elematrix1.shape(numnode, numnode);
-    elematrix2.shape(numnode, numvec);
+    // loop column elements
 
-    // call the element specific evaluate method (elemat1 = mass matrix, elemat2 = rhs)
-    int err = actele->evaluate(
-        params, dis, la, elematrix1, elematrix2, elevector1, elevector2, elevector3);
-    if (err) FOUR_C_THROW("Element %d returned err=%d", actele->id(), err);
+    for (auto* actele : dis.my_col_element_range())
+    {
+      const int numnode = actele->num_node();
 
+      actele->location_vector(dis, la, false);
+      lmowner = la[0].lmowner_;
+      lmstride = la[0].stride_;
+      lm = la[0].lm_;
 
-    // get element location vector for nodes
-    lm.resize(numnode);
-    lmowner.resize(numnode);
+      // Reshape element matrices and vectors and initialize to zero
+      elevector1.size(numnode);
+      elematrix1.shape(numnode, numnode);
+      elematrix2.shape(numnode, numvec);
 
-    Core::Nodes::Node** nodes = actele->nodes();
-    for (int n = 0; n < numnode; ++n)
-    {
-      const int nodeid = nodes[n]->id();
-      if (!slavetomastercolnodesmap.empty())
+      // call the element specific evaluate method (elemat1 = mass matrix, elemat2 = rhs)
+      int err = actele->evaluate(
+          params, dis, la, elematrix1, elematrix2, elevector1, elevector2, elevector3);
+      if (err) FOUR_C_THROW("Element %d returned err=%d", actele->id(), err);
+
+
+      // get element location vector for nodes
+      lm.resize(numnode);
+      lmowner.resize(numnode);
+
+      Core::Nodes::Node** nodes = actele->nodes();
+      for (int n = 0; n < numnode; ++n)
       {
-        auto slavemasterpair = slavetomastercolnodesmap.find(nodeid);
-        if (slavemasterpair != slavetomastercolnodesmap.end())
-          lm[n] = slavemasterpair->second;
+        const int nodeid = nodes[n]->id();
+        if (!slavetomastercolnodesmap.empty())
+        {
+          auto slavemasterpair = slavetomastercolnodesmap.find(nodeid);
+          if (slavemasterpair != slavetomastercolnodesmap.end())
+            lm[n] = slavemasterpair->second;
+          else
+            lm[n] = nodeid;
+        }
         else
           lm[n] = nodeid;
+
+        // owner of pbc master and slave nodes are identical
+        lmowner[n] = nodes[n]->owner();
+      }
+
+      // mass matrix assembling into node map
+      if (massmatrix != nullptr) massmatrix->assemble(actele->id(), elematrix1, lm, lmowner);
+
+      // assemble numvec entries sequentially
+      for (int n = 0; n < numvec; ++n)
+      {
+        // copy results into Serial_DenseVector for assembling
+        for (int inode = 0; inode < numnode; ++inode) elevector1(inode) = elematrix2(inode, n);
+        // assemble into nth vector of MultiVector
+        Core::LinAlg::assemble(rhs, n, elevector1, lm, lmowner);
+      }
+    }  // end element loop
+  }
+
+  /*--------------------------------------------------------------------------*
+   * solution vector based on full row map in which the solution of the master
+   * node is inserted into slave nodes
+   *--------------------------------------------------------------------------*/
+  std::shared_ptr<Core::LinAlg::MultiVector<double>> insert_into_full_node_row_map(
+      std::shared_ptr<Core::LinAlg::MultiVector<double>> nodevec, const Epetra_Map& noderowmap,
+      const Epetra_Map& fullnoderowmap, const std::map<int, int>& slavetomastercolnodesmap,
+      const int numvec)
+  {
+    // if no pbc are involved leave here
+    if (slavetomastercolnodesmap.empty() or noderowmap.PointSameAs(fullnoderowmap)) return nodevec;
+
+    auto fullnodevec = std::make_shared<Core::LinAlg::MultiVector<double>>(fullnoderowmap, numvec);
+
+    for (int i = 0; i < fullnoderowmap.NumMyElements(); ++i)
+    {
+      const int nodeid = fullnoderowmap.GID(i);
+
+      auto slavemasterpair = slavetomastercolnodesmap.find(nodeid);
+      if (slavemasterpair != slavetomastercolnodesmap.end())
+      {
+        const int mastergid = slavemasterpair->second;
+        const int masterlid = noderowmap.LID(mastergid);
+        for (int j = 0; j < numvec; ++j)
+          fullnodevec->ReplaceMyValue(i, j, (*nodevec)(j)[masterlid]);
       }
       else
-        lm[n] = nodeid;
+      {
+        const int lid = noderowmap.LID(nodeid);
+        for (int j = 0; j < numvec; ++j) fullnodevec->ReplaceMyValue(i, j, (*nodevec)(j)[lid]);
+      }
+    }
+
+    return fullnodevec;
+  }
 
-      // owner of pbc master and slave nodes are identical
-      lmowner[n] = nodes[n]->owner();
+  /*--------------------------------------------------------------------------*
+   * create the linear solver for the mass matrix system
+   *--------------------------------------------------------------------------*/
+  std::unique_ptr<Core::LinAlg::Solver> create_nodal_l2_projection_solver(
+      const Teuchos::ParameterList& solverparams, MPI_Comm comm,
+      const std::function<const Teuchos::ParameterList&(int)> get_solver_params,
+      const Epetra_Map& noderowmap)
+  {
+    // get solver parameter list of linear solver
+    const auto solvertype =
+        Teuchos::getIntegralValue<Core::LinearSolver::SolverType>(solverparams, "SOLVER");
+
+    auto solver = std::make_unique<Core::LinAlg::Solver>(
+        solverparams, comm, get_solver_params, Core::IO::Verbositylevel::standard);
+
+    // skip setup of preconditioner in case of a direct solver
+    if (solvertype != Core::LinearSolver::SolverType::umfpack and
+        solvertype != Core::LinearSolver::SolverType::superlu)
+    {
+      const auto prectype =
+          Teuchos::getIntegralValue<Core::LinearSolver::PreconditionerType>(solverparams, "AZPREC");
+      switch (prectype)
+      {
+        case Core::LinearSolver::PreconditionerType::multigrid_muelu:
+        {
+          Teuchos::ParameterList* preclist_ptr = nullptr;
+          // Parameter for MueLu
+          if (prectype == Core::LinearSolver::PreconditionerType::multigrid_muelu)
+            preclist_ptr = &((solver->params()).sublist("MueLu Parameters"));
+          else
+            FOUR_C_THROW("please add correct parameter list");
+
+          Teuchos::ParameterList& preclist = *preclist_ptr;
+          preclist.set("PDE equations", 1);
+          preclist.set("null space: dimension", 1);
+          preclist.set("null space: type", "pre-computed");
+          preclist.set("null space: add default vectors", false);
+
+          std::shared_ptr<Core::LinAlg::MultiVector<double>> nullspace =
+              std::make_shared<Core::LinAlg::MultiVector<double>>(noderowmap, 1, true);
+          nullspace->PutScalar(1.0);
+
+          preclist.set<std::shared_ptr<Core::LinAlg::MultiVector<double>>>("nullspace", nullspace);
+          preclist.set("null space: vectors", nullspace->Values());
+          preclist.set("ML validate parameter list", false);
+        }
+        break;
+        case Core::LinearSolver::PreconditionerType::ilu:
+          // do nothing
+          break;
+        default:
+          FOUR_C_THROW("You have to choose ML, MueLu or ILU preconditioning");
+          break;
+      }
     }
 
-    // mass matrix assembling into node map
-    massmatrix.assemble(actele->id(), elematrix1, lm, lmowner);
+    return solver;
+  }
 
-    // assemble numvec entries sequentially
-    for (int n = 0; n < numvec; ++n)
+  /*--------------------------------------------------------------------------*
+   *--------------------------------------------------------------------------*/
+  void check_nodal_l2_projection_input(Core::FE::Discretization& dis, const std::string& statename,
+      const Teuchos::ParameterList& params)
+  {
+    // check if the statename has been set
+    if (!dis.has_state(statename))
     {
-      // copy results into Serial_DenseVector for assembling
-      for (int inode = 0; inode < numnode; ++inode) elevector1(inode) = elematrix2(inode, n);
-      // assemble into nth vector of MultiVector
-      Core::LinAlg::assemble(rhs, n, elevector1, lm, lmowner);
+      FOUR_C_THROW(
+          "The discretization does not know about this statename. Please "
+          "review how you call this function.");
     }
-  }  // end element loop
+
+    // check whether action type is set
+    if (params.getEntryRCP("action") == Teuchos::null)
+      FOUR_C_THROW("action type for element is missing");
+  }
+}  // namespace
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+std::shared_ptr<Core::LinAlg::MultiVector<double>> Core::FE::evaluate_and_solve_nodal_l2_projection(
+    Core::FE::Discretization& dis, const Epetra_Map& noderowmap, const std::string& statename,
+    const int& numvec, Teuchos::ParameterList& params, const Teuchos::ParameterList& solverparams,
+    const std::function<const Teuchos::ParameterList&(int)> get_solver_params,
+    const Epetra_Map& fullnoderowmap, const std::map<int, int>& slavetomastercolnodesmap)
+{
+  // create empty matrix
+  Core::LinAlg::SparseMatrix massmatrix(noderowmap, 108, false, true);
+  // create empty right hand side
+  Core::LinAlg::MultiVector<double> rhs(noderowmap, numvec);
+
+  assemble_nodal_l2_projection(dis, params, numvec, slavetomastercolnodesmap, &massmatrix, rhs);
 
   // finalize the matrix
   massmatrix.complete();
@@ -117,83 +288,21 @@ std::shared_ptr<Core::LinAlg::MultiVector<double>> Core::FE::compute_nodal_l2_pr
     Teuchos::ParameterList& params, const Teuchos::ParameterList& solverparams,
     const std::function<const Teuchos::ParameterList&(int)> get_solver_params)
 {
-  // check if the statename has been set
-  if (!dis.has_state(statename))
-  {
-    FOUR_C_THROW(
-        "The discretization does not know about this statename. Please "
-        "review how you call this function.");
-  }
-
-  // check whether action type is set
-  if (params.getEntryRCP("action") == Teuchos::null)
-    FOUR_C_THROW("action type for element is missing");
+  check_nodal_l2_projection_input(dis, statename, params);
 
   // handle pbcs if existing
-  // build inverse map from slave to master nodes
-  std::map<int, int> slavetomastercolnodesmap;
-
-  std::map<int, std::vector<int>>* allcoupledcolnodes = dis.get_all_pbc_coupled_col_nodes();
-  if (allcoupledcolnodes)
-  {
-    for (auto [master_gid, slave_gids] : *allcoupledcolnodes)
-    {
-      for (const auto slave_gid : slave_gids)
-      {
-        slavetomastercolnodesmap[slave_gid] = master_gid;
-      }
-    }
-  }
+  const std::map<int, int> slavetomastercolnodesmap = build_slave_to_master_col_nodes_map(dis);
 
   // get reduced node row map of fluid field --> will be used for setting up linear system
   const auto* fullnoderowmap = dis.node_row_map();
-  // remove pbc slave nodes from full noderowmap
-  std::vector<int> reducednoderowmap;
-  // a little more memory than necessary is possibly reserved here
-  reducednoderowmap.reserve(fullnoderowmap->NumMyElements());
-  for (int i = 0; i < fullnoderowmap->NumMyElements(); ++i)
-  {
-    const int nodeid = fullnoderowmap->GID(i);
-    // do not add slave pbc nodes here
-    if (slavetomastercolnodesmap.empty() or slavetomastercolnodesmap.count(nodeid) == 0)
-    {
-      reducednoderowmap.push_back(nodeid);
-    }
-  }
-
-  // build node row map which does not include slave pbc nodes
-  Epetra_Map noderowmap(-1, static_cast<int>(reducednoderowmap.size()), reducednoderowmap.data(), 0,
-      fullnoderowmap->Comm());
+  std::shared_ptr<Epetra_Map> noderowmap =
+      build_reduced_node_row_map(*fullnoderowmap, slavetomastercolnodesmap);
 
-  auto nodevec = evaluate_and_solve_nodal_l2_projection(dis, noderowmap, statename, numvec, params,
+  auto nodevec = evaluate_and_solve_nodal_l2_projection(dis, *noderowmap, statename, numvec, params,
       solverparams, get_solver_params, *fullnoderowmap, slavetomastercolnodesmap);
 
-  // if no pbc are involved leave here
-  if (slavetomastercolnodesmap.empty() or noderowmap.PointSameAs(*fullnoderowmap)) return nodevec;
-
-  // solution vector based on full row map in which the solution of the master node is inserted into
-  // slave nodes
-  auto fullnodevec = std::make_shared<Core::LinAlg::MultiVector<double>>(*fullnoderowmap, numvec);
-
-  for (int i = 0; i < fullnoderowmap->NumMyElements(); ++i)
-  {
-    const int nodeid = fullnoderowmap->GID(i);
-
-    auto slavemasterpair = slavetomastercolnodesmap.find(nodeid);
-    if (slavemasterpair != slavetomastercolnodesmap.end())
-    {
-      const int mastergid = slavemasterpair->second;
-      const int masterlid = noderowmap.LID(mastergid);
-      for (int j = 0; j < numvec; ++j) fullnodevec->ReplaceMyValue(i, j, (*nodevec)(j)[masterlid]);
-    }
-    else
-    {
-      const int lid = noderowmap.LID(nodeid);
-      for (int j = 0; j < numvec; ++j) fullnodevec->ReplaceMyValue(i, j, (*nodevec)(j)[lid]);
-    }
-  }
-
-  return fullnodevec;
+  return insert_into_full_node_row_map(
+      nodevec, *noderowmap, *fullnoderowmap, slavetomastercolnodesmap, numvec);
 }
 
 /*----------------------------------------------------------------------------*
@@ -205,53 +314,11 @@ std::shared_ptr<Core::LinAlg::MultiVector<double>> Core::FE::solve_nodal_l2_proj
     const Epetra_Map& noderowmap, const Epetra_Map& fullnoderowmap,
     const std::map<int, int>& slavetomastercolnodesmap)
 {
-  // get solver parameter list of linear solver
   const auto solvertype =
       Teuchos::getIntegralValue<Core::LinearSolver::SolverType>(solverparams, "SOLVER");
 
-  Core::LinAlg::Solver solver(
-      solverparams, comm, get_solver_params, Core::IO::Verbositylevel::standard);
-
-  // skip setup of preconditioner in case of a direct solver
-  if (solvertype != Core::LinearSolver::SolverType::umfpack and
-      solvertype != Core::LinearSolver::SolverType::superlu)
-  {
-    const auto prectype =
-        Teuchos::getIntegralValue<Core::LinearSolver::PreconditionerType>(solverparams, "AZPREC");
-    switch (prectype)
-    {
-      case Core::LinearSolver::PreconditionerType::multigrid_muelu:
-      {
-        Teuchos::ParameterList* preclist_ptr = nullptr;
-        // Parameter for MueLu
-        if (prectype == Core::LinearSolver::PreconditionerType::multigrid_muelu)
-          preclist_ptr = &((solver.params()).sublist("MueLu Parameters"));
-        else
-          FOUR_C_THROW("please add correct parameter list");
-
-        Teuchos::ParameterList& preclist = *preclist_ptr;
-        preclist.set("PDE equations", 1);
-        preclist.set("null space: dimension", 1);
-        preclist.set("null space: type", "pre-computed");
-        preclist.set("null space: add default vectors", false);
-
-        std::shared_ptr<Core::LinAlg::MultiVector<double>> nullspace =
-            std::make_shared<Core::LinAlg::MultiVector<double>>(noderowmap, 1, true);
-        nullspace->PutScalar(1.0);
-
-        preclist.set<std::shared_ptr<Core::LinAlg::MultiVector<double>>>("nullspace", nullspace);
-        preclist.set("null space: vectors", nullspace->Values());
-        preclist.set("ML validate parameter list", false);
-      }
-      break;
-      case Core::LinearSolver::PreconditionerType::ilu:
-        // do nothing
-        break;
-      default:
-        FOUR_C_THROW("You have to choose ML, MueLu or ILU preconditioning");
-        break;
-    }
-  }
+  std::unique_ptr<Core::LinAlg::Solver> solver =
+      create_nodal_l2_projection_solver(solverparams, comm, get_solver_params, noderowmap);
 
   // solution vector based on reduced node row map
   auto nodevec = std::make_shared<Core::LinAlg::MultiVector<double>>(noderowmap, numvec);
@@ -264,7 +331,7 @@ std::shared_ptr<Core::LinAlg::MultiVector<double>> Core::FE::solve_nodal_l2_proj
       Core::LinAlg::SolverParams solver_params;
       solver_params.refactor = true;
       solver_params.reset = true;
-      solver.solve_with_multi_vector(massmatrix.epetra_operator(), nodevec,
+      solver->solve_with_multi_vector(massmatrix.epetra_operator(), nodevec,
           Core::Utils::shared_ptr_from_ref(rhs), solver_params);
       break;
     }
@@ -282,7 +349,7 @@ std::shared_ptr<Core::LinAlg::MultiVector<double>> Core::FE::solve_nodal_l2_proj
         Core::LinAlg::SolverParams solver_params;
         solver_params.refactor = true;
         solver_params.reset = true;
-        solver.solve_with_multi_vector(massmatrix.epetra_operator(),
+        solver->solve_with_multi_vector(massmatrix.epetra_operator(),
             (*nodevec)(i).get_ptr_of_MultiVector(), rhs(i).get_ptr_of_MultiVector(), solver_params);
       }
       break;
@@ -292,4 +359,130 @@ std::shared_ptr<Core::LinAlg::MultiVector<double>> Core::FE::solve_nodal_l2_proj
   return nodevec;
 }
 
-FOUR_C_NAMESPACE_CLOSE
\ No newline at end of file
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+Core::FE::NodalL2Projection::NodalL2Projection(const Teuchos::ParameterList& solverparams,
+    std::function<const Teuchos::ParameterList&(int)> get_solver_params, MassMatrix mass_matrix)
+    : solverparams_(solverparams),
+      get_solver_params_(std::move(get_solver_params)),
+      mass_matrix_(mass_matrix)
+{
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+Core::FE::NodalL2Projection::~NodalL2Projection() = default;
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void Core::FE::NodalL2Projection::reset()
+{
+  fullnoderowmap_ = nullptr;
+  elecolmap_ = nullptr;
+  noderowmap_ = nullptr;
+  slavetomastercolnodesmap_.clear();
+  massmatrix_ = nullptr;
+  solver_ = nullptr;
+  numvec_ = 0;
+  lumpedmass_ = nullptr;
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+bool Core::FE::NodalL2Projection::is_setup(const Core::FE::Discretization& dis) const
+{
+  if (fullnoderowmap_ == nullptr) return false;
+
+  return dis.node_row_map()->SameAs(*fullnoderowmap_) and
+         dis.element_col_map()->SameAs(*elecolmap_);
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+void Core::FE::NodalL2Projection::setup(Core::FE::Discretization& dis)
+{
+  reset();
+
+  fullnoderowmap_ = std::make_shared<Epetra_Map>(*dis.node_row_map());
+  elecolmap_ = std::make_shared<Epetra_Map>(*dis.element_col_map());
+
+  slavetomastercolnodesmap_ = build_slave_to_master_col_nodes_map(dis);
+  noderowmap_ = build_reduced_node_row_map(*fullnoderowmap_, slavetomastercolnodesmap_);
+}
+
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+std::shared_ptr<Core::LinAlg::MultiVector<double>> Core::FE::NodalL2Projection::project(
+    Core::FE::Discretization& dis, const std::string& statename, const int numvec,
+    Teuchos::ParameterList& params)
+{
+  check_nodal_l2_projection_input(dis, statename, params);
+
+  if (not is_setup(dis)) setup(dis);
+
+  // the mass matrix is only assembled at the first projection of a mesh configuration
+  const bool assemble_mass = (mass_matrix_ == MassMatrix::consistent) ? massmatrix_ == nullptr
+                                                                      : lumpedmass_ == nullptr;
+  std::shared_ptr<Core::LinAlg::SparseMatrix> massmatrix =
+      assemble_mass ? std::make_shared<Core::LinAlg::SparseMatrix>(*noderowmap_, 108, false, true)
+                    : nullptr;
+  auto rhs = std::make_shared<Core::LinAlg::MultiVector<double>>(*noderowmap_, numvec);
+
+  assemble_nodal_l2_projection(
+      dis, params, numvec, slavetomastercolnodesmap_, massmatrix.get(), *rhs);
+
+  if (massmatrix != nullptr) massmatrix->complete();
+
+  // solution vector based on reduced node row map
+  auto nodevec = std::make_shared<Core::LinAlg::MultiVector<double>>(*noderowmap_, numvec);
+
+  switch (mass_matrix_)
+  {
+    case MassMatrix::consistent:
+    {
+      if (assemble_mass) massmatrix_ = massmatrix;
+      if (solver_ == nullptr)
+      {
+        solver_ = create_nodal_l2_projection_solver(
+            solverparams_, dis.get_comm(), get_solver_params_, *noderowmap_);
+      }
+
+      // the factorization or preconditioner is reused as long as the matrix does not change
+      Core::LinAlg::SolverParams solver_params;
+      solver_params.refactor = assemble_mass or numvec != numvec_;
+      solver_params.reset = solver_params.refactor;
+      solver_->solve_with_multi_vector(massmatrix_->epetra_operator(), nodevec, rhs, solver_params);
+      numvec_ = numvec;
+      break;
+    }
+    case MassMatrix::lumped:
+    {
+      if (assemble_mass)
+      {
+        Core::LinAlg::Vector<double> ones(*noderowmap_, false);
+        ones.PutScalar(1.0);
+        lumpedmass_ = std::make_shared<Core::LinAlg::Vector<double>>(*noderowmap_, true);
+        massmatrix->multiply(false, ones, *lumpedmass_);
+
+        double minmass;
+        lumpedmass_->MinValue(&minmass);
+        if (minmass <= 0.0)
+        {
+          FOUR_C_THROW(
+              "Lumped mass matrix of the L2 projection is not positive (min %e). Use the "
+              "consistent mass matrix for this discretization.",
+              minmass);
+        }
+      }
+
+      for (int i = 0; i < numvec; ++i)
+        (*nodevec)(i).ReciprocalMultiply(1.0, *lumpedmass_, (*rhs)(i), 0.0);
+      break;
+    }
+  }
+
+  return insert_into_full_node_row_map(
+      nodevec, *noderowmap_, *fullnoderowmap_, slavetomastercolnodesmap_, numvec);
+}
+
+FOUR_C_NAMESPACE_CLOSE
@@ -11,7 +11,7 @@
 #include "4C_config.hpp"
 
 #include "4C_linalg_multi_vector.hpp"
-#include "4C_utils_parameter_list.fwd.hpp"
+#include "4C_utils_parameter_list.hpp"
 
 #include <functional>
 #include <map>
@@ -22,7 +22,10 @@ FOUR_C_NAMESPACE_OPEN
 // forward declarations
 namespace Core::LinAlg
 {
+  class Solver;
   class SparseMatrix;
+  template <typename T>
+  class Vector;
 }
 
 namespace Core::FE
@@ -67,6 +70,83 @@ namespace Core::FE
       const Epetra_Map& noderowmap, const Epetra_Map& fullnoderowmap,
       const std::map<int, int>& slavetomastercolnodesmap);
 
+  /*!
+    \brief Reusable L2 projection of element based quantities onto the nodes
+
+    In contrast to compute_nodal_l2_projection(), the mass matrix is only assembled once per mesh
+    configuration. With the consistent mass matrix, the factorization (direct solver) or the
+    preconditioner (iterative solver) is computed at the first projection and reused for all
+    subsequent projections. With the lumped mass matrix (row sums), no global system has to be
+    solved at all. All numvec quantities are solved as one multi-vector right hand side.
+
+    The mesh configuration is identified by the node row map and the element column map of the
+    discretization. If the mass matrix changes otherwise, e.g. due to a moving mesh, reset() has to
+    be called before the next projection.
+   */
+  class NodalL2Projection
+  {
+   public:
+    //! type of the mass matrix of the projection
+    enum class MassMatrix
+    {
+      consistent,  ///< consistent mass matrix, solved with the given linear solver
+      lumped       ///< row sum lumped mass matrix, no linear solver involved
+    };
+
+    NodalL2Projection(const Teuchos::ParameterList& solverparams,
+        std::function<const Teuchos::ParameterList&(int)> get_solver_params,
+        MassMatrix mass_matrix = MassMatrix::consistent);
+
+    ~NodalL2Projection();
+
+    /*!
+      \brief project the element quantities evaluated with the element action in params onto the
+      nodes
+
+      \return an Core::LinAlg::MultiVector<double> based on the discret's node row map containing
+      numvec vectors with the projected state
+     */
+    std::shared_ptr<Core::LinAlg::MultiVector<double>> project(Core::FE::Discretization& dis,
+        const std::string& statename, int numvec, Teuchos::ParameterList& params);
+
+    //! forget the mass matrix and its factorization
+    void reset();
+
+   private:
+    //! set up the maps for the current mesh configuration of the discretization
+    void setup(Core::FE::Discretization& dis);
+
+    //! check whether the setup belongs to the current mesh configuration of the discretization
+    [[nodiscard]] bool is_setup(const Core::FE::Discretization& dis) const;
+
+    //! solver parameters for the consistent mass matrix
+    const Teuchos::ParameterList solverparams_;
+
+    //! function that returns the solver parameters for the i-th solver
+    const std::function<const Teuchos::ParameterList&(int)> get_solver_params_;
+
+    //! type of the mass matrix
+    const MassMatrix mass_matrix_;
+
+    //! node row map and element column map of the mesh configuration
+    std::shared_ptr<Epetra_Map> fullnoderowmap_;
+    std::shared_ptr<Epetra_Map> elecolmap_;
+
+    //! node row map without pbc slave nodes and map from pbc slave to master column nodes
+    std::shared_ptr<Epetra_Map> noderowmap_;
+    std::map<int, int> slavetomastercolnodesmap_;
+
+    //! consistent mass matrix and the solver holding its factorization or preconditioner
+    std::shared_ptr<Core::LinAlg::SparseMatrix> massmatrix_;
+    std::unique_ptr<Core::LinAlg::Solver> solver_;
+
+    //! number of vectors of the last solve
+    int numvec_ = 0;
+
+    //! lumped mass matrix
+    std::shared_ptr<Core::LinAlg::Vector<double>> lumpedmass_;
+  };
+
 }  // namespace Core::FE
 
 
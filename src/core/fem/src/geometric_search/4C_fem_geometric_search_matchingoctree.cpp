@@ -7,14 +7,86 @@
 
 #include "4C_fem_geometric_search_matchingoctree.hpp"
 
-#include "4C_comm_exporter.hpp"
 #include "4C_comm_mpi_utils.hpp"
+#include "4C_comm_pack_helpers.hpp"
+#include "4C_comm_utils_factory.hpp"
 #include "4C_fem_discretization.hpp"
 #include "4C_fem_general_element.hpp"
 #include "4C_fem_general_node.hpp"
 
 FOUR_C_NAMESPACE_OPEN
 
+namespace
+{
+  /*--------------------------------------------------------------------*/
+  /*--------------------------------------------------------------------*/
+  std::vector<double> search_coordinate(const std::vector<double>& pointcoord,
+      const std::vector<int>& dofsforpbcplane, const double rotangle,
+      const std::vector<double>& masterplanecoords)
+  {
+    std::vector<double> x(3);
+
+    if (abs(rotangle) < 1e-13)
+    {
+      for (int dim = 0; dim < 3; dim++)
+      {
+        x[dim] = pointcoord[dim];
+      }
+    }
+    else
+    {
+      // if there is a rotationally symmetric periodic boundary condition:
+      // rotate slave plane for making it parallel to the master plane
+      x[0] = pointcoord[0] * cos(rotangle) + pointcoord[1] * sin(rotangle);
+      x[1] = pointcoord[0] * (-sin(rotangle)) + pointcoord[1] * cos(rotangle);
+      x[2] = pointcoord[2];
+    }
+
+    // Substitute the coordinate normal to the master plane by the
+    // coordinate of the masterplane
+    //
+    //     |                           |
+    //     |                           |
+    //     |      parallel planes      |
+    //     |-------------------------->|
+    //     |                           |
+    //     |                           |
+    //     |                           |
+    //   slave                      master
+    //
+    //
+
+    // get direction for parallel translation
+    if (!dofsforpbcplane.empty())
+    {
+      int dir = -1;
+
+      for (int dim = 0; dim < 3; dim++)
+      {
+        if (dofsforpbcplane[0] == dim || dofsforpbcplane[1] == dim)
+        {
+          // direction dim is in plane
+          continue;
+        }
+        else
+        {
+          dir = dim;
+        }
+      }
+
+      if (dir < 0)
+      {
+        FOUR_C_THROW("Unable to get direction orthogonal to plane");
+      }
+
+      // substitute x value
+      x[dir] = masterplanecoords[dir];
+    }
+
+    return x;
+  }
+}  // namespace
+
 
 /*----------------------------------------------------------------------*/
 /*----------------------------------------------------------------------*/
@@ -101,6 +173,13 @@ int Core::GeometricSearch::MatchingOctree::setup()
       }
     }
 
+    masterboundingbox_.clear();
+    for (int dim = 0; dim < 3; dim++)
+    {
+      masterboundingbox_.push_back(initialboundingbox(dim, 0));
+      masterboundingbox_.push_back(initialboundingbox(dim, 1));
+    }
+
     // create octree root --- initial layer is 0
     // all other layers are generated down here by recursive calls
     int initlayer = 0;
@@ -162,93 +241,34 @@ void Core::GeometricSearch::MatchingOctree::create_global_entity_matching(
   check_is_init();
   check_is_setup();
 
-  int myrank = Core::Communication::my_mpi_rank(discret_->get_comm());
-  int numprocs = Core::Communication::num_mpi_ranks(discret_->get_comm());
-
   // map from global masternodeids to distances to their global slave
   // counterpart
   std::map<int, double> diststom;
 
   // 1) each proc generates a list of his slavenodes
-  // 2) the list is communicated in a round robin pattern to all the
-  //    other procs.
+  // 2) each slave node is sent to all procs whose master bounding box
+  //    contains it
   //
   // 3) the proc checks the package from each proc and calcs the min
   //    distance on each --- the result is kept if distance is smaller
   //    than on the preceding processors
 
   //--------------------------------------------------------------------
-  // -> 1) create a list of slave nodes on this proc. Pack it.
-  std::vector<char> sblockofnodes;
-  std::vector<char> rblockofnodes;
-
-  sblockofnodes.clear();
-  rblockofnodes.clear();
-
-  Core::Communication::PackBuffer pack_data;
-
+  // -> 1) create a list of slave nodes on this proc.
+  std::vector<int> myslavenodeids;
   for (int slavenodeid : slavenodeids)
   {
-    if (check_have_entity(discret_, slavenodeid))
-    {
-      pack_entity(pack_data, discret_, slavenodeid);
-    }
+    if (check_have_entity(discret_, slavenodeid)) myslavenodeids.push_back(slavenodeid);
   }
 
-  swap(sblockofnodes, pack_data());
-
   //--------------------------------------------------------------------
-  // -> 2) round robin loop
-  // create an exporter for point to point communication
-  Core::Communication::Exporter exporter(discret_->get_comm());
+  // -> 2) send the slave nodes to the procs with matching candidates
+  std::vector<std::vector<char>> rblocks = exchange_slave_entities(*discret_, myslavenodeids,
+      [&](const std::vector<double>& pointcoord, const std::vector<double>& masterplanecoords)
+      { return search_coordinate(pointcoord, dofsforpbcplane, rotangle, masterplanecoords); });
 
-  for (int np = 0; np < numprocs; np++)
+  for (const std::vector<char>& rblockofnodes : rblocks)
   {
-    //--------------------------------------------------
-    // Send block to next proc. Receive a block from the last proc
-    if (np > 0)  // in the first step, we keep all nodes on this proc
-    {
-      MPI_Request request;
-      int tag = myrank;
-
-      int frompid = myrank;
-      int topid = (myrank + 1) % numprocs;
-
-      int length = static_cast<int>(sblockofnodes.size());
-
-      exporter.i_send(frompid, topid, sblockofnodes.data(), length, tag, request);
-
-      // make sure that you do not think you received something if
-      // you didn't
-      if (!rblockofnodes.empty())
-      {
-        FOUR_C_THROW("rblockofnodes not empty");
-      }
-
-      rblockofnodes.clear();
-
-      // receive from predecessor
-      frompid = (myrank + numprocs - 1) % numprocs;
-      exporter.receive_any(frompid, tag, rblockofnodes, length);
-
-      if (tag != (myrank + numprocs - 1) % numprocs)
-      {
-        FOUR_C_THROW("received wrong message (ReceiveAny)");
-      }
-
-      exporter.wait(request);
-
-      {
-        // for safety
-        Core::Communication::barrier(exporter.get_comm());
-      }
-    }
-    else
-    {
-      // dummy communication
-      rblockofnodes = sblockofnodes;
-    }
-
     //--------------------------------------------------
     // Unpack block.
     Communication::UnpackBuffer buffer(rblockofnodes);
@@ -272,68 +292,13 @@ void Core::GeometricSearch::MatchingOctree::create_global_entity_matching(
       // proc
       if (!masterplanecoords_.empty())
       {
-        std::array<double, 3> pointcoord;
+        std::vector<double> pointcoord(3);
         calc_point_coordinate(o.get(), pointcoord.data());
 
         // get its coordinates
-        std::vector<double> x(3);
+        const std::vector<double> x =
+            search_coordinate(pointcoord, dofsforpbcplane, rotangle, masterplanecoords_);
 
-        if (abs(rotangle) < 1e-13)
-        {
-          for (int dim = 0; dim < 3; dim++)
-          {
-            x[dim] = pointcoord[dim];
-          }
-        }
-        else
-        {
-          // if there is a rotationally symmetric periodic boundary condition:
-          // rotate slave plane for making it parallel to the master plane
-          x[0] = pointcoord[0] * cos(rotangle) + pointcoord[1] * sin(rotangle);
-          x[1] = pointcoord[0] * (-sin(rotangle)) + pointcoord[1] * cos(rotangle);
-          x[2] = pointcoord[2];
-        }
-
-        // Substitute the coordinate normal to the master plane by the
-        // coordinate of the masterplane
-        //
-        //     |                           |
-        //     |                           |
-        //     |      parallel planes      |
-        //     |-------------------------->|
-        //     |                           |
-        //     |                           |
-        //     |                           |
-        //   slave                      master
-        //
-        //
-
-        // get direction for parallel translation
-        if (!dofsforpbcplane.empty())
-        {
-          int dir = -1;
-
-          for (int dim = 0; dim < 3; dim++)
-          {
-            if (dofsforpbcplane[0] == dim || dofsforpbcplane[1] == dim)
-            {
-              // direction dim is in plane
-              continue;
-            }
-            else
-            {
-              dir = dim;
-            }
-          }
-
-          if (dir < 0)
-          {
-            FOUR_C_THROW("Unable to get direction orthogonal to plane");
-          }
-
-          // substitute x value
-          x[dir] = masterplanecoords_[dir];
-        }
         //--------------------------------------------------------
         // 3) now search for closest master point on this proc
         int idofclosestpoint;
@@ -377,23 +342,7 @@ void Core::GeometricSearch::MatchingOctree::create_global_entity_matching(
 
       }  // end if (masterplanecoords_.empty()!=true)
     }
-
-
-
-    //----------------------------------------------------------------
-    // prepare to send nodes to next proc (keep list).
-
-    // the received nodes will be sent to the next proc
-    sblockofnodes = rblockofnodes;
-
-    // we need a new receive buffer
-    rblockofnodes.clear();
-
-    {
-      // for safety
-      Core::Communication::barrier(exporter.get_comm());
-    }
-  }  // end loop np
+  }
 }  // MatchingOctree::CreateGlobalNodeMatching
 
 /*----------------------------------------------------------------------*/
@@ -411,81 +360,29 @@ void Core::GeometricSearch::MatchingOctree::find_match(const Core::FE::Discretiz
 
   // 1) each proc generates a list of his slavenodes
   //
-  // 2) the list is communicated in a round robin pattern to all the
-  //    other procs.
+  // 2) each slave node is sent to all procs whose master bounding box
+  //    contains it
   //
   // 3) the proc checks the package from each proc and calcs the min
   //    distance on each --- the result is kept if distance is smaller
   //    than on the preceding processors
 
   //--------------------------------------------------------------------
-  // -> 1) create a list of slave nodes on this proc. Pack it.
-  std::vector<char> sblockofnodes;
-  std::vector<char> rblockofnodes;
-
-  Core::Communication::PackBuffer pack_data;
-
+  // -> 1) create a list of slave nodes on this proc.
+  std::vector<int> myslavenodeids;
   for (int slavenodeid : slavenodeids)
   {
-    if (check_have_entity(&slavedis, slavenodeid))
-    {
-      pack_entity(pack_data, &slavedis, slavenodeid);
-    }
+    if (check_have_entity(&slavedis, slavenodeid)) myslavenodeids.push_back(slavenodeid);
   }
 
-  swap(sblockofnodes, pack_data());
-
   //--------------------------------------------------------------------
-  // -> 2) round robin loop
+  // -> 2) send the slave nodes to the procs with matching candidates
+  std::vector<std::vector<char>> rblocks = exchange_slave_entities(slavedis, myslavenodeids,
+      [](const std::vector<double>& pointcoord, const std::vector<double>&)
+      { return pointcoord; });
 
-  // create an exporter for point to point communication
-  // We do all communication with the communicator of the original
-  // discretization.
-  Core::Communication::Exporter exporter(discret_->get_comm());
-
-  for (int np = 0; np < numprocs; np++)
+  for (const std::vector<char>& rblockofnodes : rblocks)
   {
-    //--------------------------------------------------
-    // Send block to next proc. Receive a block from the last proc
-    if (np > 0)  // in the first step, we keep all nodes on this proc
-    {
-      int myrank = Core::Communication::my_mpi_rank(discret_->get_comm());
-      MPI_Request request;
-      int tag = myrank;
-
-      int frompid = myrank;
-      int topid = (myrank + 1) % numprocs;
-
-      int length = static_cast<int>(sblockofnodes.size());
-
-      exporter.i_send(frompid, topid, sblockofnodes.data(), length, tag, request);
-
-      // make sure that you do not think you received something if
-      // you didn't
-      if (not rblockofnodes.empty())
-      {
-        FOUR_C_THROW("rblockofnodes not empty");
-      }
-
-      rblockofnodes.clear();
-
-      // receive from predecessor
-      frompid = (myrank + numprocs - 1) % numprocs;
-      exporter.receive_any(frompid, tag, rblockofnodes, length);
-
-      if (tag != (myrank + numprocs - 1) % numprocs)
-      {
-        FOUR_C_THROW("received wrong message (ReceiveAny)");
-      }
-
-      exporter.wait(request);
-    }
-    else
-    {
-      // no need to communicate
-      swap(rblockofnodes, sblockofnodes);
-    }
-
     //--------------------------------------------------
     // Unpack block.
     Communication::UnpackBuffer buffer(rblockofnodes);
@@ -542,15 +439,6 @@ void Core::GeometricSearch::MatchingOctree::find_match(const Core::FE::Discretiz
         }
       }
     }
-
-    //----------------------------------------------------------------
-    // prepare to send nodes to next proc (keep list).
-
-    // the received nodes will be sent to the next proc
-    swap(sblockofnodes, rblockofnodes);
-
-    // we need a new receive buffer
-    rblockofnodes.clear();
   }
 }  // MatchingOctree::FindMatch
 
@@ -570,75 +458,21 @@ void Core::GeometricSearch::MatchingOctree::fill_slave_to_master_gid_mapping(
 
   // 1) each proc generates a list of his slavenodes
   //
-  // 2) the list is communicated in a round robin pattern to all the
-  //    other procs.
+  // 2) each slave node is sent to all procs whose master bounding box
+  //    contains it
   //
   // 3) the proc checks the package from each proc and calcs the min
   //    distance on each --- the result is kept if distance is smaller
   //    than on the preceding processors
 
   //--------------------------------------------------------------------
-  // -> 1) create a list of slave nodes on this proc. Pack it.
-  std::vector<char> sblockofnodes;
-  std::vector<char> rblockofnodes;
-
-  Core::Communication::PackBuffer pack_data;
+  // -> 1) + 2) send the slave nodes to the procs with matching candidates
+  std::vector<std::vector<char>> rblocks = exchange_slave_entities(slavedis, slavenodeids,
+      [](const std::vector<double>& pointcoord, const std::vector<double>&)
+      { return pointcoord; });
 
-  for (int slavenodeid : slavenodeids) pack_entity(pack_data, &slavedis, slavenodeid);
-
-  swap(sblockofnodes, pack_data());
-
-  //--------------------------------------------------------------------
-  // -> 2) round robin loop
-
-  // create an exporter for point to point communication
-  // We do all communication with the communicator of the original
-  // discretization.
-  Core::Communication::Exporter exporter(discret_->get_comm());
-
-  for (int np = 0; np < numprocs; np++)
+  for (const std::vector<char>& rblockofnodes : rblocks)
   {
-    //--------------------------------------------------
-    // Send block to next proc. Receive a block from the last proc
-    if (np > 0)  // in the first step, we keep all nodes on this proc
-    {
-      int myrank = Core::Communication::my_mpi_rank(discret_->get_comm());
-      MPI_Request request;
-      int tag = myrank;
-
-      int frompid = myrank;
-      int topid = (myrank + 1) % numprocs;
-
-      int length = static_cast<int>(sblockofnodes.size());
-
-      exporter.i_send(frompid, topid, sblockofnodes.data(), length, tag, request);
-
-      // make sure that you do not think you received something if
-      // you didn't
-      if (not rblockofnodes.empty())
-      {
-        FOUR_C_THROW("rblockofnodes not empty");
-      }
-
-      rblockofnodes.clear();
-
-      // receive from predecessor
-      frompid = (myrank + numprocs - 1) % numprocs;
-      exporter.receive_any(frompid, tag, rblockofnodes, length);
-
-      if (tag != (myrank + numprocs - 1) % numprocs)
-      {
-        FOUR_C_THROW("received wrong message (ReceiveAny)");
-      }
-
-      exporter.wait(request);
-    }
-    else
-    {
-      // no need to communicate
-      swap(rblockofnodes, sblockofnodes);
-    }
-
     //--------------------------------------------------
     // Unpack block.
     Communication::UnpackBuffer buffer(rblockofnodes);
@@ -703,17 +537,97 @@ void Core::GeometricSearch::MatchingOctree::fill_slave_to_master_gid_mapping(
         }
       }
     }
+  }
+}  // MatchingOctree::fill_slave_to_master_gid_mapping
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+std::vector<std::vector<char>> Core::GeometricSearch::MatchingOctree::exchange_slave_entities(
+    const Core::FE::Discretization& slavedis, const std::vector<int>& slaveentityids,
+    const std::function<std::vector<double>(const std::vector<double>& pointcoord,
+        const std::vector<double>& masterplanecoords)>& searchcoord)
+{
+  // We do all communication with the communicator of the original
+  // discretization.
+  MPI_Comm comm = discret_->get_comm();
+  const int myrank = Core::Communication::my_mpi_rank(comm);
+  const int numprocs = Core::Communication::num_mpi_ranks(comm);
+
+  // bounding box and master plane coordinates of all procs (empty if no master entities)
+  std::vector<double> mysearchdomain;
+  if (not masterplanecoords_.empty())
+  {
+    mysearchdomain = masterboundingbox_;
+    mysearchdomain.insert(
+        mysearchdomain.end(), masterplanecoords_.begin(), masterplanecoords_.end());
+  }
+  const std::vector<std::vector<double>> searchdomains =
+      Core::Communication::all_gather(mysearchdomain, comm);
+
+  // pack each slave entity for all procs whose bounding box contains it. The criterion is the
+  // same as in search_closest_entity_on_this_proc() on the receiving proc.
+  std::vector<Core::Communication::PackBuffer> pack_data(numprocs);
+  std::vector<double> pointcoord(3);
+  for (const int slaveentityid : slaveentityids)
+  {
+    calc_point_coordinate(&slavedis, slaveentityid, pointcoord.data());
+
+    for (int proc = 0; proc < numprocs; ++proc)
+    {
+      const std::vector<double>& searchdomain = searchdomains[proc];
+      if (searchdomain.empty()) continue;
+
+      const std::vector<double> masterplanecoords(searchdomain.begin() + 6, searchdomain.end());
+      const std::vector<double> x = searchcoord(pointcoord, masterplanecoords);
+
+      bool isinboundingbox = true;
+      for (int dim = 0; dim < 3; ++dim)
+      {
+        if ((x[dim] < searchdomain[2 * dim]) || (x[dim] > searchdomain[2 * dim + 1]))
+          isinboundingbox = false;
+      }
+
+      if (isinboundingbox) pack_entity(pack_data[proc], &slavedis, slaveentityid);
+    }
+  }
 
-    //----------------------------------------------------------------
-    // prepare to send nodes to next proc (keep list).
+  // concatenate the blocks for all procs
+  std::vector<int> sendcounts(numprocs);
+  std::vector<int> sdispls(numprocs + 1, 0);
+  std::vector<char> sendbuf;
+  for (int proc = 0; proc < numprocs; ++proc)
+  {
+    sendcounts[proc] = static_cast<int>(pack_data[proc]().size());
+    sdispls[proc + 1] = sdispls[proc] + sendcounts[proc];
+    sendbuf.insert(sendbuf.end(), pack_data[proc]().begin(), pack_data[proc]().end());
+  }
 
-    // the received nodes will be sent to the next proc
-    swap(sblockofnodes, rblockofnodes);
+  // communicate the sizes of the blocks
+  std::vector<int> recvcounts(numprocs);
+  int status = MPI_Alltoall(sendcounts.data(), 1, MPI_INT, recvcounts.data(), 1, MPI_INT, comm);
+  if (status != MPI_SUCCESS) FOUR_C_THROW("MPI_Alltoall returned status=%d", status);
 
-    // we need a new receive buffer
-    rblockofnodes.clear();
+  std::vector<int> rdispls(numprocs + 1, 0);
+  for (int proc = 0; proc < numprocs; ++proc) rdispls[proc + 1] = rdispls[proc] + recvcounts[proc];
+
+  // communicate the blocks
+  std::vector<char> recvbuf(rdispls.back());
+  status = MPI_Alltoallv(sendbuf.data(), sendcounts.data(), sdispls.data(), MPI_CHAR,
+      recvbuf.data(), recvcounts.data(), rdispls.data(), MPI_CHAR, comm);
+  if (status != MPI_SUCCESS) FOUR_C_THROW("MPI_Alltoallv returned status=%d", status);
+
+  // sort the received blocks in the order of the former round robin loop (own block first, then
+  // the blocks of the predecessors), such that ties in the distance are resolved as before
+  std::vector<std::vector<char>> rblocks(numprocs);
+  for (int np = 0; np < numprocs; ++np)
+  {
+    const int frompid = (myrank + numprocs - np) % numprocs;
+    rblocks[np].assign(
+        recvbuf.begin() + rdispls[frompid], recvbuf.begin() + rdispls[frompid + 1]);
   }
-}  // MatchingOctree::fill_slave_to_master_gid_mapping
+
+  return rblocks;
+}  // MatchingOctree::exchange_slave_entities
 
 
 /*----------------------------------------------------------------------*/
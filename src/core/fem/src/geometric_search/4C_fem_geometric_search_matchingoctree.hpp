@@ -13,6 +13,7 @@
 #include "4C_linalg_serialdensematrix.hpp"
 #include "4C_utils_exceptions.hpp"
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <vector>
@@ -159,8 +160,8 @@ namespace Core::GeometricSearch
 
      1) each proc gets a list of his slave entities (slavenodeids)
 
-     2) the list is communicated in a round robin pattern to all the
-        other procs.
+     2) each slave entity is sent to all procs whose master bounding
+        box contains it (see exchange_slave_entities())
 
      3) the proc checks the package from each proc and calcs the min
         distance on each --- the result is kept if distance is smaller
@@ -198,8 +199,8 @@ namespace Core::GeometricSearch
 
       Internally the search is based on the octtree spanned by the
       master nodes. The slave nodes are gathered on their owning
-      processors and send in a round robin fashion to each processor
-      once.
+      processors and sent to each processor whose master bounding box
+      contains them.
 
       \param slavedis     (i) discretization the slave nodes belong to
       \param slavenodeids (i) gids of nodes to match
@@ -225,6 +226,26 @@ namespace Core::GeometricSearch
 
     //@}
 
+   private:
+    /*! \brief send slave entities to the procs whose master entities might match them
+
+      Each proc gathers the bounding boxes of the master entities of all procs. A slave entity is
+      only sent to the procs whose bounding box contains its search coordinate, since the local
+      search on all other procs fails anyway. Hence, the result is identical to passing all slave
+      entities around all procs, but only a constant number of collective communication steps is
+      needed instead of one step per proc.
+
+      \param slavedis       (i) discretization the slave entities belong to
+      \param slaveentityids (i) gids of the slave entities to send
+      \param searchcoord    (i) search coordinate of a slave entity given its coordinate and the
+                                coordinates of one point in the master plane of the target proc
+
+      \return received blocks of packed entities, in the order of the former round robin loop */
+    std::vector<std::vector<char>> exchange_slave_entities(
+        const Core::FE::Discretization& slavedis, const std::vector<int>& slaveentityids,
+        const std::function<std::vector<double>(const std::vector<double>& pointcoord,
+            const std::vector<double>& masterplanecoords)>& searchcoord);
+
    protected:
     //! \brief all nodes in leaves are nodes of this discretization
     const Core::FE::Discretization* discret_;
@@ -234,6 +255,8 @@ namespace Core::GeometricSearch
     std::shared_ptr<OctreeElement> octreeroot_;
     //! \brief coordinate of one point in the master plane
     std::vector<double> masterplanecoords_;
+    //! \brief bounding box of the local master entities (xmin, xmax, ymin, ymax, zmin, zmax)
+    std::vector<double> masterboundingbox_;
     //! \brief ids of entities to be coupled (e.g. nodes in \ref NodeMatchingOctree )
     const std::vector<int>* masterentityids_;
     //! maximum number of tree nodes per leaf
@@ -7,6 +7,7 @@
 
 #include "4C_fem_nurbs_discretization.hpp"
 
+#include "4C_fem_general_cell_type_traits.hpp"
 #include "4C_fem_general_utils_boundary_integration.hpp"
 #include "4C_fem_general_utils_integration.hpp"
 #include "4C_fem_general_utils_nurbs_shapefunctions.hpp"
@@ -92,6 +93,53 @@ Core::FE::Nurbs::NurbsDiscretization::get_knot_vector() const
   return knots_;
 }
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+int Core::FE::Nurbs::NurbsDiscretization::fill_complete(
+    bool assigndegreesoffreedom, bool initelements, bool doboundaryconditions)
+{
+  const int err = Core::FE::Discretization::fill_complete(
+      assigndegreesoffreedom, initelements, doboundaryconditions);
+
+  build_bezier_extraction();
+
+  return err;
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+const Core::FE::Nurbs::BezierExtraction*
+Core::FE::Nurbs::NurbsDiscretization::get_bezier_extraction(const int gid) const
+{
+  auto extraction = bezier_extraction_.find(gid);
+  if (extraction == bezier_extraction_.end()) return nullptr;
+
+  return &extraction->second;
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::FE::Nurbs::NurbsDiscretization::build_bezier_extraction()
+{
+  bezier_extraction_.clear();
+
+  // the knot vector may be set after the first call to fill_complete()
+  if (knots_ == nullptr or !knots_->filled()) return;
+
+  std::vector<Core::LinAlg::SerialDenseVector> eleknots;
+  for (int lid = 0; lid < num_my_col_elements(); ++lid)
+  {
+    const Core::Elements::Element* ele = l_col_element(lid);
+    if (!Core::FE::is_nurbs_celltype(ele->shape())) continue;
+
+    // zero sized elements are skipped during integration anyway
+    const bool zero_size = knots_->get_ele_knots(eleknots, ele->id());
+    if (zero_size) continue;
+
+    bezier_extraction_.emplace(ele->id(), Core::FE::Nurbs::bezier_extraction(eleknots));
+  }
+}
+
 /*----------------------------------------------------------------------------*
  *----------------------------------------------------------------------------*/
 void Core::FE::Utils::DbcNurbs::evaluate(const Teuchos::ParameterList& params,
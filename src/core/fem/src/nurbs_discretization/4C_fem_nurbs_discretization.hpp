@@ -13,9 +13,12 @@
 #include "4C_fem_discretization.hpp"
 #include "4C_fem_discretization_utils.hpp"
 #include "4C_fem_general_cell_type.hpp"
+#include "4C_fem_general_utils_nurbs_bezier_extraction.hpp"
 #include "4C_fem_nurbs_discretization_control_point.hpp"
 #include "4C_fem_nurbs_discretization_knotvector.hpp"
 
+#include <map>
+
 FOUR_C_NAMESPACE_OPEN
 
 // forward declarations
@@ -79,6 +82,27 @@ namespace Core::FE
       std::shared_ptr<Core::FE::Nurbs::Knotvector> get_knot_vector();
       std::shared_ptr<const Core::FE::Nurbs::Knotvector> get_knot_vector() const;
 
+      /*!
+      \brief Complete construction of the discretization
+
+      Calls fill_complete() of the base class and computes the Bezier extraction operators
+      of all column elements afterwards.
+      */
+      int fill_complete(bool assigndegreesoffreedom = true, bool initelements = true,
+          bool doboundaryconditions = true) override;
+
+      /*!
+      \brief get the Bezier extraction operators of a column element
+
+      The operators are computed once in fill_complete() and allow to evaluate the nurbs basis
+      functions from Bernstein polynomials instead of the bspline recursion.
+
+      \param gid (i) global id of the element
+
+      \return nullptr for zero sized elements or if no operators are available
+      */
+      const BezierExtraction* get_bezier_extraction(int gid) const;
+
       /*!
       \brief return number of knots in each direction
 
@@ -153,6 +177,11 @@ namespace Core::FE
       */
       std::shared_ptr<Core::FE::Nurbs::Knotvector> knots_;
 
+      //! compute the Bezier extraction operators of all column elements
+      void build_bezier_extraction();
+
+      //! Bezier extraction operators of the (non zero sized) column elements
+      std::map<int, BezierExtraction> bezier_extraction_;
     };  // class NurbsDiscretization
   }  // namespace Nurbs
 
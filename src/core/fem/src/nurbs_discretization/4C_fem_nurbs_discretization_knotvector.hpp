@@ -435,6 +435,9 @@ namespace Core::FE
         return (npatch);
       };
 
+      //! indicates whether finish_knots() was called and the knots are ready for access
+      bool filled() const { return filled_; }
+
       /*!
       \brief Return the number of patches
 
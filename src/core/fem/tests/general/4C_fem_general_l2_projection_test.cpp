@@ -0,0 +1,190 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_fem_general_l2_projection.hpp"
+
+#include "4C_fem_discretization.hpp"
+#include "4C_fem_general_element.hpp"
+#include "4C_fem_general_elementtype.hpp"
+#include "4C_fem_general_extract_values.hpp"
+#include "4C_fem_general_node.hpp"
+#include "4C_linear_solver_method.hpp"
+#include "4C_utils_parameter_list.hpp"
+
+#include <array>
+
+namespace
+{
+  using namespace FourC;
+
+  class ProjectionLineType : public Core::Elements::ElementType
+  {
+   public:
+    static ProjectionLineType& instance()
+    {
+      static ProjectionLineType instance;
+      return instance;
+    }
+
+    std::string name() const override { return "ProjectionLineType"; }
+
+    std::shared_ptr<Core::Elements::Element> create(const int id, const int owner) override;
+
+    void nodal_block_information(
+        Core::Elements::Element* dwele, int& numdf, int& dimns, int& nv, int& np) override
+    {
+    }
+
+    Core::LinAlg::SerialDenseMatrix compute_null_space(
+        Core::Nodes::Node& node, const double* x0, const int numdof, const int dimnsp) override
+    {
+      return Core::LinAlg::SerialDenseMatrix();
+    }
+  };
+
+  /*!
+    \brief linear line element with two scalar fields per node
+
+    The element evaluates the consistent mass matrix and the right hand side of the L2 projection
+    of the nodal fields, i.e. the integrals of the shape functions times the interpolated fields.
+   */
+  class ProjectionLine : public Core::Elements::Element
+  {
+   public:
+    static constexpr int numfield = 2;
+
+    ProjectionLine(const int id, const int owner) : Core::Elements::Element(id, owner) {}
+
+    Core::Elements::Element* clone() const override { return new ProjectionLine(*this); }
+
+    int unique_par_object_id() const override
+    {
+      return ProjectionLineType::instance().unique_par_object_id();
+    }
+
+    Core::Elements::ElementType& element_type() const override
+    {
+      return ProjectionLineType::instance();
+    }
+
+    Core::FE::CellType shape() const override { return Core::FE::CellType::line2; }
+
+    int num_dof_per_node(const Core::Nodes::Node& node) const override { return numfield; }
+
+    int num_dof_per_element() const override { return 0; }
+
+    int evaluate(Teuchos::ParameterList& params, Core::FE::Discretization& discretization,
+        Core::Elements::LocationArray& la, Core::LinAlg::SerialDenseMatrix& elemat1,
+        Core::LinAlg::SerialDenseMatrix& elemat2, Core::LinAlg::SerialDenseVector& elevec1,
+        Core::LinAlg::SerialDenseVector& elevec2, Core::LinAlg::SerialDenseVector& elevec3) override
+    {
+      std::vector<double> values(la[0].lm_.size());
+      Core::FE::extract_my_values(*discretization.get_state("phi"), values, la[0].lm_);
+
+      const double h = nodes()[1]->x()[0] - nodes()[0]->x()[0];
+      for (int i = 0; i < 2; ++i)
+      {
+        for (int j = 0; j < 2; ++j)
+        {
+          const double mass = (i == j ? 2.0 : 1.0) * h / 6.0;
+          elemat1(i, j) = mass;
+          for (int k = 0; k < numfield; ++k) elemat2(i, k) += mass * values[j * numfield + k];
+        }
+      }
+
+      return 0;
+    }
+
+    int evaluate_neumann(Teuchos::ParameterList& params, Core::FE::Discretization& discretization,
+        Core::Conditions::Condition& condition, std::vector<int>& lm,
+        Core::LinAlg::SerialDenseVector& elevec1,
+        Core::LinAlg::SerialDenseMatrix* elemat1 = nullptr) override
+    {
+      return 0;
+    }
+  };
+
+  std::shared_ptr<Core::Elements::Element> ProjectionLineType::create(const int id, const int owner)
+  {
+    return std::make_shared<ProjectionLine>(id, owner);
+  }
+
+  class NodalL2ProjectionTest : public ::testing::Test
+  {
+   protected:
+    void SetUp() override
+    {
+      dis_ = std::make_shared<Core::FE::Discretization>("projection", MPI_COMM_WORLD, 1);
+
+      // five equidistant nodes with h = 1 on [0, 4]
+      for (int inode = 0; inode < 5; ++inode)
+      {
+        const std::vector<double> x = {static_cast<double>(inode), 0.0, 0.0};
+        dis_->add_node(std::make_shared<Core::Nodes::Node>(inode, x, 0));
+      }
+      for (int iele = 0; iele < 4; ++iele)
+      {
+        auto ele = std::make_shared<ProjectionLine>(iele, 0);
+        const std::array<int, 2> nodeids = {iele, iele + 1};
+        ele->set_node_ids(2, nodeids.data());
+        dis_->add_element(ele);
+      }
+      dis_->fill_complete(true, false, false);
+
+      // linear fields f = 2 + 3x and g = 1 - x
+      auto phi = std::make_shared<Core::LinAlg::Vector<double>>(*dis_->dof_row_map(), true);
+      for (int inode = 0; inode < 5; ++inode)
+      {
+        const std::vector<int> dofs = dis_->dof(0, dis_->g_node(inode));
+        const double x = dis_->g_node(inode)->x()[0];
+        phi->ReplaceGlobalValue(dofs[0], 0, 2.0 + 3.0 * x);
+        phi->ReplaceGlobalValue(dofs[1], 0, 1.0 - x);
+      }
+      dis_->set_state("phi", phi);
+
+      Core::Utils::add_enum_class_to_parameter_list<Core::LinearSolver::SolverType>(
+          "SOLVER", Core::LinearSolver::SolverType::umfpack, solverparams_);
+      params_.set<int>("action", 0);
+    }
+
+    std::shared_ptr<Core::FE::Discretization> dis_;
+    Teuchos::ParameterList solverparams_;
+    Teuchos::ParameterList params_;
+  };
+
+  TEST_F(NodalL2ProjectionTest, ConsistentAndLumpedProjectionOfLinearField)
+  {
+    Core::FE::NodalL2Projection consistent(solverparams_, nullptr);
+    Core::FE::NodalL2Projection lumped(
+        solverparams_, nullptr, Core::FE::NodalL2Projection::MassMatrix::lumped);
+
+    // project twice to also check the reused mass matrix and factorization
+    for (int i = 0; i < 2; ++i)
+    {
+      const auto consistent_values = consistent.project(*dis_, "phi", 2, params_);
+      const auto lumped_values = lumped.project(*dis_, "phi", 2, params_);
+
+      for (int inode = 0; inode < 5; ++inode)
+      {
+        const int lid = dis_->node_row_map()->LID(inode);
+        const double x = static_cast<double>(inode);
+
+        // a linear field is reproduced exactly by the consistent projection
+        EXPECT_NEAR((*consistent_values)(0)[lid], 2.0 + 3.0 * x, 1.0e-12);
+        EXPECT_NEAR((*consistent_values)(1)[lid], 1.0 - x, 1.0e-12);
+
+        // the lumped projection is exact at interior nodes only, at the boundary nodes it yields
+        // the field at the center of mass of the shape function, i.e. shifted inwards by h/3
+        const double xlumped = (inode == 0) ? 1.0 / 3.0 : (inode == 4) ? 4.0 - 1.0 / 3.0 : x;
+        EXPECT_NEAR((*lumped_values)(0)[lid], 2.0 + 3.0 * xlumped, 1.0e-12);
+        EXPECT_NEAR((*lumped_values)(1)[lid], 1.0 - xlumped, 1.0e-12);
+      }
+    }
+  }
+}  // namespace
@@ -0,0 +1,111 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_fem_geometric_search_matchingoctree.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_fem_discretization.hpp"
+#include "4C_fem_general_node.hpp"
+
+#include <cmath>
+#include <map>
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  /** A grid of nx x ny master nodes in the plane z = 0, which is distributed in slabs along x
+   *  such that the bounding boxes of the master nodes of the procs are disjoint. Every master node
+   *  has
+   *   - a slave node close to it in the same plane (gid offset 100) and
+   *   - a periodic slave node at the same x and y in the plane z = 2 (gid offset 200),
+   *  both slave nodes are owned by other procs than the master node.
+   */
+  class MatchingOctreeTest : public ::testing::Test
+  {
+   protected:
+    static constexpr int nx = 6;
+    static constexpr int ny = 4;
+
+    MatchingOctreeTest()
+        : comm_(MPI_COMM_WORLD),
+          myrank_(Core::Communication::my_mpi_rank(comm_)),
+          numprocs_(Core::Communication::num_mpi_ranks(comm_)),
+          discret_(std::make_shared<Core::FE::Discretization>("matching", comm_, 3))
+    {
+      for (int j = 0; j < ny; ++j)
+      {
+        for (int i = 0; i < nx; ++i)
+        {
+          const int gid = i + nx * j;
+          const int masterowner = i * numprocs_ / nx;
+          const int slaveowner = (masterowner + 1) % numprocs_;
+
+          add_node(gid, {1.0 * i, 1.0 * j, 0.0}, masterowner);
+          add_node(100 + gid, {i + perturbation(gid), j - perturbation(gid), 0.0}, slaveowner);
+          add_node(200 + gid, {1.0 * i, 1.0 * j, 2.0}, slaveowner);
+
+          if (masterowner == myrank_) mymasternodeids_.push_back(gid);
+          slavenodeids_.push_back(100 + gid);
+          periodicslavenodeids_.push_back(200 + gid);
+        }
+      }
+      discret_->fill_complete(false, false, false);
+
+      octree_.init(*discret_, mymasternodeids_, 2, 0.1);
+      octree_.setup();
+    }
+
+    //! in-plane distance of the slave node from its master node
+    static double perturbation(const int gid) { return 0.01 * (gid % 3); }
+
+    void add_node(const int gid, const std::vector<double>& x, const int owner)
+    {
+      if (owner == myrank_) discret_->add_node(std::make_shared<Core::Nodes::Node>(gid, x, owner));
+    }
+
+    MPI_Comm comm_;
+    int myrank_;
+    int numprocs_;
+    std::shared_ptr<Core::FE::Discretization> discret_;
+    std::vector<int> mymasternodeids_;
+    std::vector<int> slavenodeids_;
+    std::vector<int> periodicslavenodeids_;
+    Core::GeometricSearch::NodeMatchingOctree octree_;
+  };
+
+  TEST_F(MatchingOctreeTest, FindMatchOfSlaveNodesOnOtherProcs)
+  {
+    std::map<int, std::pair<int, double>> coupling;
+    octree_.find_match(*discret_, slavenodeids_, coupling);
+
+    ASSERT_EQ(coupling.size(), mymasternodeids_.size());
+    for (const int gid : mymasternodeids_)
+    {
+      ASSERT_EQ(coupling.count(gid), 1);
+      EXPECT_EQ(coupling[gid].first, 100 + gid);
+      EXPECT_NEAR(coupling[gid].second, std::sqrt(2.0) * perturbation(gid), 1.0e-12);
+    }
+  }
+
+  TEST_F(MatchingOctreeTest, MatchPeriodicSlaveNodesOnOtherProcs)
+  {
+    // the periodic boundary condition is in the x-y plane, the slave nodes are shifted in z
+    std::map<int, std::vector<int>> midtosid;
+    octree_.create_global_entity_matching(periodicslavenodeids_, {0, 1}, 0.0, midtosid);
+
+    ASSERT_EQ(midtosid.size(), mymasternodeids_.size());
+    for (const int gid : mymasternodeids_)
+    {
+      ASSERT_EQ(midtosid.count(gid), 1);
+      EXPECT_EQ(midtosid[gid], std::vector<int>{200 + gid});
+    }
+  }
+}  // namespace
@@ -0,0 +1,106 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_fem_general_utils_nurbs_bezier_extraction.hpp"
+#include "4C_fem_general_utils_nurbs_shapefunctions.hpp"
+#include "4C_linalg_fixedsizematrix.hpp"
+
+#include <array>
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  constexpr double TOL = 1.0e-12;
+
+  Core::LinAlg::SerialDenseVector make_knots(const std::vector<double>& values)
+  {
+    Core::LinAlg::SerialDenseVector knots(values.size());
+    for (std::size_t i = 0; i < values.size(); ++i) knots(i) = values[i];
+    return knots;
+  }
+
+  template <Core::FE::CellType celltype>
+  void expect_same_basis(const std::vector<Core::LinAlg::SerialDenseVector>& knots)
+  {
+    constexpr int dim = Core::FE::dim<celltype>;
+    constexpr int num_nodes = Core::FE::num_nodes<celltype>;
+
+    Core::LinAlg::Matrix<num_nodes, 1> weights;
+    for (int i = 0; i < num_nodes; ++i) weights(i) = 0.7 + 0.05 * ((3 * i) % 7);
+
+    const Core::FE::Nurbs::BezierExtraction extraction = Core::FE::Nurbs::bezier_extraction(knots);
+
+    for (const double u : {-0.9, -0.3, 0.2, 0.77})
+    {
+      Core::LinAlg::Matrix<dim, 1> uv;
+      for (int d = 0; d < dim; ++d) uv(d) = u * (1.0 - 0.2 * d);
+
+      Core::LinAlg::Matrix<num_nodes, 1> funct_recursion;
+      Core::LinAlg::Matrix<dim, num_nodes> deriv_recursion;
+      ASSERT_TRUE(Core::FE::Nurbs::nurbs_get_funct_deriv(
+          funct_recursion, deriv_recursion, uv, knots, weights, celltype));
+
+      Core::LinAlg::Matrix<num_nodes, 1> funct_extraction;
+      Core::LinAlg::Matrix<dim, num_nodes> deriv_extraction;
+      ASSERT_TRUE(Core::FE::Nurbs::nurbs_get_funct_deriv<celltype>(
+          funct_extraction, deriv_extraction, uv, extraction, weights));
+
+      for (int i = 0; i < num_nodes; ++i)
+      {
+        EXPECT_NEAR(funct_extraction(i), funct_recursion(i), TOL);
+        for (int d = 0; d < dim; ++d)
+          EXPECT_NEAR(deriv_extraction(d, i), deriv_recursion(d, i), TOL);
+      }
+    }
+  }
+
+  TEST(BezierExtractionTest, BernsteinPolynomialsAndDerivatives)
+  {
+    std::array<double, 4> values;
+    std::array<double, 4> derivs;
+    Core::FE::Nurbs::bernstein_polynomials_and_derivs<3>(0.3, values, derivs);
+
+    const double t = 0.65;
+    EXPECT_NEAR(values[0], (1.0 - t) * (1.0 - t) * (1.0 - t), TOL);
+    EXPECT_NEAR(values[1], 3.0 * t * (1.0 - t) * (1.0 - t), TOL);
+    EXPECT_NEAR(values[2], 3.0 * t * t * (1.0 - t), TOL);
+    EXPECT_NEAR(values[3], t * t * t, TOL);
+    EXPECT_NEAR(derivs[0] + derivs[1] + derivs[2] + derivs[3], 0.0, TOL);
+    EXPECT_NEAR(derivs[3], 0.5 * 3.0 * t * t, TOL);
+  }
+
+  TEST(BezierExtractionTest, OpenKnotVectorGivesIdentity)
+  {
+    const Core::LinAlg::SerialDenseMatrix C =
+        Core::FE::Nurbs::bezier_extraction_operator(make_knots({0.0, 0.0, 0.0, 1.0, 1.0, 1.0}), 2);
+
+    for (int i = 0; i < 3; ++i)
+      for (int j = 0; j < 3; ++j) EXPECT_NEAR(C(i, j), i == j ? 1.0 : 0.0, TOL);
+  }
+
+  TEST(BezierExtractionTest, MatchesRecursionNurbs9)
+  {
+    expect_same_basis<Core::FE::CellType::nurbs9>(
+        {make_knots({0.0, 0.0, 0.5, 1.5, 2.0, 3.0}), make_knots({0.0, 1.0, 1.2, 2.0, 2.5, 4.0})});
+  }
+
+  TEST(BezierExtractionTest, MatchesRecursionNurbs27)
+  {
+    expect_same_basis<Core::FE::CellType::nurbs27>({make_knots({0.0, 0.0, 0.5, 1.5, 2.0, 3.0}),
+        make_knots({0.0, 1.0, 1.2, 2.0, 2.5, 4.0}), make_knots({1.0, 1.0, 1.0, 2.0, 3.0, 3.0})});
+  }
+
+  TEST(BezierExtractionTest, MatchesRecursionNurbs8)
+  {
+    expect_same_basis<Core::FE::CellType::nurbs8>({make_knots({0.0, 0.5, 1.5, 2.0}),
+        make_knots({1.0, 1.2, 2.0, 2.5}), make_knots({0.0, 1.0, 3.0, 3.5})});
+  }
+}  // namespace
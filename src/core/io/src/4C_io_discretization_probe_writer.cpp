@@ -0,0 +1,369 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_io_discretization_probe_writer.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_fem_general_cell_type_traits.hpp"
+#include "4C_fem_general_element.hpp"
+#include "4C_fem_general_node.hpp"
+#include "4C_fem_general_utils_fem_shapefunctions.hpp"
+#include "4C_fem_geometry_element_coordtrafo.hpp"
+#include "4C_io_control.hpp"
+#include "4C_io_pstream.hpp"
+#include "4C_linalg_serialdensematrix.hpp"
+#include "4C_linalg_serialdensevector.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  //! axis aligned bounding box
+  struct BoundingBox
+  {
+    std::array<double, 3> min = {std::numeric_limits<double>::max(),
+        std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+    std::array<double, 3> max = {std::numeric_limits<double>::lowest(),
+        std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest()};
+
+    void add_point(const double* x)
+    {
+      for (int d = 0; d < 3; ++d)
+      {
+        min[d] = std::min(min[d], x[d]);
+        max[d] = std::max(max[d], x[d]);
+      }
+    }
+
+    void add_box(const BoundingBox& box)
+    {
+      add_point(box.min.data());
+      add_point(box.max.data());
+    }
+
+    void enlarge(const double tol)
+    {
+      for (int d = 0; d < 3; ++d)
+      {
+        min[d] -= tol;
+        max[d] += tol;
+      }
+    }
+
+    bool contains(const std::array<double, 3>& x) const
+    {
+      for (int d = 0; d < 3; ++d)
+        if (x[d] < min[d] or x[d] > max[d]) return false;
+      return true;
+    }
+  };
+
+  //! cell types in which probes are located, i.e. the Lagrangian 3D cells
+  bool is_supported_cell_type(const Core::FE::CellType celltype)
+  {
+    switch (celltype)
+    {
+      case Core::FE::CellType::hex8:
+      case Core::FE::CellType::hex20:
+      case Core::FE::CellType::hex27:
+      case Core::FE::CellType::tet4:
+      case Core::FE::CellType::tet10:
+      case Core::FE::CellType::wedge6:
+      case Core::FE::CellType::wedge15:
+      case Core::FE::CellType::pyramid5:
+        return true;
+      default:
+        return false;
+    }
+  }
+}  // namespace
+
+/*-----------------------------------------------------------------------------------------------*
+ *-----------------------------------------------------------------------------------------------*/
+Core::IO::DiscretizationProbeWriter::DiscretizationProbeWriter(
+    std::shared_ptr<const Core::FE::Discretization> discretization,
+    std::vector<std::array<double, 3>> probes, const Core::IO::OutputControl& output_control,
+    const std::string& outputname)
+    : discretization_(std::move(discretization)), probes_(std::move(probes))
+{
+  if (discretization_->n_dim() != 3)
+  {
+    FOUR_C_THROW("Probe output is only implemented for 3D discretizations, but '%s' is %dD.",
+        discretization_->name().c_str(), discretization_->n_dim());
+  }
+  if (not discretization_->filled() or not discretization_->have_dofs())
+    FOUR_C_THROW("fill_complete() and assign_degrees_of_freedom() have to be called before.");
+
+  for (int iele = 0; iele < discretization_->num_my_row_elements(); ++iele)
+  {
+    const Core::Elements::Element* ele = discretization_->l_row_element(iele);
+    if (not is_supported_cell_type(ele->shape()))
+    {
+      FOUR_C_THROW(
+          "Probe output does not support element %d of cell type %s in discretization '%s'. Only "
+          "Lagrangian hex, tet, wedge and pyramid elements are supported.",
+          ele->id(), Core::FE::cell_type_to_string(ele->shape()).c_str(),
+          discretization_->name().c_str());
+    }
+  }
+
+  csv_writer_ = std::make_unique<RuntimeCsvWriter>(
+      Core::Communication::my_mpi_rank(discretization_->get_comm()), output_control, outputname);
+
+  locate_probes();
+}
+
+/*-----------------------------------------------------------------------------------------------*
+ *-----------------------------------------------------------------------------------------------*/
+void Core::IO::DiscretizationProbeWriter::locate_probes()
+{
+  MPI_Comm comm = discretization_->get_comm();
+  const int myrank = Core::Communication::my_mpi_rank(comm);
+  const int numprocs = Core::Communication::num_mpi_ranks(comm);
+
+  // bounding boxes of the row elements and of this processor
+  const int numele = discretization_->num_my_row_elements();
+  std::vector<BoundingBox> element_boxes(numele);
+  BoundingBox proc_box;
+  for (int iele = 0; iele < numele; ++iele)
+  {
+    const Core::Elements::Element* ele = discretization_->l_row_element(iele);
+    for (int inode = 0; inode < ele->num_node(); ++inode)
+      element_boxes[iele].add_point(ele->nodes()[inode]->x().data());
+
+    // small enlargement to find probes on element faces
+    const double tol =
+        1.0e-8 * std::max({element_boxes[iele].max[0] - element_boxes[iele].min[0],
+                     element_boxes[iele].max[1] - element_boxes[iele].min[1],
+                     element_boxes[iele].max[2] - element_boxes[iele].min[2]});
+    element_boxes[iele].enlarge(tol);
+    proc_box.add_box(element_boxes[iele]);
+  }
+
+  // sort the elements into a uniform grid of buckets covering the processor bounding box
+  const int numbuckets = std::max(1, static_cast<int>(std::cbrt(static_cast<double>(numele))));
+  std::array<double, 3> bucket_size;
+  for (int d = 0; d < 3; ++d)
+    bucket_size[d] = std::max((proc_box.max[d] - proc_box.min[d]) / numbuckets,
+        std::numeric_limits<double>::min());
+
+  auto bucket_index = [&](const double x, const int d)
+  {
+    const int index = static_cast<int>((x - proc_box.min[d]) / bucket_size[d]);
+    return std::clamp(index, 0, numbuckets - 1);
+  };
+
+  std::vector<std::vector<int>> buckets(numbuckets * numbuckets * numbuckets);
+  for (int iele = 0; iele < numele; ++iele)
+  {
+    const BoundingBox& box = element_boxes[iele];
+    for (int i = bucket_index(box.min[0], 0); i <= bucket_index(box.max[0], 0); ++i)
+      for (int j = bucket_index(box.min[1], 1); j <= bucket_index(box.max[1], 1); ++j)
+        for (int k = bucket_index(box.min[2], 2); k <= bucket_index(box.max[2], 2); ++k)
+          buckets[(i * numbuckets + j) * numbuckets + k].push_back(iele);
+  }
+
+  // local search, the surrounding element and its local coordinates
+  const int numprobes = static_cast<int>(probes_.size());
+  std::vector<int> found_element(numprobes, -1);
+  std::vector<Core::LinAlg::Matrix<3, 1>> found_xsi(numprobes);
+  std::vector<int> found_on_proc(numprobes, numprocs);
+  for (int iprobe = 0; iprobe < numprobes; ++iprobe)
+  {
+    const std::array<double, 3>& probe = probes_[iprobe];
+    if (numele == 0 or not proc_box.contains(probe)) continue;
+
+    const std::vector<int>& candidates = buckets[(bucket_index(probe[0], 0) * numbuckets +
+                                                     bucket_index(probe[1], 1)) *
+                                                     numbuckets +
+                                                 bucket_index(probe[2], 2)];
+
+    const Core::LinAlg::Matrix<3, 1> x(probe.data(), false);
+    for (const int iele : candidates)
+    {
+      if (not element_boxes[iele].contains(probe)) continue;
+
+      const Core::Elements::Element* ele = discretization_->l_row_element(iele);
+      Core::LinAlg::SerialDenseMatrix xyze(3, ele->num_node());
+      for (int inode = 0; inode < ele->num_node(); ++inode)
+        for (int d = 0; d < 3; ++d) xyze(d, inode) = ele->nodes()[inode]->x()[d];
+
+      Core::LinAlg::Matrix<3, 1> xsi(true);
+      if (Core::Geo::current_to_volume_element_coordinates(ele->shape(), xyze, x, xsi))
+      {
+        found_element[iprobe] = iele;
+        found_xsi[iprobe] = xsi;
+        found_on_proc[iprobe] = myrank;
+        break;
+      }
+    }
+  }
+
+  // probes on element boundaries between processors belong to the lowest rank
+  std::vector<int> owner(numprobes, numprocs);
+  Core::Communication::min_all(found_on_proc.data(), owner.data(), numprobes, comm);
+
+  located_probes_.clear();
+  for (int iprobe = 0; iprobe < numprobes; ++iprobe)
+  {
+    if (owner[iprobe] != myrank) continue;
+
+    const Core::Elements::Element* ele = discretization_->l_row_element(found_element[iprobe]);
+    const Core::LinAlg::Matrix<3, 1>& xsi = found_xsi[iprobe];
+
+    Core::LinAlg::SerialDenseVector funct(ele->num_node());
+    Core::FE::shape_function_3d(funct, xsi(0), xsi(1), xsi(2), ele->shape());
+
+    LocatedProbe located_probe;
+    located_probe.probe = iprobe;
+    for (int inode = 0; inode < ele->num_node(); ++inode)
+    {
+      located_probe.nodes.push_back(ele->nodes()[inode]);
+      located_probe.weights.push_back(funct(inode));
+    }
+    located_probes_.emplace_back(std::move(located_probe));
+  }
+
+  is_located_.resize(numprobes);
+  for (int iprobe = 0; iprobe < numprobes; ++iprobe) is_located_[iprobe] = owner[iprobe] < numprocs;
+  num_located_probes_ = static_cast<int>(std::count(is_located_.begin(), is_located_.end(), true));
+
+  if (myrank == 0 and num_located_probes_ < numprobes)
+  {
+    Core::IO::cout << "WARNING: " << numprobes - num_located_probes_ << " of " << numprobes
+                   << " probes are not located in discretization '" << discretization_->name()
+                   << "' and are written as NaN." << Core::IO::endl;
+  }
+}
+
+/*-----------------------------------------------------------------------------------------------*
+ *-----------------------------------------------------------------------------------------------*/
+void Core::IO::DiscretizationProbeWriter::register_field(
+    const std::string& fieldname, const int first_dof, const int num_components,
+    const int precision)
+{
+  if (fields_.count(fieldname) > 0)
+    FOUR_C_THROW("Probe field '%s' is already registered.", fieldname.c_str());
+
+  // dofs needed for the interpolation on this processor
+  std::vector<int> dof_gids;
+  int my_node_without_dofs = -1;
+  for (const LocatedProbe& located_probe : located_probes_)
+  {
+    for (const Core::Nodes::Node* node : located_probe.nodes)
+    {
+      const std::vector<int> node_dofs = discretization_->dof(0, node);
+      if (static_cast<int>(node_dofs.size()) < first_dof + num_components)
+      {
+        my_node_without_dofs = std::max(my_node_without_dofs, node->id());
+        continue;
+      }
+      for (int c = 0; c < num_components; ++c) dof_gids.push_back(node_dofs[first_dof + c]);
+    }
+  }
+
+  // only processors with located probes see the missing dofs, but all of them have to throw
+  int node_without_dofs = -1;
+  Core::Communication::max_all(
+      &my_node_without_dofs, &node_without_dofs, 1, discretization_->get_comm());
+  if (node_without_dofs >= 0)
+  {
+    FOUR_C_THROW("Node %d does not have the dofs %d to %d needed by probe field '%s'.",
+        node_without_dofs, first_dof, first_dof + num_components - 1, fieldname.c_str());
+  }
+
+  Field& field = fields_[fieldname];
+  field.first_dof = first_dof;
+  field.num_components = num_components;
+
+  std::vector<int> unique_gids(dof_gids);
+  std::sort(unique_gids.begin(), unique_gids.end());
+  unique_gids.erase(std::unique(unique_gids.begin(), unique_gids.end()), unique_gids.end());
+
+  field.probe_dof_map = std::make_shared<Epetra_Map>(-1, static_cast<int>(unique_gids.size()),
+      unique_gids.data(), 0, Core::Communication::as_epetra_comm(discretization_->get_comm()));
+  field.probe_dofs = std::make_shared<Core::LinAlg::Vector<double>>(*field.probe_dof_map, true);
+
+  field.dof_lids.reserve(dof_gids.size());
+  for (const int gid : dof_gids) field.dof_lids.push_back(field.probe_dof_map->LID(gid));
+
+  field.values.assign(probes_.size() * num_components, 0.0);
+
+  // column k of the field is component k % num_components of probe k / num_components
+  csv_writer_->register_data_vector(fieldname, probes_.size() * num_components, precision);
+}
+
+/*-----------------------------------------------------------------------------------------------*
+ *-----------------------------------------------------------------------------------------------*/
+void Core::IO::DiscretizationProbeWriter::append_field(
+    const std::string& fieldname, const Core::LinAlg::Vector<double>& result_data)
+{
+  auto field_it = fields_.find(fieldname);
+  if (field_it == fields_.end())
+    FOUR_C_THROW("Probe field '%s' has not been registered.", fieldname.c_str());
+  Field& field = field_it->second;
+
+  // the importer only depends on the layout of the result vector
+  if (field.importer == nullptr or not field.importer->SourceMap().SameAs(result_data.Map()))
+    field.importer = std::make_shared<Epetra_Import>(*field.probe_dof_map, result_data.Map());
+
+  if (field.probe_dofs->Import(result_data, *field.importer, Insert) != 0)
+    FOUR_C_THROW("Import of the probe dofs of field '%s' failed.", fieldname.c_str());
+
+  // interpolate at the located probes of this processor
+  const int num_components = field.num_components;
+  std::vector<double> local_values(field.values.size(), 0.0);
+  std::size_t entry = 0;
+  for (const LocatedProbe& located_probe : located_probes_)
+  {
+    double* value = &local_values[located_probe.probe * num_components];
+    for (std::size_t inode = 0; inode < located_probe.nodes.size(); ++inode)
+    {
+      for (int c = 0; c < num_components; ++c)
+        value[c] += located_probe.weights[inode] * (*field.probe_dofs)[field.dof_lids[entry++]];
+    }
+  }
+
+  // every probe is owned by exactly one processor
+  Core::Communication::sum_all(local_values.data(), field.values.data(),
+      static_cast<int>(local_values.size()), discretization_->get_comm());
+
+  // probes outside of the discretization
+  for (std::size_t iprobe = 0; iprobe < probes_.size(); ++iprobe)
+  {
+    if (is_located_[iprobe]) continue;
+    for (int c = 0; c < num_components; ++c)
+      field.values[iprobe * num_components + c] = std::numeric_limits<double>::quiet_NaN();
+  }
+
+  csv_writer_->append_data_vector(fieldname, field.values);
+}
+
+/*-----------------------------------------------------------------------------------------------*
+ *-----------------------------------------------------------------------------------------------*/
+const std::vector<double>& Core::IO::DiscretizationProbeWriter::field_values(
+    const std::string& fieldname) const
+{
+  auto field_it = fields_.find(fieldname);
+  if (field_it == fields_.end())
+    FOUR_C_THROW("Probe field '%s' has not been registered.", fieldname.c_str());
+  return field_it->second.values;
+}
+
+/*-----------------------------------------------------------------------------------------------*
+ *-----------------------------------------------------------------------------------------------*/
+void Core::IO::DiscretizationProbeWriter::write(const double time, const int step)
+{
+  csv_writer_->reset_time_and_time_step(time, step);
+  csv_writer_->write_collected_data_to_file();
+}
+
+FOUR_C_NAMESPACE_CLOSE
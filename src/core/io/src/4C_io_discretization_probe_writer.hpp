@@ -0,0 +1,150 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_IO_DISCRETIZATION_PROBE_WRITER_HPP
+#define FOUR_C_IO_DISCRETIZATION_PROBE_WRITER_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_fem_discretization.hpp"
+#include "4C_io_runtime_csv_writer.hpp"
+#include "4C_linalg_vector.hpp"
+
+#include <Epetra_Import.h>
+
+#include <array>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Core::IO
+{
+  class OutputControl;
+
+  /*!
+   * \brief Sample nodal results of a discretization at arbitrary points (probes) and write their
+   * time series to a csv file
+   *
+   * During setup every probe is located in the row elements of the discretization in reference
+   * configuration. The processor owning the surrounding element stores the element nodes and the
+   * shape function values at the probe. Each output only imports the dofs of these nodes and
+   * interpolates them with the stored weights, i.e., no full field output is needed.
+   *
+   * Only the first processor writes the csv file. Probes that are not located in any element are
+   * reported once and written as NaN.
+   *
+   * Only 3D discretizations of Lagrangian hex, tet, wedge and pyramid elements are supported.
+   */
+  class DiscretizationProbeWriter
+  {
+   public:
+    /**
+     * @brief Constructor
+     *
+     * @param discretization (in)  3D discretization with Lagrangian elements
+     * @param probes (in)          Coordinates of the probes (identical on all processors)
+     * @param output_control (in)  Output control to determine the file name
+     * @param outputname (in)      Name of the csv file
+     */
+    DiscretizationProbeWriter(std::shared_ptr<const Core::FE::Discretization> discretization,
+        std::vector<std::array<double, 3>> probes, const Core::IO::OutputControl& output_control,
+        const std::string& outputname);
+
+    /**
+     * @brief Register the nodal field @p fieldname, which consists of @p num_components
+     * consecutive dofs starting at nodal dof @p first_dof
+     *
+     * Example: for a 3D fluid, velocity is (0, 3) and pressure is (3, 1).
+     */
+    void register_field(
+        const std::string& fieldname, int first_dof, int num_components, int precision = 10);
+
+    /**
+     * @brief Interpolate the registered field @p fieldname from the dof based vector @p
+     * result_data at all probes
+     */
+    void append_field(
+        const std::string& fieldname, const Core::LinAlg::Vector<double>& result_data);
+
+    //! whether the field @p fieldname is registered
+    bool has_field(const std::string& fieldname) const { return fields_.contains(fieldname); }
+
+    /**
+     * @brief Interpolated values of the field @p fieldname at the last call of append_field()
+     *
+     * Entry k is component k % num_components of probe k / num_components. The values are
+     * available on all processors.
+     */
+    const std::vector<double>& field_values(const std::string& fieldname) const;
+
+    //! write all appended fields of the current step to file
+    void write(double time, int step);
+
+    //! number of probes located in the discretization
+    int num_located_probes() const { return num_located_probes_; }
+
+   private:
+    //! locate all probes in the row elements and store the interpolation weights
+    void locate_probes();
+
+    //! interpolation data of one probe located on this processor
+    struct LocatedProbe
+    {
+      //! global index of the probe
+      int probe;
+
+      //! column map nodes of the surrounding element
+      std::vector<const Core::Nodes::Node*> nodes;
+
+      //! shape function values of the element nodes at the probe
+      std::vector<double> weights;
+    };
+
+    //! a registered field
+    struct Field
+    {
+      int first_dof;
+      int num_components;
+
+      //! local ids in the probe dof map of the interpolated dofs, sorted as (located probe, node,
+      //! component)
+      std::vector<int> dof_lids;
+
+      //! map of the needed dofs, importer from the map of the result vector and imported values
+      std::shared_ptr<Epetra_Map> probe_dof_map;
+      std::shared_ptr<Epetra_Import> importer;
+      std::shared_ptr<Core::LinAlg::Vector<double>> probe_dofs;
+
+      //! interpolated values of all probes (summed over all processors)
+      std::vector<double> values;
+    };
+
+    std::shared_ptr<const Core::FE::Discretization> discretization_;
+
+    std::vector<std::array<double, 3>> probes_;
+
+    //! probes located on this processor
+    std::vector<LocatedProbe> located_probes_;
+
+    //! whether a probe is located on any processor
+    std::vector<bool> is_located_;
+
+    int num_located_probes_ = 0;
+
+    //! registered fields
+    std::map<std::string, Field> fields_;
+
+    std::unique_ptr<RuntimeCsvWriter> csv_writer_;
+  };
+}  // namespace Core::IO
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
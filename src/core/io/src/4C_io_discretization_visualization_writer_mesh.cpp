@@ -8,6 +8,7 @@
 #include "4C_io_discretization_visualization_writer_mesh.hpp"
 
 #include "4C_fem_discretization.hpp"
+#include "4C_fem_general_cell_type_traits.hpp"
 #include "4C_fem_general_element.hpp"
 #include "4C_fem_general_node.hpp"
 #include "4C_io.hpp"
@@ -21,6 +22,7 @@
 
 #include <Epetra_FEVector.h>
 
+#include <limits>
 #include <utility>
 
 FOUR_C_NAMESPACE_OPEN
@@ -36,8 +38,9 @@ namespace Core::IO
       std::function<bool(const Core::Elements::Element* element)> element_filter)
       : discretization_(discretization),
         visualization_manager_(std::make_shared<VisualizationManager>(
-            std::move(parameters), discretization->get_comm(), discretization->name())),
-        element_filter_(std::move(element_filter))
+            parameters, discretization->get_comm(), discretization->name())),
+        element_filter_(std::move(element_filter)),
+        shared_nodes_requested_(parameters.shared_nodes_)
   {
     set_geometry_from_discretization();
   }
@@ -46,6 +49,28 @@ namespace Core::IO
    *-----------------------------------------------------------------------------------------------*/
   void DiscretizationVisualizationWriterMesh::set_geometry_from_discretization()
   {
+    // store node row and col maps (needed to check for changed parallel distribution)
+    noderowmap_last_geometry_set_ = std::make_shared<Epetra_Map>(*discretization_->node_row_map());
+    nodecolmap_last_geometry_set_ = std::make_shared<Epetra_Map>(*discretization_->node_col_map());
+
+    // the gather plans are based on the old points
+    point_nodes_.clear();
+    dof_gather_plans_.clear();
+    dofcolmap_gather_plans_ = nullptr;
+
+    // nurbs elements are visualized with interpolated points instead of their control points
+    shared_nodes_ = shared_nodes_requested_;
+    for (const Core::Elements::Element* ele : discretization_->my_row_element_range())
+    {
+      if (element_filter_(ele) and Core::FE::is_nurbs_celltype(ele->shape())) shared_nodes_ = false;
+    }
+
+    if (shared_nodes_)
+    {
+      set_shared_node_geometry();
+      return;
+    }
+
     // Todo assume 3D for now
     const unsigned int num_spatial_dimensions = 3;
 
@@ -101,10 +126,101 @@ namespace Core::IO
 
     FOUR_C_ASSERT_ALWAYS(cell_offsets.size() == num_row_elements - num_skipped_eles,
         "Expected %i cell offset values, but got %i.", num_row_elements, cell_offsets.size());
+  }
 
-    // store node row and col maps (needed to check for changed parallel distribution)
-    noderowmap_last_geometry_set_ = std::make_shared<Epetra_Map>(*discretization_->node_row_map());
-    nodecolmap_last_geometry_set_ = std::make_shared<Epetra_Map>(*discretization_->node_col_map());
+  /*-----------------------------------------------------------------------------------------------*
+   *-----------------------------------------------------------------------------------------------*/
+  void DiscretizationVisualizationWriterMesh::set_shared_node_geometry()
+  {
+    const unsigned int num_spatial_dimensions = 3;
+
+    auto& visualization_data = visualization_manager_->get_visualization_data();
+
+    // Clear the visualization data, the cell connectivity is set explicitly below.
+    visualization_data.clear_data();
+
+    const unsigned int num_row_elements = discretization_->num_my_row_elements();
+
+    std::vector<double>& point_coordinates = visualization_data.get_point_coordinates();
+    point_coordinates.reserve(num_spatial_dimensions * discretization_->num_my_col_nodes());
+
+    std::vector<uint8_t>& cell_types = visualization_data.get_cell_types();
+    cell_types.reserve(num_row_elements);
+
+    std::vector<int32_t>& cell_offsets = visualization_data.get_cell_offsets();
+    cell_offsets.reserve(num_row_elements);
+
+    std::vector<int32_t>& cell_connectivity = visualization_data.get_cell_connectivity();
+
+    // visualization point of each column node (-1 if the node is not part of a visualized element)
+    std::vector<int> point_of_node(discretization_->num_my_col_nodes(), -1);
+
+    for (const Core::Elements::Element* ele : discretization_->my_row_element_range())
+    {
+      if (!element_filter_(ele)) continue;
+
+      const auto vtk_cell_info = get_vtk_cell_type_from_element_cell_type(ele->shape());
+      const std::vector<int>& numbering = vtk_cell_info.second;
+      cell_types.push_back(vtk_cell_info.first);
+
+      const Core::Nodes::Node* const* nodes = ele->nodes();
+      for (int inode = 0; inode < ele->num_node(); ++inode)
+      {
+        const Core::Nodes::Node* node = nodes[numbering[inode]];
+        const int lid = node->lid();
+        if (lid < 0) FOUR_C_THROW("Node %d is not part of the node column map.", node->id());
+
+        if (point_of_node[lid] == -1)
+        {
+          point_of_node[lid] = static_cast<int>(point_nodes_.size());
+          point_nodes_.push_back(node);
+          for (unsigned int idim = 0; idim < num_spatial_dimensions; ++idim)
+            point_coordinates.push_back(node->x()[idim]);
+        }
+        cell_connectivity.push_back(point_of_node[lid]);
+      }
+      cell_offsets.push_back(cell_connectivity.size());
+    }
+  }
+
+  /*-----------------------------------------------------------------------------------------------*
+   *-----------------------------------------------------------------------------------------------*/
+  const std::vector<int>& DiscretizationVisualizationWriterMesh::dof_gather_plan(
+      const unsigned int result_num_dofs_per_node,
+      const unsigned int read_result_data_from_dofindex)
+  {
+    const Epetra_Map& dofcolmap = *discretization_->dof_col_map();
+    if (dofcolmap_gather_plans_ == nullptr or not dofcolmap_gather_plans_->SameAs(dofcolmap))
+    {
+      dof_gather_plans_.clear();
+      dofcolmap_gather_plans_ = std::make_shared<Epetra_Map>(dofcolmap);
+    }
+
+    const auto key = std::make_pair(result_num_dofs_per_node, read_result_data_from_dofindex);
+    auto plan = dof_gather_plans_.find(key);
+    if (plan != dof_gather_plans_.end()) return plan->second;
+
+    std::vector<int>& lids = dof_gather_plans_[key];
+    lids.reserve(result_num_dofs_per_node * point_nodes_.size());
+
+    std::vector<int> nodedofs;
+    for (const Core::Nodes::Node* node : point_nodes_)
+    {
+      nodedofs.clear();
+      discretization_->dof(0u, node, nodedofs);
+
+      // dofs that are not available at this node are marked, see
+      // append_visualization_dof_based_result_data_vector_lagrange_ele()
+      for (unsigned int idof = 0; idof < result_num_dofs_per_node; ++idof)
+      {
+        if (nodedofs.size() > read_result_data_from_dofindex + idof)
+          lids.push_back(dofcolmap.LID(nodedofs[idof + read_result_data_from_dofindex]));
+        else
+          lids.push_back(-1);
+      }
+    }
+
+    return lids;
   }
 
   /*-----------------------------------------------------------------------------------------------*
@@ -221,6 +337,24 @@ namespace Core::IO
         "Received map of dof-based result data vector does not match the discretization's dof "
         "col map.");
 
+    if (shared_nodes_)
+    {
+      // gather the result data of all points with the cached plan
+      const std::vector<int>& lids =
+          dof_gather_plan(result_num_dofs_per_node, read_result_data_from_dofindex);
+
+      std::vector<double> point_result_data(lids.size());
+      for (std::size_t i = 0; i < lids.size(); ++i)
+      {
+        point_result_data[i] = lids[i] >= 0 ? result_data_dofbased_col_map[lids[i]]
+                                            : std::numeric_limits<double>::quiet_NaN();
+      }
+
+      visualization_manager_->get_visualization_data().set_point_data_vector(
+          resultname, point_result_data, result_num_dofs_per_node);
+      return;
+    }
+
     // count number of nodes for this visualization
     unsigned int num_nodes = 0;
     for (const Core::Elements::Element* ele : discretization_->my_row_element_range())
@@ -290,6 +424,23 @@ namespace Core::IO
         "Received map of node-based result data vector does not match the discretization's node "
         "col map.");
 
+    if (shared_nodes_)
+    {
+      std::vector<double> point_result_data;
+      point_result_data.reserve(result_num_components_per_node * point_nodes_.size());
+
+      for (const Core::Nodes::Node* node : point_nodes_)
+      {
+        for (unsigned int component_i = 0; component_i < result_num_components_per_node;
+            ++component_i)
+          point_result_data.push_back(result_data_nodebased_col_map(component_i)[node->lid()]);
+      }
+
+      visualization_manager_->get_visualization_data().set_point_data_vector(
+          resultname, point_result_data, result_num_components_per_node);
+      return;
+    }
+
     // count number of nodes
     unsigned int num_nodes = 0;
     for (const Core::Elements::Element* ele : discretization_->my_row_element_range())
@@ -442,6 +593,17 @@ namespace Core::IO
    *-----------------------------------------------------------------------------------------------*/
   void DiscretizationVisualizationWriterMesh::append_node_gid(const std::string& resultname)
   {
+    if (shared_nodes_)
+    {
+      std::vector<int> gid_of_nodes;
+      gid_of_nodes.reserve(point_nodes_.size());
+      for (const Core::Nodes::Node* node : point_nodes_) gid_of_nodes.push_back(node->id());
+
+      visualization_manager_->get_visualization_data().set_point_data_vector<int>(
+          resultname, gid_of_nodes, 1);
+      return;
+    }
+
     // count number of nodes; output is completely independent of the number of processors involved
     int num_nodes = 0;
     for (const Core::Elements::Element* ele : discretization_->my_row_element_range())
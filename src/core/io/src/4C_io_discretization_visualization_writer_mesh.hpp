@@ -15,8 +15,11 @@
 #include "4C_io_visualization_parameters.hpp"
 #include "4C_linalg_vector.hpp"
 
+#include <map>
 #include <memory>
 #include <optional>
+#include <utility>
+#include <vector>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -176,6 +179,14 @@ namespace Core::IO
      */
     void write_to_disk(const double visualization_time, const int visualization_step);
 
+    /**
+     * \brief Return the visualization data that is written to disk
+     */
+    [[nodiscard]] const VisualizationData& get_visualization_data() const
+    {
+      return visualization_manager_->get_visualization_data();
+    }
+
    private:
     /** \brief Determine and set geometry data from elements based on reference configuration
      *
@@ -183,9 +194,30 @@ namespace Core::IO
      * topology to the the output file. This results in a "discontinuous" visualization, i.e., the
      * nodes of adjacent elements are not connected in the output file. In ParaView the global
      * nodal connectivity can be restored with the CleanToGrid filter.
+     *
+     * If shared nodes are requested in the visualization parameters and all visualized elements
+     * use Lagrange shape functions, each node is written only once per processor and the cells
+     * are connected via a processor local connectivity, see set_shared_node_geometry().
      */
     void set_geometry_from_discretization();
 
+    /**
+     * \brief Set the geometry with one point per node of the visualized row elements
+     *
+     * The column map node of each point is stored, such that result data can be gathered directly
+     * from the global vectors without looping over the elements.
+     */
+    void set_shared_node_geometry();
+
+    /**
+     * \brief Return the indices in the dof column map to gather a dof-based result vector
+     *
+     * The gather plan holds result_num_dofs_per_node entries per point, -1 marks dofs which are
+     * not available at the node. The plans are cached until the dof column map changes.
+     */
+    const std::vector<int>& dof_gather_plan(
+        unsigned int result_num_dofs_per_node, unsigned int read_result_data_from_dofindex);
+
 
    private:
     //! discretization containing elements of which geometry and result data shall be visualized
@@ -200,6 +232,21 @@ namespace Core::IO
     //! Node row and col maps the geometry of visualization writer is based on
     std::shared_ptr<Epetra_Map> noderowmap_last_geometry_set_;
     std::shared_ptr<Epetra_Map> nodecolmap_last_geometry_set_;
+
+    //! Flag if shared nodes are requested in the visualization parameters
+    const bool shared_nodes_requested_;
+
+    //! Flag if the current geometry writes each node only once (Lagrange elements only)
+    bool shared_nodes_ = false;
+
+    //! Nodes of the visualization points in shared node mode
+    std::vector<const Core::Nodes::Node*> point_nodes_;
+
+    //! Cached gather plans of dof-based results for (dofs per node, first dof index)
+    std::map<std::pair<unsigned int, unsigned int>, std::vector<int>> dof_gather_plans_;
+
+    //! Dof col map the cached gather plans are based on
+    std::shared_ptr<Epetra_Map> dofcolmap_gather_plans_;
   };
 
   /**
@@ -61,6 +61,8 @@ Core::IO::VisualizationParameters Core::IO::visualization_parameters_factory(
   }
   parameters.writer_ = output_writer;
 
+  parameters.shared_nodes_ = visualization_output_parameter_list.get<bool>("SHARED_NODES");
+
   return parameters;
 }
 
@@ -71,6 +71,9 @@ namespace Core::IO
 
     //! Enum containing the output writer that shall be used
     OutputWriter writer_;
+
+    //! Flag if nodes shared by several elements are written only once per processor
+    bool shared_nodes_ = false;
   };
 
   /**
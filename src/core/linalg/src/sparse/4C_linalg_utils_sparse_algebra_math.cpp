@@ -16,6 +16,8 @@
 #include <EpetraExt_Transpose_RowMatrix.h>
 #include <Teuchos_SerialQRDenseSolver.hpp>
 
+#include <algorithm>
+
 FOUR_C_NAMESPACE_OPEN
 
 namespace Core::LinAlg
@@ -134,6 +136,47 @@ namespace Core::LinAlg
 
       return NumMyRows;
     }
+
+    /*----------------------------------------------------------------------*
+     |  check whether two maps have the same local elements                 |
+     *----------------------------------------------------------------------*/
+    bool same_local_elements(const Epetra_BlockMap& a, const Epetra_BlockMap& b)
+    {
+      if (a.SameBlockMapDataAs(b)) return true;
+      if (a.NumMyElements() != b.NumMyElements()) return false;
+
+      return std::equal(
+          a.MyGlobalElements(), a.MyGlobalElements() + a.NumMyElements(), b.MyGlobalElements());
+    }
+
+    /*----------------------------------------------------------------------*
+     |  check whether two filled graphs have the same local pattern         |
+     *----------------------------------------------------------------------*/
+    bool same_local_pattern(const Epetra_CrsGraph& a, const Epetra_CrsGraph& b)
+    {
+      if (a.DataPtr() == b.DataPtr()) return true;
+
+      if (!a.Filled() or !b.Filled()) return false;
+      if (a.NumMyNonzeros() != b.NumMyNonzeros()) return false;
+      if (!same_local_elements(a.RowMap(), b.RowMap()) or
+          !same_local_elements(a.ColMap(), b.ColMap()) or
+          !same_local_elements(a.DomainMap(), b.DomainMap()) or
+          !same_local_elements(a.RangeMap(), b.RangeMap()))
+        return false;
+
+      for (int row = 0; row < a.NumMyRows(); ++row)
+      {
+        int num_a = 0, num_b = 0;
+        int* indices_a = nullptr;
+        int* indices_b = nullptr;
+        a.ExtractMyRowView(row, num_a, indices_a);
+        b.ExtractMyRowView(row, num_b, indices_b);
+
+        if (num_a != num_b or !std::equal(indices_a, indices_a + num_a, indices_b)) return false;
+      }
+
+      return true;
+    }
   }  // namespace
 }  // namespace Core::LinAlg
 
@@ -171,10 +214,13 @@ void Core::LinAlg::add(const Epetra_CrsMatrix& A, const bool transposeA, const d
     if (!B.filled()) FOUR_C_THROW("Unexpected state of B (expected: B not filled, got: B filled)");
 
     // not successful -> matrix structure must be un-completed to be able to add new
-    // indices.
+    // indices. The domain and range map are kept, since they can differ from the row map of
+    // rectangular matrices.
+    const Epetra_Map domainmap = B.domain_map();
+    const Epetra_Map rangemap = B.range_map();
     B.un_complete();
     do_add(*Aprime, scalarA, *B.epetra_matrix(), scalarB, rowsAdded);
-    B.complete();
+    B.complete(domainmap, rangemap);
   }
 }
 
@@ -317,6 +363,102 @@ std::unique_ptr<Core::LinAlg::SparseMatrix> Core::LinAlg::matrix_multiply(const
   return C;
 }
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+std::unique_ptr<Core::LinAlg::SparseMatrix> Core::LinAlg::MatrixMultiply::operator()(
+    const SparseMatrix& A, bool transA, const SparseMatrix& B, bool transB,
+    bool explicitdirichlet, bool savegraph)
+{
+  // make sure fill_complete was called on the matrices
+  if (!A.filled()) FOUR_C_THROW("A has to be fill_complete");
+  if (!B.filled()) FOUR_C_THROW("B has to be fill_complete");
+
+  const Epetra_CrsGraph& graph_a = A.epetra_matrix()->Graph();
+  const Epetra_CrsGraph& graph_b = B.epetra_matrix()->Graph();
+
+  EpetraExt::RowMatrix_Transpose transposer_a, transposer_b;
+  Epetra_CrsMatrix* Atrans = A.epetra_matrix().get();
+  Epetra_CrsMatrix* Btrans = B.epetra_matrix().get();
+  if (transA) Atrans = dynamic_cast<Epetra_CrsMatrix*>(&transposer_a(*A.epetra_matrix()));
+  if (transB) Btrans = dynamic_cast<Epetra_CrsMatrix*>(&transposer_b(*B.epetra_matrix()));
+
+  std::unique_ptr<SparseMatrix> C;
+  if (graph_c_ != nullptr and same_operands(graph_a, transA, graph_b, transB))
+  {
+    // C is filled on the stored pattern, hence only the numerical product is computed
+    C = std::make_unique<SparseMatrix>(
+        std::make_shared<Epetra_CrsMatrix>(::Copy, *graph_c_), View, explicitdirichlet, savegraph);
+
+    // keep numerical zeros such that the pattern of C only depends on the patterns of A and B
+    int local_err = EpetraExt::MatrixMatrix::Multiply(
+        *Atrans, false, *Btrans, false, *C->epetra_matrix(), true, true);
+
+    // the numerical product does not fit into the stored pattern on some processor, hence all
+    // processors compute the full product below
+    int err = 0;
+    local_err = (local_err != 0) ? 1 : 0;
+    graph_a.Comm().MaxAll(&local_err, &err, 1);
+    if (err)
+    {
+      C = nullptr;
+      graph_c_ = nullptr;
+    }
+    else
+      ++num_reused_;
+  }
+  else
+    graph_c_ = nullptr;
+
+  if (C == nullptr)
+  {
+    // a first guess for the bandwidth of C leading to much less memory consumption
+    const int nnz = std::max(A.max_num_entries(), B.max_num_entries());
+
+    auto map = transA ? A.domain_map() : A.range_map();
+    C = std::make_unique<SparseMatrix>(map, nnz, explicitdirichlet, savegraph);
+
+    // keep numerical zeros such that the pattern of C only depends on the patterns of A and B
+    int err = EpetraExt::MatrixMatrix::Multiply(
+        *Atrans, false, *Btrans, false, *C->epetra_matrix(), true, true);
+    if (err) FOUR_C_THROW("EpetraExt::MatrixMatrix::MatrixMultiply returned err = %d", err);
+  }
+
+  // remember the patterns, the copies share the data with the originals
+  graph_a_ = std::make_shared<Epetra_CrsGraph>(graph_a);
+  graph_b_ = std::make_shared<Epetra_CrsGraph>(graph_b);
+  trans_a_ = transA;
+  trans_b_ = transB;
+  if (graph_c_ == nullptr)
+    graph_c_ = std::make_shared<Epetra_CrsGraph>(C->epetra_matrix()->Graph());
+
+  return C;
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::LinAlg::MatrixMultiply::reset()
+{
+  graph_a_ = nullptr;
+  graph_b_ = nullptr;
+  graph_c_ = nullptr;
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+bool Core::LinAlg::MatrixMultiply::same_operands(const Epetra_CrsGraph& graph_a, bool transA,
+    const Epetra_CrsGraph& graph_b, bool transB) const
+{
+  if (transA != trans_a_ or transB != trans_b_) return false;
+
+  // all processors have to take the same branch since the product is a collective operation
+  int local_same =
+      (same_local_pattern(graph_a, *graph_a_) and same_local_pattern(graph_b, *graph_b_)) ? 1 : 0;
+  int global_same = 0;
+  graph_a.Comm().MinAll(&local_same, &global_same, 1);
+
+  return global_same == 1;
+}
+
 /*----------------------------------------------------------------------*
  *----------------------------------------------------------------------*/
 std::shared_ptr<Core::LinAlg::SparseMatrix> Core::LinAlg::matrix_transpose(const SparseMatrix& A)
@@ -146,6 +146,69 @@ namespace Core::LinAlg
       const SparseMatrix& B, bool transB, bool explicitdirichlet, bool savegraph,
       bool complete = true);
 
+  /*!
+   \brief Multiply a (transposed) sparse matrix with another (transposed) one repeatedly
+
+   Same as matrix_multiply(), but the object keeps the sparsity pattern of the last result C.
+   If the sparsity patterns (including row, column, domain and range maps) of A and B did not
+   change since the last call, a new C is created on a copy of this pattern and only the
+   numerical product is computed, i.e. the symbolic phase and the allocation of C are skipped.
+   Otherwise (or if the numerical product does not fit into the stored pattern on any processor)
+   the stored pattern is dropped, a full product is computed into a fresh C and its pattern is
+   stored for the next call.
+
+   \note Numerical zeros of the product are kept, such that the pattern of C only depends on the
+   patterns of A and B. This can increase the number of stored entries of C compared to
+   matrix_multiply().
+
+   Typical use cases are condensation procedures, where the same products are formed in every
+   nonlinear iteration and the operand patterns only change with the active set.
+
+   \note C is always fill_complete upon exit.
+   */
+  class MatrixMultiply
+  {
+   public:
+    /*!
+     \brief Compute C = A(^T)*B(^T)
+
+     \param A                 (in) : Matrix to multiply with B (must have Filled()==true)
+     \param transA            (in) : flag indicating whether transposed of A should be used
+     \param B                 (in) : Matrix to multiply with A (must have Filled()==true)
+     \param transB            (in) : flag indicating whether transposed of B should be used
+     \param explicitdirichlet (in) : flag deciding on explicitdirichlet flag of C
+     \param savegraph         (in) : flag deciding on savegraph flag of C
+     \return Matrix product A(^T)*B(^T)
+     */
+    std::unique_ptr<SparseMatrix> operator()(const SparseMatrix& A, bool transA,
+        const SparseMatrix& B, bool transB, bool explicitdirichlet, bool savegraph);
+
+    /// forget the stored sparsity pattern
+    void reset();
+
+    /// number of products that reused the stored sparsity pattern
+    int num_reused() const { return num_reused_; }
+
+   private:
+    /// check whether the patterns of A and B equal the ones of the last call
+    bool same_operands(const Epetra_CrsGraph& graph_a, bool transA,
+        const Epetra_CrsGraph& graph_b, bool transB) const;
+
+    /// sparsity patterns of the operands of the last call (sharing the data with the operands)
+    std::shared_ptr<const Epetra_CrsGraph> graph_a_;
+    std::shared_ptr<const Epetra_CrsGraph> graph_b_;
+
+    /// transposition flags of the last call
+    bool trans_a_ = false;
+    bool trans_b_ = false;
+
+    /// sparsity pattern of the last result
+    std::shared_ptr<const Epetra_CrsGraph> graph_c_;
+
+    /// number of products that reused the stored sparsity pattern
+    int num_reused_ = 0;
+  };
+
 
   /*!
    \brief Compute transposed matrix of a sparse matrix explicitly
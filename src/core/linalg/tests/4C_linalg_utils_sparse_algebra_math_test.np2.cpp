@@ -9,7 +9,9 @@
 
 #include "4C_linalg_utils_sparse_algebra_math.hpp"
 
+#include "4C_linalg_sparsematrix.hpp"
 #include "4C_linalg_utils_sparse_algebra_manipulation.hpp"
+#include "4C_linalg_vector.hpp"
 #include "4C_unittest_utils_support_files_test.hpp"
 
 #include <Epetra_MpiComm.h>
@@ -182,6 +184,89 @@ namespace
           A_thresh->norm_frobenius(), expected_frobenius_norm, expected_frobenius_norm * 1e-12);
     }
   }
+
+  /** The test setup is based on a simple 1d poisson problem with the given matrix "poisson1d.mm".
+   *
+   * A repeated product with operands of unchanged sparsity pattern reuses the pattern of the
+   * previous result and has to give the same result as a fresh product.
+   */
+  TEST_F(SparseAlgebraMathTest, MatrixMultiplyReusesPattern)
+  {
+    Epetra_CrsMatrix* A;
+
+    int err = EpetraExt::MatrixMarketFileToCrsMatrix(
+        TESTING::get_support_file_path("test_matrices/poisson1d.mm").c_str(),
+        Core::Communication::as_epetra_comm(comm_), A);
+    if (err != 0) FOUR_C_THROW("Matrix read failed.");
+    std::shared_ptr<Epetra_CrsMatrix> A_crs = Core::Utils::shared_ptr_from_ref(*A);
+    Core::LinAlg::SparseMatrix A_sparse(A_crs, Core::LinAlg::Copy);
+
+    Core::LinAlg::MatrixMultiply multiply;
+    std::shared_ptr<Core::LinAlg::SparseMatrix> C_first =
+        multiply(A_sparse, false, A_sparse, true, true, false);
+    EXPECT_EQ(multiply.num_reused(), 0);
+
+    // a different matrix with the same pattern
+    Core::LinAlg::SparseMatrix B_sparse(A_crs, Core::LinAlg::Copy);
+    B_sparse.scale(2.0);
+
+    std::shared_ptr<Core::LinAlg::SparseMatrix> C_second =
+        multiply(A_sparse, false, B_sparse, true, true, false);
+    EXPECT_EQ(multiply.num_reused(), 1);
+    EXPECT_TRUE(C_second->filled());
+
+    std::shared_ptr<Core::LinAlg::SparseMatrix> C_reference =
+        Core::LinAlg::matrix_multiply(A_sparse, false, B_sparse, true, true, false);
+    EXPECT_NEAR(C_second->norm_frobenius(), C_reference->norm_frobenius(), 1e-12);
+    EXPECT_NEAR(C_second->norm_frobenius(), 2.0 * C_first->norm_frobenius(), 1e-12);
+
+    // a changed transposition flag requires a new pattern
+    multiply(A_sparse, false, B_sparse, false, true, false);
+    EXPECT_EQ(multiply.num_reused(), 1);
+  }
+
+  /** Adding a contribution that does not fit into the graph of a completed rectangular matrix
+   * (e.g. from new contact pairs in an off-diagonal block) extends the graph and has to keep the
+   * domain and range map of the matrix.
+   */
+  TEST_F(SparseAlgebraMathTest, AddExtendsGraphOfRectangularMatrix)
+  {
+    const Epetra_Map rowmap(4, 0, Core::Communication::as_epetra_comm(comm_));
+    const Epetra_Map domainmap(6, 0, Core::Communication::as_epetra_comm(comm_));
+
+    // B couples every row with one column only
+    Core::LinAlg::SparseMatrix B(rowmap, 3, false, false);
+    for (int lid = 0; lid < rowmap.NumMyElements(); ++lid)
+      B.assemble(1.0, rowmap.GID(lid), rowmap.GID(lid));
+    B.complete(domainmap, rowmap);
+
+    // A adds a new coupling of every row with the last column
+    Core::LinAlg::SparseMatrix A(rowmap, 3, false, false);
+    for (int lid = 0; lid < rowmap.NumMyElements(); ++lid)
+    {
+      A.assemble(2.0, rowmap.GID(lid), rowmap.GID(lid));
+      A.assemble(3.0, rowmap.GID(lid), 5);
+    }
+    A.complete(domainmap, rowmap);
+
+    B.add(A, false, 1.0, 1.0);
+
+    EXPECT_TRUE(B.filled());
+    EXPECT_TRUE(B.domain_map().SameAs(domainmap));
+    EXPECT_TRUE(B.range_map().SameAs(rowmap));
+    EXPECT_EQ(B.epetra_matrix()->NumGlobalNonzeros(), 8);
+
+    // a later complete() with the same maps must not change anything
+    B.complete(domainmap, rowmap);
+    EXPECT_TRUE(B.domain_map().SameAs(domainmap));
+
+    // B * x with x = 1 gives 3 + 3 in every row
+    Core::LinAlg::Vector<double> x(domainmap, false);
+    x.PutScalar(1.0);
+    Core::LinAlg::Vector<double> y(rowmap, true);
+    B.multiply(false, x, y);
+    for (int lid = 0; lid < y.MyLength(); ++lid) EXPECT_NEAR(y[lid], 6.0, 1e-14);
+  }
 }  // namespace
 
 FOUR_C_NAMESPACE_CLOSE
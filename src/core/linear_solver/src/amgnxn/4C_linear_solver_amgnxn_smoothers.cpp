@@ -815,6 +815,29 @@ void Core::LinearSolver::AMGNxN::DirectSolverWrapper::apply(
 }
 
 
+/*------------------------------------------------------------------------------*/
+/*------------------------------------------------------------------------------*/
+Core::LinearSolver::AMGNxN::NodalBlockSmootherWrapper::NodalBlockSmootherWrapper(
+    Teuchos::RCP<Core::LinAlg::SparseMatrix> A, int block_size, NodalBlockRelaxationType type,
+    int sweeps, double damping)
+    : a_(std::move(A))
+{
+  relaxation_ = std::make_shared<NodalBlockRelaxation>(
+      a_->epetra_matrix(), block_size, type, sweeps, damping);
+  relaxation_->setup();
+}
+
+
+/*------------------------------------------------------------------------------*/
+/*------------------------------------------------------------------------------*/
+void Core::LinearSolver::AMGNxN::NodalBlockSmootherWrapper::apply(
+    const Core::LinAlg::MultiVector<double>& X, Core::LinAlg::MultiVector<double>& Y,
+    bool InitialGuessIsZero) const
+{
+  relaxation_->apply(X, Y, InitialGuessIsZero);
+}
+
+
 /*------------------------------------------------------------------------------*/
 /*------------------------------------------------------------------------------*/
 
@@ -1113,6 +1136,7 @@ void Core::LinearSolver::AMGNxN::SmootherFactory::set_type_and_params()
   valid_types.emplace_back("MERGE_AND_SOLVE");
   valid_types.emplace_back("BLOCK_AMG");
   valid_types.emplace_back("SIMPLE");
+  valid_types.emplace_back("NODAL_BLOCK_RELAXATION");
 
   std::string smoother_type;
   Teuchos::ParameterList smoother_params;
@@ -1211,6 +1235,14 @@ Core::LinearSolver::AMGNxN::SmootherFactory::create()
     mySmootherFactory->set_params(get_params());
     mySmootherFactory->set_block(get_block());
   }
+  else if (get_type() == "NODAL_BLOCK_RELAXATION")
+  {
+    mySmootherFactory = Teuchos::make_rcp<NodalBlockSmootherFactory>();
+    mySmootherFactory->set_operator(get_operator());
+    mySmootherFactory->set_params(get_params());
+    mySmootherFactory->set_block(get_block());
+    if (is_set_null_space()) mySmootherFactory->set_null_space(get_null_space());
+  }
   else if (get_type() == "REUSE_MUELU_SMOOTHER")
   {
     mySmootherFactory = Teuchos::make_rcp<MueluSmootherWrapperFactory>();
@@ -2263,4 +2295,58 @@ Core::LinearSolver::AMGNxN::DirectSolverWrapperFactory::create()
   return S;
 }
 
+/*------------------------------------------------------------------------------*/
+/*------------------------------------------------------------------------------*/
+
+Teuchos::RCP<Core::LinearSolver::AMGNxN::GenericSmoother>
+Core::LinearSolver::AMGNxN::NodalBlockSmootherFactory::create()
+{
+  // Expected parameters with default values
+  //
+  // <ParameterList name="parameters">
+  //   <Parameter name="block size"                   type="int"     value="number of PDEs"/>
+  //   <Parameter name="relaxation: type"             type="string"  value="Gauss-Seidel"/>
+  //   <Parameter name="relaxation: sweeps"           type="int"     value="1"/>
+  //   <Parameter name="relaxation: damping factor"   type="double"  value="1.0"/>
+  // </ParameterList>
+  //
+  // The block size defaults to the number of PDEs of the null space of the block, i.e. the number
+  // of dofs per node on the finest level and the null space dimension on the coarser levels.
+
+  // Check input
+  if (not is_set_operator()) FOUR_C_THROW("IsSetOperator() returns false");
+  if (not is_set_params()) FOUR_C_THROW("IsSetParams() returns false");
+
+  Teuchos::ParameterList myParams = get_params();
+  int block_size = myParams.get<int>("block size", -1);
+  if (block_size == -1)
+  {
+    if (not is_set_null_space())
+      FOUR_C_THROW("The block size has to be given for the nodal block smoother");
+    block_size = get_level() == 0 ? get_null_space().get_num_pd_es()
+                                  : get_null_space().get_null_space_dim();
+  }
+  const std::string type = myParams.get<std::string>("relaxation: type", "Gauss-Seidel");
+  const int sweeps = myParams.get<int>("relaxation: sweeps", 1);
+  const double damping = myParams.get<double>("relaxation: damping factor", 1.0);
+
+  if (get_verbosity() == "on")
+  {
+    std::cout << std::endl;
+    std::cout << "Creating a NODAL_BLOCK_RELAXATION smoother for block " << get_block();
+    std::cout << " at level " << get_level() << std::endl;
+    std::cout << "The block size is: " << block_size << std::endl;
+    std::cout << "The relaxation type is: " << type << " with " << sweeps
+              << " sweep(s) and damping " << damping << std::endl;
+  }
+
+  if (not get_operator()->has_only_one_block())
+    FOUR_C_THROW("This smoother can be built only for single block matrices");
+  Teuchos::RCP<Core::LinAlg::SparseMatrix> matrix = get_operator()->get_matrix(0, 0);
+  if (matrix == Teuchos::null) FOUR_C_THROW("We expect here a sparse matrix");
+
+  return Teuchos::make_rcp<NodalBlockSmootherWrapper>(
+      matrix, block_size, string_to_nodal_block_relaxation_type(type), sweeps, damping);
+}
+
 FOUR_C_NAMESPACE_CLOSE
@@ -14,6 +14,7 @@
 #include "4C_linalg_blocksparsematrix.hpp"
 #include "4C_linear_solver_amgnxn_objects.hpp"
 #include "4C_linear_solver_method_linalg.hpp"
+#include "4C_linear_solver_preconditioner_nodal_block.hpp"
 #include "4C_linear_solver_preconditioner_type.hpp"
 
 #include <Epetra_Operator.h>
@@ -302,6 +303,20 @@ namespace Core::LinearSolver::AMGNxN
     bool is_set_up_{false};
   };
 
+  class NodalBlockSmootherWrapper : public SingleFieldSmoother
+  {
+   public:
+    NodalBlockSmootherWrapper(Teuchos::RCP<Core::LinAlg::SparseMatrix> A, int block_size,
+        NodalBlockRelaxationType type, int sweeps, double damping);
+
+    void apply(const Core::LinAlg::MultiVector<double>& X, Core::LinAlg::MultiVector<double>& Y,
+        bool InitialGuessIsZero = false) const override;
+
+   private:
+    Teuchos::RCP<Core::LinAlg::SparseMatrix> a_;
+    std::shared_ptr<NodalBlockRelaxation> relaxation_;
+  };
+
   // Auxiliary class to wrap the null space data to be used within the smoothers
   class NullSpaceInfo
   {
@@ -487,6 +502,12 @@ namespace Core::LinearSolver::AMGNxN
    public:
     Teuchos::RCP<GenericSmoother> create() override;
   };
+
+  class NodalBlockSmootherFactory : public SmootherFactoryBase
+  {
+   public:
+    Teuchos::RCP<GenericSmoother> create() override;
+  };
 }  // namespace Core::LinearSolver::AMGNxN
 
 FOUR_C_NAMESPACE_CLOSE
@@ -65,7 +65,16 @@ namespace Core::LinearSolver
     multigrid_muelu_contactsp,  ///< multigrid preconditioner for blocked contact problems in saddle
                                 ///< point formulation (MueLu package)
     multigrid_nxn,  ///< multigrid preconditioner for a nxn block matrix (indirectly MueLu package)
-    block_teko      ///< block preconditioning (Teko package, recommended!)
+    block_teko,     ///< block preconditioning (Teko package, recommended!)
+    nodal_block     ///< relaxation with dense nodal blocks (coupled multi-dof nodes)
+  };
+
+  //! Parts of a MueLu multigrid hierarchy that are kept when the preconditioner is recomputed
+  enum class MueLuReuse
+  {
+    none,                   ///< rebuild the whole hierarchy
+    tentative_prolongator,  ///< keep aggregates and tentative prolongators
+    prolongator  ///< keep prolongators and restrictions, only recompute RAP and smoothers
   };
 
   /// linear solver type base class
@@ -91,6 +100,10 @@ namespace Core::LinearSolver
 
     virtual int solve() = 0;
 
+    /// whether the solver holds a preconditioner that reuses parts of its setup for new matrices
+    /// and should therefore not be destroyed by a reset
+    virtual bool reuses_preconditioner_setup() const { return false; }
+
     /// return number of iterations performed by solver
     virtual int get_num_iters() const
     {
@@ -11,6 +11,7 @@
 #include "4C_linear_solver_preconditioner_ifpack.hpp"
 #include "4C_linear_solver_preconditioner_krylovprojection.hpp"
 #include "4C_linear_solver_preconditioner_muelu.hpp"
+#include "4C_linear_solver_preconditioner_nodal_block.hpp"
 #include "4C_linear_solver_preconditioner_teko.hpp"
 #include "4C_utils_exceptions.hpp"
 
@@ -27,6 +28,8 @@
 #include <Teuchos_TimeMonitor.hpp>
 #include <Teuchos_XMLParameterListHelpers.hpp>
 
+#include <algorithm>
+
 FOUR_C_NAMESPACE_OPEN
 
 using BelosVectorType = Epetra_MultiVector;
@@ -55,7 +58,14 @@ void Core::LinearSolver::IterativeSolver<MatrixType, VectorType>::setup(
   if (create)
   {
     ncall_ = 0;
-    preconditioner_ = create_preconditioner(belist, projector);
+
+    // preconditioners reusing their setup are only replaced if the convergence degraded
+    if (preconditioner_ == nullptr or not preconditioner_->reuses_setup() or
+        recreate_preconditioner_)
+    {
+      preconditioner_ = create_preconditioner(belist, projector);
+      recreate_preconditioner_ = false;
+    }
   }
 
   a_ = A;
@@ -63,6 +73,9 @@ void Core::LinearSolver::IterativeSolver<MatrixType, VectorType>::setup(
   b_ = b;
 
   preconditioner_->setup(create, a_.get(), x_.get(), b_.get());
+
+  // the first solve after a setup from scratch is the reference for the later reused setups
+  if (create and preconditioner_->rebuilt_setup()) numiters_after_creation_ = -1;
 }
 
 //----------------------------------------------------------------------------------
@@ -169,6 +182,19 @@ int Core::LinearSolver::IterativeSolver<MatrixType, VectorType>::solve()
 
   numiters_ = newSolver->getNumIters();
 
+  // a reused preconditioner setup is dropped if the solver does not converge anymore or needs
+  // considerably more iterations than with the freshly created preconditioner
+  if (preconditioner_ != nullptr and preconditioner_->reuses_setup())
+  {
+    if (glob_error > 0)
+      recreate_preconditioner_ = true;
+    else if (numiters_after_creation_ < 0)
+      numiters_after_creation_ = numiters_;
+    else if (numiters_ > belist.get<double>("reuse: max iteration ratio", 2.0) *
+                             std::max(numiters_after_creation_, 1))
+      recreate_preconditioner_ = true;
+  }
+
   ncall_ += 1;
 
   return 0;
@@ -237,6 +263,11 @@ Core::LinearSolver::IterativeSolver<MatrixType, VectorType>::create_precondition
   {
     preconditioner = std::make_shared<Core::LinearSolver::AmGnxnPreconditioner>(params());
   }
+  else if (params().isSublist("Nodal Block Parameters"))
+  {
+    preconditioner = std::make_shared<Core::LinearSolver::NodalBlockPreconditioner>(
+        params().sublist("Nodal Block Parameters"));
+  }
   else
     FOUR_C_THROW("Unknown preconditioner chosen for iterative linear solver.");
 
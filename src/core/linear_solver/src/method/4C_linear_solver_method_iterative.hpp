@@ -50,8 +50,20 @@ namespace Core::LinearSolver
     //! return number of iterations
     int get_num_iters() const override { return numiters_; };
 
+    //! whether the current preconditioner keeps parts of its setup for new matrices
+    bool reuses_preconditioner_setup() const override
+    {
+      return preconditioner_ != nullptr and preconditioner_->reuses_setup();
+    }
+
     Teuchos::ParameterList& params() const { return params_; }
 
+    //! return the current preconditioner (nullptr before the first setup)
+    std::shared_ptr<const Core::LinearSolver::PreconditionerTypeBase> preconditioner() const
+    {
+      return preconditioner_;
+    }
+
    private:
     /*! \brief Check whether preconditioner will be reused
      *
@@ -99,6 +111,12 @@ namespace Core::LinearSolver
     //! number of iterations
     int numiters_{-1};
 
+    //! number of iterations of the first solve after the preconditioner was built from scratch
+    int numiters_after_creation_{-1};
+
+    //! force the recreation of a preconditioner that reuses its setup
+    bool recreate_preconditioner_{false};
+
     //! preconditioner object
     std::shared_ptr<Core::LinearSolver::PreconditionerTypeBase> preconditioner_;
 
@@ -166,11 +166,12 @@ void Core::LinAlg::Solver::setup(std::shared_ptr<Epetra_Operator> matrix,
     set_tolerance(params.tolerance);
   }
 
-  // reset data flags on demand
+  // reset data flags on demand, a preconditioner reusing its setup is kept and decides itself
+  // whether its setup has to be rebuilt for the new matrix
   bool refactor = params.refactor;
   if (params.reset)
   {
-    reset();
+    if (solver_ == nullptr or not solver_->reuses_preconditioner_setup()) reset();
     refactor = true;
   }
 
@@ -256,6 +257,9 @@ Teuchos::ParameterList translate_four_c_to_muelu(
   std::string xmlfile = inparams.get<std::string>("MUELU_XML_FILE");
   if (xmlfile != "none") muelulist.set("MUELU_XML_FILE", xmlfile);
 
+  muelulist.set("MUELU_REUSE",
+      Teuchos::getIntegralValue<Core::LinearSolver::MueLuReuse>(inparams, "MUELU_REUSE"));
+
   return muelulist;
 }
 
@@ -269,6 +273,8 @@ Teuchos::ParameterList translate_four_c_to_teko(
   std::string xmlfile = inparams.get<std::string>("TEKO_XML_FILE");
   if (xmlfile != "none") tekolist.set("TEKO_XML_FILE", xmlfile);
 
+  tekolist.set("TEKO_REUSE", inparams.get<bool>("TEKO_REUSE"));
+
   return tekolist;
 }
 
@@ -350,6 +356,12 @@ Teuchos::ParameterList translate_four_c_to_belos(const Teuchos::ParameterList& i
   const auto azprectype =
       Teuchos::getIntegralValue<Core::LinearSolver::PreconditionerType>(inparams, "AZPREC");
 
+  // the reused setup of the preconditioner is discarded once the iterations exceed this ratio
+  if (azprectype == Core::LinearSolver::PreconditionerType::block_teko)
+    beloslist.set("reuse: max iteration ratio", inparams.get<double>("TEKO_REUSE_ITER_RATIO"));
+  else
+    beloslist.set("reuse: max iteration ratio", inparams.get<double>("MUELU_REUSE_ITER_RATIO"));
+
   switch (azprectype)
   {
     case Core::LinearSolver::PreconditionerType::ilu:
@@ -367,6 +379,9 @@ Teuchos::ParameterList translate_four_c_to_belos(const Teuchos::ParameterList& i
     case Core::LinearSolver::PreconditionerType::block_teko:
       beloslist.set("Preconditioner Type", "Teko");
       break;
+    case Core::LinearSolver::PreconditionerType::nodal_block:
+      beloslist.set("Preconditioner Type", "NodalBlock");
+      break;
     default:
       FOUR_C_THROW("Unknown preconditioner for Belos");
       break;
@@ -395,6 +410,14 @@ Teuchos::ParameterList translate_four_c_to_belos(const Teuchos::ParameterList& i
     Teuchos::ParameterList& tekolist = outparams.sublist("Teko Parameters");
     tekolist = translate_four_c_to_teko(inparams, &beloslist);
   }
+  if (azprectype == Core::LinearSolver::PreconditionerType::nodal_block)
+  {
+    Teuchos::ParameterList& nodalblocklist = outparams.sublist("Nodal Block Parameters");
+    nodalblocklist.set("block size", inparams.get<int>("NODALBLOCK_SIZE"));
+    nodalblocklist.set("relaxation: type", inparams.get<std::string>("NODALBLOCK_TYPE"));
+    nodalblocklist.set("relaxation: sweeps", inparams.get<int>("NODALBLOCK_SWEEPS"));
+    nodalblocklist.set("relaxation: damping factor", inparams.get<double>("NODALBLOCK_DAMPING"));
+  }
   if (azprectype == Core::LinearSolver::PreconditionerType::multigrid_nxn)
   {
     Teuchos::ParameterList& amgnxnlist = outparams.sublist("AMGnxn Parameters");
@@ -46,7 +46,8 @@ namespace Core::LinAlg
     //! system should be refactorized
     bool refactor = false;
 
-    //! data from previous solves should be recalculated including preconditioners
+    //! data from previous solves should be recalculated including preconditioners, preconditioners
+    //! reusing their setup are kept and decide themselves whether to rebuild it
     bool reset = false;
 
     //! Krylov space projector
@@ -37,13 +37,68 @@ using LO = LocalOrdinal;
 using GO = GlobalOrdinal;
 using NO = Node;
 
+namespace
+{
+  //! requested reuse of the multigrid setup from the sublist @p sublist of @p muelulist
+  Core::LinearSolver::MueLuReuse get_reuse(
+      const Teuchos::ParameterList& muelulist, const std::string& sublist)
+  {
+    if (!muelulist.isSublist(sublist) or !muelulist.sublist(sublist).isParameter("MUELU_REUSE"))
+      return Core::LinearSolver::MueLuReuse::none;
+
+    return muelulist.sublist(sublist).get<Core::LinearSolver::MueLuReuse>("MUELU_REUSE");
+  }
+
+  //! request the reuse of the multigrid setup in a MueLu parameter list
+  void set_reuse_type(Teuchos::ParameterList& muelu_params, Core::LinearSolver::MueLuReuse reuse)
+  {
+    // parameter lists in factory format define the reuse by keep flags of the single factories
+    if (reuse == Core::LinearSolver::MueLuReuse::none or muelu_params.isSublist("Hierarchy"))
+      return;
+
+    const std::string reuse_type =
+        reuse == Core::LinearSolver::MueLuReuse::tentative_prolongator ? "tP" : "RP";
+    muelu_params.set("reuse: type", reuse_type);
+  }
+}  // namespace
+
 //----------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------
 Core::LinearSolver::MueLuPreconditioner::MueLuPreconditioner(Teuchos::ParameterList& muelulist)
-    : muelulist_(muelulist)
+    : muelulist_(muelulist), reuse_(get_reuse(muelulist, "MueLu Parameters"))
 {
 }
 
+//----------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------
+void Core::LinearSolver::MueLuPreconditioner::store_graphs(
+    const std::vector<std::shared_ptr<Epetra_CrsMatrix>>& matrices)
+{
+  setup_graphs_.clear();
+  for (const auto& matrix : matrices)
+  {
+    setup_graphs_.emplace_back(GraphInfo{
+        std::make_shared<Epetra_Map>(matrix->RowMap()), matrix->NumGlobalNonzeros64()});
+  }
+}
+
+//----------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------
+bool Core::LinearSolver::MueLuPreconditioner::graphs_changed(
+    const std::vector<std::shared_ptr<Epetra_CrsMatrix>>& matrices) const
+{
+  if (matrices.size() != setup_graphs_.size()) return true;
+
+  for (std::size_t i = 0; i < matrices.size(); ++i)
+  {
+    if (!matrices[i]->RowMap().SameAs(*setup_graphs_[i].row_map) or
+        matrices[i]->NumGlobalNonzeros64() != setup_graphs_[i].num_global_nonzeros)
+      return true;
+  }
+
+  return false;
+}
+
 //----------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------
 void Core::LinearSolver::MueLuPreconditioner::setup(bool create, Epetra_Operator* matrix,
@@ -71,6 +126,19 @@ void Core::LinearSolver::MueLuPreconditioner::setup(bool create, Epetra_Operator
 
       Teuchos::ParameterList& inverseList = muelulist_.sublist("MueLu Parameters");
 
+      const int number_of_equations = inverseList.get<int>("PDE equations");
+      pmatrix_->SetFixedBlockSize(number_of_equations);
+
+      // only the values of the matrix changed, so update the existing hierarchy
+      const std::vector<std::shared_ptr<Epetra_CrsMatrix>> matrices = {
+          Teuchos::get_shared_ptr(crsA)};
+      if (reuse_ != MueLuReuse::none and !H_.is_null() and !graphs_changed(matrices))
+      {
+        MueLu::ReuseXpetraPreconditioner(pmatrix_, H_);
+        rebuilt_setup_ = false;
+        return;
+      }
+
       std::string xmlFileName = inverseList.get<std::string>("MUELU_XML_FILE");
       if (xmlFileName == "none") FOUR_C_THROW("MUELU_XML_FILE parameter not set!");
 
@@ -78,9 +146,7 @@ void Core::LinearSolver::MueLuPreconditioner::setup(bool create, Epetra_Operator
           Teuchos::make_rcp<Teuchos::ParameterList>();
       auto comm = pmatrix_->getRowMap()->getComm();
       Teuchos::updateParametersFromXmlFileAndBroadcast(xmlFileName, muelu_params.ptr(), *comm);
-
-      const int number_of_equations = inverseList.get<int>("PDE equations");
-      pmatrix_->SetFixedBlockSize(number_of_equations);
+      set_reuse_type(*muelu_params, reuse_);
 
       Teuchos::RCP<const Xpetra::Map<LO, GO, NO>> row_map = mueluA->getRowMap();
       Teuchos::RCP<Xpetra::MultiVector<SC, LO, GO, NO>> nullspace =
@@ -99,6 +165,9 @@ void Core::LinearSolver::MueLuPreconditioner::setup(bool create, Epetra_Operator
 
       H_ = MueLu::CreateXpetraPreconditioner(pmatrix_, *muelu_params);
       P_ = Teuchos::make_rcp<MueLu::EpetraOperator>(H_);
+
+      store_graphs(matrices);
+      rebuilt_setup_ = true;
     }
     else
     {
@@ -147,6 +216,21 @@ void Core::LinearSolver::MueLuPreconditioner::setup(bool create, Epetra_Operator
       bOp->fillComplete();
       pmatrix_ = bOp;
 
+      // only the values of the blocks changed, so update the existing hierarchy
+      std::vector<std::shared_ptr<Epetra_CrsMatrix>> matrices;
+      for (int row = 0; row < A->rows(); row++)
+        for (int col = 0; col < A->cols(); col++)
+          matrices.emplace_back(A->matrix(row, col).epetra_matrix());
+
+      if (reuse_ != MueLuReuse::none and !H_.is_null() and !graphs_changed(matrices))
+      {
+        H_->GetLevel(0)->Set(
+            "A", Teuchos::rcp_dynamic_cast<Xpetra::Matrix<SC, LO, GO, NO>>(pmatrix_));
+        H_->SetupRe();
+        rebuilt_setup_ = false;
+        return;
+      }
+
       if (!muelulist_.sublist("MueLu Parameters").isParameter("MUELU_XML_FILE"))
         FOUR_C_THROW("MUELU_XML_FILE parameter not set!");
 
@@ -156,8 +240,9 @@ void Core::LinearSolver::MueLuPreconditioner::setup(bool create, Epetra_Operator
           Teuchos::make_rcp<Teuchos::ParameterList>();
       auto comm = pmatrix_->getRowMap()->getComm();
       Teuchos::updateParametersFromXmlFileAndBroadcast(xmlFileName, mueluParams.ptr(), *comm);
+      set_reuse_type(*mueluParams, reuse_);
 
-      MueLu::ParameterListInterpreter<SC, LO, GO, NO> mueLuFactory(xmlFileName, *comm);
+      MueLu::ParameterListInterpreter<SC, LO, GO, NO> mueLuFactory(*mueluParams, comm);
       Teuchos::RCP<MueLu::Hierarchy<SC, LO, GO, NO>> H = mueLuFactory.CreateHierarchy();
       H->GetLevel(0)->Set("A", Teuchos::rcp_dynamic_cast<Xpetra::Matrix<SC, LO, GO, NO>>(pmatrix_));
 
@@ -178,6 +263,10 @@ void Core::LinearSolver::MueLuPreconditioner::setup(bool create, Epetra_Operator
       mueLuFactory.SetupHierarchy(*H);
 
       P_ = Teuchos::make_rcp<MueLu::EpetraOperator>(H);
+      H_ = H;
+
+      store_graphs(matrices);
+      rebuilt_setup_ = true;
     }
   }
 }
@@ -188,6 +277,7 @@ Core::LinearSolver::MueLuContactSpPreconditioner::MueLuContactSpPreconditioner(
     Teuchos::ParameterList& muelulist)
     : MueLuPreconditioner(muelulist)
 {
+  reuse_ = get_reuse(muelulist, "MueLu (Contact) Parameters");
 }
 
 //----------------------------------------------------------------------------------
@@ -380,6 +470,21 @@ void Core::LinearSolver::MueLuContactSpPreconditioner::setup(bool create, Epetra
         myA21->getColMap("stridedMaps"), true);
   }
 
+  // only the values of the blocks changed, so update the existing hierarchy
+  const std::vector<std::shared_ptr<Epetra_CrsMatrix>> matrices = {A->matrix(0, 0).epetra_matrix(),
+      A->matrix(0, 1).epetra_matrix(), A->matrix(1, 0).epetra_matrix(),
+      A->matrix(1, 1).epetra_matrix()};
+  if (create and reuse_ != MueLuReuse::none and !H_.is_null() and !graphs_changed(matrices))
+  {
+    H_->setlib(Xpetra::UseEpetra);
+    H_->GetLevel(0)->Set("A", Teuchos::rcp_dynamic_cast<Xpetra::Matrix<SC, LO, GO, NO>>(bOp, true));
+    H_->SetupRe();
+
+    P_ = Teuchos::make_rcp<MueLu::EpetraOperator>(H_);
+    rebuilt_setup_ = false;
+    return;
+  }
+
   // Re-create or re-use the preconditioner?
   if (create)
   {
@@ -397,6 +502,7 @@ void Core::LinearSolver::MueLuContactSpPreconditioner::setup(bool create, Epetra
     MueLu::ParameterList mueluParams;
     Teuchos::updateParametersFromXmlFileAndBroadcast(
         xml_file, Teuchos::Ptr<MueLu::ParameterList>(&mueluParams), *comm);
+    set_reuse_type(mueluParams, reuse_);
 
     // Get/compute nullspace vectors
     Teuchos::RCP<Xpetra::MultiVector<SC, LO, GO, NO>> nullspace11 = Teuchos::null;
@@ -445,6 +551,9 @@ void Core::LinearSolver::MueLuContactSpPreconditioner::setup(bool create, Epetra
 
     // store multigrid hierarchy
     H_ = H;
+
+    store_graphs(matrices);
+    rebuilt_setup_ = true;
   }
   else
   {
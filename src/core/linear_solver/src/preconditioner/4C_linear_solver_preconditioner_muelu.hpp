@@ -11,12 +11,16 @@
 #include "4C_config.hpp"
 
 #include "4C_linalg_blocksparsematrix.hpp"
+#include "4C_linear_solver_method.hpp"
 #include "4C_linear_solver_preconditioner_type.hpp"
 
 #include <MueLu_Hierarchy.hpp>
 #include <MueLu_UseDefaultTypes.hpp>
 #include <Xpetra_MultiVector.hpp>
 
+#include <memory>
+#include <vector>
+
 FOUR_C_NAMESPACE_OPEN
 
 namespace Core::LinearSolver
@@ -46,6 +50,9 @@ namespace Core::LinearSolver
      * it re-uses the existing preconditioner and only updates the fine level matrix
      * for the Krylov solver.
      *
+     * If reuse of the multigrid setup is requested (MUELU_REUSE), re-creating the preconditioner
+     * for a matrix with unchanged graph only updates the existing hierarchy.
+     *
      * It maintains backward compatibility to the ML interface!
      *
      * @param create Boolean flag to enforce (re-)creation of the preconditioner
@@ -62,6 +69,12 @@ namespace Core::LinearSolver
       return Core::Utils::shared_ptr_from_ref(*P_);
     }
 
+    //! the hierarchy is updated instead of recreated if reuse of the multigrid setup is requested
+    bool reuses_setup() const final { return reuse_ != MueLuReuse::none; }
+
+    //! whether the last setup built a new hierarchy, e.g. because the graph changed
+    bool rebuilt_setup() const final { return rebuilt_setup_; }
+
    private:
     //! system of equations used for preconditioning used by P_ only
     Teuchos::RCP<Xpetra::Matrix<Scalar, LocalOrdinal, GlobalOrdinal, Node>> pmatrix_;
@@ -76,6 +89,29 @@ namespace Core::LinearSolver
     //! MueLu hierarchy
     Teuchos::RCP<MueLu::Hierarchy<Scalar, LocalOrdinal, GlobalOrdinal, Node>> H_;
 
+    //! parts of the multigrid hierarchy that are kept when the preconditioner is recomputed
+    MueLuReuse reuse_;
+
+    //! whether the last setup built a new hierarchy instead of updating the existing one
+    bool rebuilt_setup_{true};
+
+    //! store the graphs of the @p matrices the hierarchy was built for
+    void store_graphs(const std::vector<std::shared_ptr<Epetra_CrsMatrix>>& matrices);
+
+    //! whether the graph of any of the @p matrices differs from the one stored at the last setup
+    bool graphs_changed(const std::vector<std::shared_ptr<Epetra_CrsMatrix>>& matrices) const;
+
+   private:
+    //! row map and number of nonzeros of a matrix the hierarchy was built for
+    struct GraphInfo
+    {
+      std::shared_ptr<Epetra_Map> row_map;
+      long long num_global_nonzeros;
+    };
+
+    //! graphs of the matrices the hierarchy was built for
+    std::vector<GraphInfo> setup_graphs_;
+
   };  // class MueLuPreconditioner
 
   /*! \brief MueLu preconditioner for blocked linear systems of equations for contact problems
@@ -107,6 +143,9 @@ namespace Core::LinearSolver
      * it re-uses the existing preconditioner and only updates the fine level matrix
      * for the Krylov solver.
      *
+     * If reuse of the multigrid setup is requested (MUELU_REUSE), re-creating the preconditioner
+     * for blocks with unchanged graphs only updates the existing hierarchy.
+     *
      * @param create Boolean flag to enforce (re-)creation of the preconditioner
      * @param matrix BlockSparseMatrix to be used as input for the preconditioner
      * @param x Solution of the linear system
@@ -0,0 +1,287 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_linear_solver_preconditioner_nodal_block.hpp"
+
+#include "4C_linalg_blocksparsematrix.hpp"
+#include "4C_linalg_serialdensematrix.hpp"
+#include "4C_utils_parameter_list.hpp"
+
+#include <Teuchos_SerialDenseSolver.hpp>
+
+FOUR_C_NAMESPACE_OPEN
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+Core::LinearSolver::NodalBlockRelaxationType
+Core::LinearSolver::string_to_nodal_block_relaxation_type(const std::string& name)
+{
+  if (name == "Jacobi")
+    return NodalBlockRelaxationType::jacobi;
+  else if (name == "Gauss-Seidel")
+    return NodalBlockRelaxationType::gauss_seidel;
+  else if (name == "symmetric Gauss-Seidel")
+    return NodalBlockRelaxationType::symmetric_gauss_seidel;
+
+  FOUR_C_THROW(
+      "Unknown nodal block relaxation type '%s'. Choose 'Jacobi', 'Gauss-Seidel' or 'symmetric "
+      "Gauss-Seidel'.",
+      name.c_str());
+}
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+Core::LinearSolver::NodalBlockRelaxation::NodalBlockRelaxation(
+    std::shared_ptr<const Epetra_CrsMatrix> A, const int block_size,
+    const NodalBlockRelaxationType type, const int sweeps, const double damping)
+    : a_(std::move(A)), block_size_(block_size), type_(type), sweeps_(sweeps), damping_(damping)
+{
+  if (block_size_ < 1)
+    FOUR_C_THROW("The nodal block size has to be positive, got %d.", block_size_);
+  if (sweeps_ < 1) FOUR_C_THROW("At least one relaxation sweep is required, got %d.", sweeps_);
+}
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+void Core::LinearSolver::NodalBlockRelaxation::setup()
+{
+  if (not a_->Filled()) FOUR_C_THROW("The matrix has to be filled for the nodal block smoother.");
+
+  const Epetra_Map& rowmap = a_->RowMap();
+  const Epetra_Map& colmap = a_->ColMap();
+  const int numrows = a_->NumMyRows();
+  const int bs = block_size_;
+
+  if (numrows % bs != 0)
+  {
+    FOUR_C_THROW("The number of local rows (%d) is not a multiple of the nodal block size (%d).",
+        numrows, bs);
+  }
+  num_nodes_ = numrows / bs;
+
+  row_to_col_.resize(numrows);
+  for (int row = 0; row < numrows; ++row)
+  {
+    row_to_col_[row] = colmap.LID(rowmap.GID(row));
+    if (row_to_col_[row] < 0)
+      FOUR_C_THROW("Row %d is not part of the column map of the matrix.", rowmap.GID(row));
+  }
+
+  std::vector<int> col_to_row(colmap.NumMyElements());
+  for (int col = 0; col < colmap.NumMyElements(); ++col)
+    col_to_row[col] = rowmap.LID(colmap.GID(col));
+
+  // extract and invert the diagonal block of each node
+  inv_blocks_.assign(num_nodes_ * bs * bs, 0.0);
+  Core::LinAlg::SerialDenseMatrix block(bs, bs);
+  for (int node = 0; node < num_nodes_; ++node)
+  {
+    block.putScalar(0.0);
+    for (int r = 0; r < bs; ++r)
+    {
+      int numentries;
+      double* values;
+      int* indices;
+      a_->ExtractMyRowView(node * bs + r, numentries, values, indices);
+      for (int entry = 0; entry < numentries; ++entry)
+      {
+        const int row = col_to_row[indices[entry]];
+        if (row >= 0 and row / bs == node) block(r, row - node * bs) += values[entry];
+      }
+    }
+
+    Teuchos::SerialDenseSolver<int, double> solver;
+    solver.setMatrix(Teuchos::rcpFromRef(block));
+    if (solver.invert() != 0)
+      FOUR_C_THROW("The nodal block starting at row %d is singular.", rowmap.GID(node * bs));
+
+    double* inv = &inv_blocks_[node * bs * bs];
+    for (int r = 0; r < bs; ++r)
+      for (int c = 0; c < bs; ++c) inv[r * bs + c] = block(r, c);
+  }
+
+  if (colmap.SameAs(rowmap))
+    importer_ = nullptr;
+  else
+    importer_ = std::make_shared<Epetra_Import>(colmap, rowmap);
+
+  ycol_ = nullptr;
+  res_.resize(2 * bs);
+  is_setup_ = true;
+}
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+template <int fixed_block_size>
+void Core::LinearSolver::NodalBlockRelaxation::sweep(
+    const double* x, double* y, double* ycol, const bool forward, const bool update_col) const
+{
+  // the block size is a compile time constant for the common cases to unroll the kernels
+  const int bs = fixed_block_size > 0 ? fixed_block_size : block_size_;
+
+  double* res = res_.data();
+  double* dy = res_.data() + bs;
+
+  for (int i = 0; i < num_nodes_; ++i)
+  {
+    const int node = forward ? i : num_nodes_ - 1 - i;
+
+    // residual of the node
+    for (int r = 0; r < bs; ++r)
+    {
+      const int row = node * bs + r;
+      int numentries;
+      double* values;
+      int* indices;
+      a_->ExtractMyRowView(row, numentries, values, indices);
+
+      double sum = x[row];
+      for (int entry = 0; entry < numentries; ++entry) sum -= values[entry] * ycol[indices[entry]];
+      res[r] = sum;
+    }
+
+    // correction with the inverted nodal block
+    const double* inv = &inv_blocks_[node * bs * bs];
+    for (int r = 0; r < bs; ++r)
+    {
+      double sum = 0.0;
+      for (int c = 0; c < bs; ++c) sum += inv[r * bs + c] * res[c];
+      dy[r] = damping_ * sum;
+    }
+
+    for (int r = 0; r < bs; ++r)
+    {
+      const int row = node * bs + r;
+      y[row] += dy[r];
+      if (update_col) ycol[row_to_col_[row]] = y[row];
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+void Core::LinearSolver::NodalBlockRelaxation::sweep_dispatch(
+    const double* x, double* y, double* ycol, const bool forward, const bool update_col) const
+{
+  switch (block_size_)
+  {
+    case 1:
+      sweep<1>(x, y, ycol, forward, update_col);
+      break;
+    case 2:
+      sweep<2>(x, y, ycol, forward, update_col);
+      break;
+    case 3:
+      sweep<3>(x, y, ycol, forward, update_col);
+      break;
+    case 4:
+      sweep<4>(x, y, ycol, forward, update_col);
+      break;
+    case 6:
+      sweep<6>(x, y, ycol, forward, update_col);
+      break;
+    default:
+      sweep<0>(x, y, ycol, forward, update_col);
+      break;
+  }
+}
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+void Core::LinearSolver::NodalBlockRelaxation::apply(
+    const Epetra_MultiVector& X, Epetra_MultiVector& Y, const bool InitialGuessIsZero) const
+{
+  if (not is_setup_) FOUR_C_THROW("The nodal block smoother has to be set up before applying it.");
+
+  // X and Y might be the same vector
+  std::shared_ptr<const Epetra_MultiVector> Xcopy;
+  if (X.Values() == Y.Values()) Xcopy = std::make_shared<Epetra_MultiVector>(X);
+  const Epetra_MultiVector& Xsafe = Xcopy ? *Xcopy : X;
+
+  const int numvec = X.NumVectors();
+  if (ycol_ == nullptr or ycol_->NumVectors() != numvec)
+    ycol_ = std::make_shared<Epetra_MultiVector>(a_->ColMap(), numvec, false);
+
+  if (InitialGuessIsZero) Y.PutScalar(0.0);
+
+  for (int isweep = 0; isweep < sweeps_; ++isweep)
+  {
+    // current iterate including the values of the neighboring processors
+    if (isweep == 0 and InitialGuessIsZero)
+      ycol_->PutScalar(0.0);
+    else if (importer_ != nullptr)
+      ycol_->Import(Y, *importer_, Insert);
+    else
+      ycol_->Update(1.0, Y, 0.0);
+
+    for (int k = 0; k < numvec; ++k)
+    {
+      switch (type_)
+      {
+        case NodalBlockRelaxationType::jacobi:
+          sweep_dispatch(Xsafe[k], Y[k], (*ycol_)[k], true, false);
+          break;
+        case NodalBlockRelaxationType::gauss_seidel:
+          sweep_dispatch(Xsafe[k], Y[k], (*ycol_)[k], true, true);
+          break;
+        case NodalBlockRelaxationType::symmetric_gauss_seidel:
+          sweep_dispatch(Xsafe[k], Y[k], (*ycol_)[k], true, true);
+          sweep_dispatch(Xsafe[k], Y[k], (*ycol_)[k], false, true);
+          break;
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+int Core::LinearSolver::NodalBlockRelaxation::ApplyInverse(
+    const Epetra_MultiVector& X, Epetra_MultiVector& Y) const
+{
+  apply(X, Y, true);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+Core::LinearSolver::NodalBlockPreconditioner::NodalBlockPreconditioner(
+    Teuchos::ParameterList& params)
+    : params_(params)
+{
+}
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+void Core::LinearSolver::NodalBlockPreconditioner::setup(bool create, Epetra_Operator* matrix,
+    Core::LinAlg::MultiVector<double>* x, Core::LinAlg::MultiVector<double>* b)
+{
+  if (create)
+  {
+    std::shared_ptr<Epetra_CrsMatrix> A_crs =
+        std::dynamic_pointer_cast<Epetra_CrsMatrix>(Core::Utils::shared_ptr_from_ref(*matrix));
+
+    if (!A_crs)
+    {
+      std::shared_ptr<Core::LinAlg::BlockSparseMatrixBase> A =
+          std::dynamic_pointer_cast<Core::LinAlg::BlockSparseMatrixBase>(
+              Core::Utils::shared_ptr_from_ref(*matrix));
+
+      std::cout << "\n WARNING: nodal block preconditioner is merging matrix, this is very "
+                   "expensive! \n";
+      A_crs = A->merge()->epetra_matrix();
+    }
+
+    pmatrix_ = std::make_shared<Epetra_CrsMatrix>(*A_crs);
+
+    prec_ = std::make_shared<NodalBlockRelaxation>(pmatrix_, params_.get<int>("block size"),
+        string_to_nodal_block_relaxation_type(params_.get<std::string>("relaxation: type")),
+        params_.get<int>("relaxation: sweeps"), params_.get<double>("relaxation: damping factor"));
+    prec_->setup();
+  }
+}
+
+FOUR_C_NAMESPACE_CLOSE
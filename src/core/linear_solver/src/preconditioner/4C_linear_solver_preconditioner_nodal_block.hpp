@@ -0,0 +1,176 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_LINEAR_SOLVER_PRECONDITIONER_NODAL_BLOCK_HPP
+#define FOUR_C_LINEAR_SOLVER_PRECONDITIONER_NODAL_BLOCK_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_linear_solver_preconditioner_type.hpp"
+#include "4C_utils_exceptions.hpp"
+
+#include <Epetra_Import.h>
+#include <Epetra_MultiVector.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Core::LinearSolver
+{
+  //! relaxation scheme of the nodal block smoother
+  enum class NodalBlockRelaxationType
+  {
+    jacobi,                 ///< block Jacobi
+    gauss_seidel,           ///< forward block Gauss-Seidel
+    symmetric_gauss_seidel  ///< forward and backward block Gauss-Seidel
+  };
+
+  //! convert the name of a relaxation scheme (Ifpack naming) to its type
+  NodalBlockRelaxationType string_to_nodal_block_relaxation_type(const std::string& name);
+
+  /*! \brief Relaxation with dense nodal blocks of a point matrix
+   *
+   *  In coupled problems (poroelasticity, TSI, SSI, ...) every node carries a few strongly coupled
+   *  dofs. Point smoothers only invert the diagonal entries and therefore treat these couplings
+   *  explicitly. This smoother extracts the dense diagonal block of every node, inverts it once
+   *  during setup and applies the inverses with fixed-size kernels for the common block sizes.
+   *
+   *  The dofs of a node are expected to be consecutive in the local row map and all nodes carry
+   *  the same number of dofs. Gauss-Seidel sweeps are processor-local (hybrid Jacobi between
+   *  processors), as for the Ifpack point relaxation.
+   */
+  class NodalBlockRelaxation : virtual public Epetra_Operator
+  {
+   public:
+    NodalBlockRelaxation(std::shared_ptr<const Epetra_CrsMatrix> A, int block_size,
+        NodalBlockRelaxationType type, int sweeps, double damping);
+
+    //! extract and invert the nodal blocks
+    void setup();
+
+    //! relaxation sweeps for A Y = X, the initial guess Y is ignored if InitialGuessIsZero
+    void apply(const Epetra_MultiVector& X, Epetra_MultiVector& Y, bool InitialGuessIsZero) const;
+
+    //! relaxation sweeps with zero initial guess
+    int ApplyInverse(const Epetra_MultiVector& X, Epetra_MultiVector& Y) const override;
+
+    int SetUseTranspose(bool UseTranspose) override
+    {
+      // default to false
+      return 0;
+    }
+
+    int Apply(const Epetra_MultiVector& X, Epetra_MultiVector& Y) const override
+    {
+      FOUR_C_THROW("Function not implemented");
+      return -1;
+    }
+
+    double NormInf() const override
+    {
+      FOUR_C_THROW("Function not implemented");
+      return -1.0;
+    }
+
+    const char* Label() const override { return "NodalBlockRelaxation"; }
+
+    bool UseTranspose() const override
+    {
+      // default to false
+      return false;
+    }
+
+    bool HasNormInf() const override { return false; }
+
+    const Epetra_Comm& Comm() const override { return a_->Comm(); }
+
+    const Epetra_Map& OperatorDomainMap() const override { return a_->OperatorDomainMap(); }
+
+    const Epetra_Map& OperatorRangeMap() const override { return a_->OperatorRangeMap(); }
+
+   private:
+    /*! \brief one relaxation sweep over all local nodes of a single vector
+     *
+     *  The residual is computed with the iterate ycol in the column map. For Gauss-Seidel
+     *  (update_col) the new values are written back to ycol immediately.
+     */
+    template <int fixed_block_size>
+    void sweep(const double* x, double* y, double* ycol, bool forward, bool update_col) const;
+
+    //! dispatch to the fixed-size kernel of the block size
+    void sweep_dispatch(
+        const double* x, double* y, double* ycol, bool forward, bool update_col) const;
+
+    //! system matrix
+    std::shared_ptr<const Epetra_CrsMatrix> a_;
+
+    //! number of dofs per node
+    const int block_size_;
+
+    //! relaxation scheme
+    const NodalBlockRelaxationType type_;
+
+    //! number of sweeps
+    const int sweeps_;
+
+    //! damping factor
+    const double damping_;
+
+    //! number of local nodes
+    int num_nodes_ = 0;
+
+    //! inverted nodal blocks, stored row-wise one after the other
+    std::vector<double> inv_blocks_;
+
+    //! column map index of each local row
+    std::vector<int> row_to_col_;
+
+    //! importer from the row map to the column map (null if both are the same)
+    std::shared_ptr<Epetra_Import> importer_;
+
+    //! iterate in the column map
+    mutable std::shared_ptr<Epetra_MultiVector> ycol_;
+
+    //! residual of a single node
+    mutable std::vector<double> res_;
+
+    bool is_setup_ = false;
+  };
+
+  /*! \brief Standalone nodal block relaxation preconditioner
+   *
+   *  Applies NodalBlockRelaxation to the (merged) system matrix.
+   */
+  class NodalBlockPreconditioner : public PreconditionerTypeBase
+  {
+   public:
+    NodalBlockPreconditioner(Teuchos::ParameterList& params);
+
+    void setup(bool create, Epetra_Operator* matrix, Core::LinAlg::MultiVector<double>* x,
+        Core::LinAlg::MultiVector<double>* b) override;
+
+    /// linear operator used for preconditioning
+    std::shared_ptr<Epetra_Operator> prec_operator() const override { return prec_; }
+
+   private:
+    //! nodal block parameter list
+    Teuchos::ParameterList& params_;
+
+    //! system of equations used for preconditioning
+    std::shared_ptr<Epetra_CrsMatrix> pmatrix_;
+
+    //! preconditioner
+    std::shared_ptr<NodalBlockRelaxation> prec_;
+  };
+}  // namespace Core::LinearSolver
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
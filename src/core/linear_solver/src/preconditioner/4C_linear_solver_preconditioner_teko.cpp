@@ -7,6 +7,7 @@
 
 #include "4C_linear_solver_preconditioner_teko.hpp"
 
+#include "4C_comm_mpi_utils.hpp"
 #include "4C_comm_utils.hpp"
 #include "4C_linalg_sparsematrix.hpp"
 #include "4C_linalg_utils_sparse_algebra_manipulation.hpp"
@@ -19,15 +20,21 @@
 #include <Teko_InverseLibrary.hpp>
 #include <Teko_LU2x2PreconditionerFactory.hpp>
 #include <Teko_StratimikosFactory.hpp>
+#include <Teuchos_RCPStdSharedPtrConversions.hpp>
 #include <Teuchos_XMLParameterListHelpers.hpp>
+#include <Thyra_PreconditionerFactoryHelpers.hpp>
 #include <Xpetra_MultiVectorFactory.hpp>
 
+#include <algorithm>
+#include <map>
+
 FOUR_C_NAMESPACE_OPEN
 
 //----------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------
 Core::LinearSolver::TekoPreconditioner::TekoPreconditioner(Teuchos::ParameterList& tekolist)
-    : tekolist_(tekolist)
+    : tekolist_(tekolist),
+      reuse_(tekolist.sublist("Teko Parameters").get<bool>("TEKO_REUSE", false))
 {
 }
 
@@ -38,19 +45,10 @@ void Core::LinearSolver::TekoPreconditioner::setup(bool create, Epetra_Operator*
 {
   using EpetraMultiVector = Xpetra::EpetraMultiVectorT<GlobalOrdinal, Node>;
   using XpetraMultiVector = Xpetra::MultiVector<Scalar, LocalOrdinal, GlobalOrdinal, Node>;
+  using MultiVectorPtr = std::shared_ptr<Core::LinAlg::MultiVector<double>>;
 
   if (create)
   {
-    if (!tekolist_.sublist("Teko Parameters").isParameter("TEKO_XML_FILE"))
-      FOUR_C_THROW("TEKO_XML_FILE parameter not set!");
-    std::string xmlFileName =
-        tekolist_.sublist("Teko Parameters").get<std::string>("TEKO_XML_FILE");
-
-    Teuchos::ParameterList tekoParams;
-    auto comm = Core::Communication::to_teuchos_comm<int>(
-        Core::Communication::unpack_epetra_comm(matrix->Comm()));
-    Teuchos::updateParametersFromXmlFileAndBroadcast(xmlFileName, Teuchos::Ptr(&tekoParams), *comm);
-
     std::shared_ptr<Core::LinAlg::BlockSparseMatrixBase> A =
         std::dynamic_pointer_cast<Core::LinAlg::BlockSparseMatrixBase>(
             Core::Utils::shared_ptr_from_ref(*matrix));
@@ -67,13 +65,11 @@ void Core::LinearSolver::TekoPreconditioner::setup(bool create, Epetra_Operator*
             std::dynamic_pointer_cast<Epetra_CrsMatrix>(Core::Utils::shared_ptr_from_ref(*matrix));
         Core::LinAlg::SparseMatrix sparseA = Core::LinAlg::SparseMatrix(crsA, LinAlg::View);
 
-        A = Core::LinAlg::split_matrix<Core::LinAlg::DefaultBlockMatrixStrategy>(
-            sparseA, *extractor, *extractor);
-        A->complete();
+        A = splitter_.split(sparseA, *extractor);
       }
     }
 
-    // wrap linear operators
+    // wrap linear operators, the blocks are not copied
     if (!A)
     {
       auto A_crs = Teuchos::rcp_dynamic_cast<Epetra_CrsMatrix>(Teuchos::rcpFromRef(*matrix));
@@ -88,15 +84,54 @@ void Core::LinearSolver::TekoPreconditioner::setup(bool create, Epetra_Operator*
       {
         for (int col = 0; col < A->cols(); col++)
         {
-          auto A_crs = Teuchos::make_rcp<Epetra_CrsMatrix>(*A->matrix(row, col).epetra_matrix());
+          Teuchos::RCP<Epetra_CrsMatrix> A_crs = Teuchos::rcp(A->matrix(row, col).epetra_matrix());
           Teko::toBlockedLinearOp(pmatrix_)->setBlock(row, col, Thyra::epetraLinearOp(A_crs));
         }
       }
       Teko::toBlockedLinearOp(pmatrix_)->endBlockFill();
+    }
+
+    // nullspace and coordinates of the block inverses which are attached to the parameters
+    std::vector<MultiVectorPtr> user_data;
+    for (int block = 0; A and block < A->rows(); block++)
+    {
+      const std::string inverse = "Inverse" + std::to_string(block + 1);
+      for (const std::string name : {"nullspace", "Coordinates"})
+      {
+        MultiVectorPtr data;
+        if (tekolist_.isSublist(inverse) and tekolist_.sublist(inverse).isParameter(name))
+          data = tekolist_.sublist(inverse).get<MultiVectorPtr>(name);
+        user_data.push_back(data);
+      }
+    }
+
+    // the Teko preconditioner can only be rebuilt for a matrix with the same layout and the same
+    // nullspace and coordinates as the parameters were set up with
+    rebuilt_setup_ = !reuse_ or prec_.is_null() or
+                     !matrix->OperatorRangeMap().SameAs(*range_map_) or user_data != user_data_;
+    if (rebuilt_setup_)
+    {
+      teko_params_ = Teuchos::null;
+      prec_factory_ = Teuchos::null;
+      prec_ = Teuchos::null;
+      user_data_ = user_data;
+    }
+
+    if (teko_params_.is_null())
+    {
+      if (!tekolist_.sublist("Teko Parameters").isParameter("TEKO_XML_FILE"))
+        FOUR_C_THROW("TEKO_XML_FILE parameter not set!");
+      std::string xmlFileName =
+          tekolist_.sublist("Teko Parameters").get<std::string>("TEKO_XML_FILE");
+
+      teko_params_ = Teuchos::make_rcp<Teuchos::ParameterList>();
+      auto comm = Core::Communication::to_teuchos_comm<int>(
+          Core::Communication::unpack_epetra_comm(matrix->Comm()));
+      Teuchos::updateParametersFromXmlFileAndBroadcast(xmlFileName, teko_params_.ptr(), *comm);
 
       // check if multigrid is used as preconditioner for single field inverse approximation and
       // attach nullspace and coordinate information to the respective inverse parameter list.
-      for (int block = 0; block < A->rows(); block++)
+      for (int block = 0; A and block < A->rows(); block++)
       {
         std::string inverse = "Inverse" + std::to_string(block + 1);
 
@@ -106,27 +141,27 @@ void Core::LinearSolver::TekoPreconditioner::setup(bool create, Epetra_Operator*
           // "Inverse<1...n>".
           Teuchos::ParameterList& inverseList = tekolist_.sublist(inverse);
 
-          if (tekoParams.sublist("Inverse Factory Library")
+          if (teko_params_->sublist("Inverse Factory Library")
                   .sublist(inverse)
                   .get<std::string>("Type") == "MueLu")
           {
             const int number_of_equations = inverseList.get<int>("PDE equations");
 
-            Teuchos::RCP<XpetraMultiVector> nullspace =
-                Teuchos::make_rcp<EpetraMultiVector>(Teuchos::rcpFromRef(*inverseList
-                        .get<std::shared_ptr<Core::LinAlg::MultiVector<double>>>("nullspace")
+            // the parameters share the ownership of the vectors, since they are kept for reuse
+            Teuchos::RCP<XpetraMultiVector> nullspace = Teuchos::make_rcp<EpetraMultiVector>(
+                Teuchos::rcp(inverseList.get<MultiVectorPtr>("nullspace")
                         ->get_ptr_of_Epetra_MultiVector()));
 
-            Teuchos::RCP<XpetraMultiVector> coordinates =
-                Teuchos::make_rcp<EpetraMultiVector>(Teuchos::rcpFromRef(*inverseList
-                        .get<std::shared_ptr<Core::LinAlg::MultiVector<double>>>("Coordinates")
+            Teuchos::RCP<XpetraMultiVector> coordinates = Teuchos::make_rcp<EpetraMultiVector>(
+                Teuchos::rcp(inverseList.get<MultiVectorPtr>("Coordinates")
                         ->get_ptr_of_Epetra_MultiVector()));
 
-            tekoParams.sublist("Inverse Factory Library")
+            teko_params_->sublist("Inverse Factory Library")
                 .sublist(inverse)
                 .set("number of equations", number_of_equations);
-            Teuchos::ParameterList& userParamList =
-                tekoParams.sublist("Inverse Factory Library").sublist(inverse).sublist("user data");
+            Teuchos::ParameterList& userParamList = teko_params_->sublist("Inverse Factory Library")
+                                                        .sublist(inverse)
+                                                        .sublist("user data");
             userParamList.set("Nullspace", nullspace);
             userParamList.set("Coordinates", coordinates);
           }
@@ -134,34 +169,168 @@ void Core::LinearSolver::TekoPreconditioner::setup(bool create, Epetra_Operator*
       }
     }
 
-    // setup preconditioner builder and enable relevant packages
-    Stratimikos::LinearSolverBuilder<double> builder;
+    if (prec_factory_.is_null())
+    {
+      // setup preconditioner builder and enable relevant packages
+      Stratimikos::LinearSolverBuilder<double> builder;
+
+      // enable block preconditioning and multigrid
+      Stratimikos::enableMueLu<Scalar, LocalOrdinal, GlobalOrdinal, Node>(builder);
+      Teko::addTekoToStratimikosBuilder(builder);
+
+      // add special in-house block preconditioning methods
+      Teuchos::RCP<Teko::Cloneable> clone =
+          Teuchos::make_rcp<Teko::AutoClone<LU2x2SpaiStrategy>>();
+      Teko::LU2x2PreconditionerFactory::addStrategy("Spai Strategy", clone);
+
+      // get preconditioner parameter list
+      Teuchos::RCP<Teuchos::ParameterList> stratimikos_params =
+          Teuchos::make_rcp<Teuchos::ParameterList>(*builder.getValidParameters());
+      Teuchos::ParameterList& tekoList =
+          stratimikos_params->sublist("Preconditioner Types").sublist("Teko");
+      tekoList.setParameters(*teko_params_);
+      builder.setParameterList(stratimikos_params);
+
+      prec_factory_ = builder.createPreconditioningStrategy("Teko");
+      prec_ = prec_factory_->createPrec();
+      range_map_ = std::make_shared<Epetra_Map>(matrix->OperatorRangeMap());
+    }
 
-    // enable block preconditioning and multigrid
-    Stratimikos::enableMueLu<Scalar, LocalOrdinal, GlobalOrdinal, Node>(builder);
-    Teko::addTekoToStratimikosBuilder(builder);
+    // construct preconditioning operator, an already initialized preconditioner rebuilds its
+    // block inverses using its stored state
+    Thyra::initializePrec(*prec_factory_, pmatrix_, prec_.ptr());
+    Teko::LinearOp inverseOp = prec_->getUnspecifiedPrecOp();
 
-    // add special in-house block preconditioning methods
-    Teuchos::RCP<Teko::Cloneable> clone = Teuchos::make_rcp<Teko::AutoClone<LU2x2SpaiStrategy>>();
-    Teko::LU2x2PreconditionerFactory::addStrategy("Spai Strategy", clone);
+    p_ = std::make_shared<Teko::Epetra::EpetraInverseOpWrapper>(inverseOp);
+  }
+}
 
-    // get preconditioner parameter list
-    Teuchos::RCP<Teuchos::ParameterList> stratimikos_params =
-        Teuchos::make_rcp<Teuchos::ParameterList>(*builder.getValidParameters());
-    Teuchos::ParameterList& tekoList =
-        stratimikos_params->sublist("Preconditioner Types").sublist("Teko");
-    tekoList.setParameters(tekoParams);
-    builder.setParameterList(stratimikos_params);
+//----------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------
+std::shared_ptr<Core::LinAlg::BlockSparseMatrixBase>
+Core::LinearSolver::MergedMatrixSplitter::split(
+    const Core::LinAlg::SparseMatrix& matrix, const Core::LinAlg::MultiMapExtractor& extractor)
+{
+  const Epetra_CrsMatrix& A = *matrix.epetra_matrix();
 
-    // construct preconditioning operator
-    Teuchos::RCP<Thyra::PreconditionerFactoryBase<double>> precFactory =
-        builder.createPreconditioningStrategy("Teko");
-    Teuchos::RCP<Thyra::PreconditionerBase<double>> prec =
-        Thyra::prec<double>(*precFactory, pmatrix_);
-    Teko::LinearOp inverseOp = prec->getUnspecifiedPrecOp();
+  // check whether the graph of the merged matrix is the one of the previous split
+  int local_same_graph = blocks_ != nullptr and A.RowMap().SameAs(*row_map_) and
+                         A.ColMap().SameAs(*col_map_);
+  for (int lid = 0; local_same_graph and lid < A.NumMyRows(); ++lid)
+  {
+    int numentries;
+    int* indices;
+    A.Graph().ExtractMyRowView(lid, numentries, indices);
 
-    p_ = std::make_shared<Teko::Epetra::EpetraInverseOpWrapper>(inverseOp);
+    const auto begin = col_indices_.begin() + row_ptr_[lid];
+    local_same_graph = numentries == row_ptr_[lid + 1] - row_ptr_[lid] and
+                       std::equal(indices, indices + numentries, begin);
   }
+  int same_graph = 0;
+  Core::Communication::min_all(
+      &local_same_graph, &same_graph, 1, Core::Communication::unpack_epetra_comm(A.Comm()));
+
+  if (same_graph)
+  {
+    // only copy the values into the existing blocks
+    for (int row = 0; row < blocks_->rows(); ++row)
+      for (int col = 0; col < blocks_->cols(); ++col)
+        blocks_->matrix(row, col).epetra_matrix()->PutScalar(0.0);
+
+    std::vector<double*> block_values(blocks_->cols(), nullptr);
+    std::size_t entry = 0;
+    for (int lid = 0; lid < A.NumMyRows(); ++lid)
+    {
+      int numentries;
+      double* values;
+      int* indices;
+      A.ExtractMyRowView(lid, numentries, values, indices);
+
+      const SplitRow& split_row = rows_[lid];
+      if (split_row.block_row < 0)
+      {
+        entry += numentries;
+        continue;
+      }
+
+      for (int col = 0; col < blocks_->cols(); ++col)
+      {
+        int block_numentries;
+        int* block_indices;
+        blocks_->matrix(split_row.block_row, col)
+            .epetra_matrix()
+            ->ExtractMyRowView(split_row.lid, block_numentries, block_values[col], block_indices);
+      }
+
+      for (int j = 0; j < numentries; ++j, ++entry)
+      {
+        const SplitEntry& split_entry = entries_[entry];
+        if (split_entry.block_col >= 0)
+          block_values[split_entry.block_col][split_entry.position] = values[j];
+      }
+    }
+
+    return blocks_;
+  }
+
+  blocks_ = Core::LinAlg::split_matrix<Core::LinAlg::DefaultBlockMatrixStrategy>(
+      matrix, extractor, extractor);
+  blocks_->complete();
+
+  // remember where each entry of the merged matrix ended up
+  row_map_ = std::make_shared<Epetra_Map>(A.RowMap());
+  col_map_ = std::make_shared<Epetra_Map>(A.ColMap());
+  rows_.assign(A.NumMyRows(), SplitRow{-1, -1});
+  entries_.assign(A.NumMyNonzeros(), SplitEntry{-1, -1});
+  row_ptr_.assign(1, 0);
+  col_indices_.clear();
+  col_indices_.reserve(A.NumMyNonzeros());
+
+  std::size_t entry = 0;
+  for (int lid = 0; lid < A.NumMyRows(); ++lid)
+  {
+    int numentries;
+    double* values;
+    int* indices;
+    A.ExtractMyRowView(lid, numentries, values, indices);
+
+    col_indices_.insert(col_indices_.end(), indices, indices + numentries);
+    row_ptr_.push_back(row_ptr_.back() + numentries);
+
+    const int gid = A.GRID(lid);
+    int block_row = 0;
+    while (block_row < blocks_->rows() and !blocks_->range_map(block_row).MyGID(gid))
+      ++block_row;
+    if (block_row == blocks_->rows())
+    {
+      entry += numentries;
+      continue;
+    }
+
+    const int block_lid = blocks_->range_map(block_row).LID(gid);
+    rows_[lid] = SplitRow{block_row, block_lid};
+
+    std::map<int, SplitEntry> block_entries;
+    for (int col = 0; col < blocks_->cols(); ++col)
+    {
+      const Epetra_CrsMatrix& block = *blocks_->matrix(block_row, col).epetra_matrix();
+
+      int block_numentries;
+      double* block_values;
+      int* block_indices;
+      block.ExtractMyRowView(block_lid, block_numentries, block_values, block_indices);
+      for (int k = 0; k < block_numentries; ++k)
+        block_entries[block.ColMap().GID(block_indices[k])] = SplitEntry{col, k};
+    }
+
+    for (int j = 0; j < numentries; ++j, ++entry)
+    {
+      const auto block_entry = block_entries.find(A.ColMap().GID(indices[j]));
+      if (block_entry != block_entries.end()) entries_[entry] = block_entry->second;
+    }
+  }
+
+  return blocks_;
 }
 
 //----------------------------------------------------------------------------------
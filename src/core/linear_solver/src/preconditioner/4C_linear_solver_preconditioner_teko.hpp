@@ -15,18 +15,68 @@
 
 #include <MueLu_UseDefaultTypes.hpp>
 #include <Teko_LU2x2Strategy.hpp>
+#include <Thyra_PreconditionerFactoryBase.hpp>
 #include <Xpetra_BlockedCrsMatrix.hpp>
 
+#include <memory>
+#include <vector>
+
 FOUR_C_NAMESPACE_OPEN
 
 namespace Core::LinearSolver
 {
+  /*!
+   * \brief Split of a merged matrix into the blocks of a map extractor
+   *
+   * The block matrix of the previous split is refilled in place if the graph of the merged matrix
+   * did not change, otherwise a new block matrix is created.
+   */
+  class MergedMatrixSplitter
+  {
+   public:
+    /*!
+     * \brief Split the merged matrix @p matrix into the blocks of @p extractor
+     *
+     * @return block matrix, the same object as in the previous call if the graph did not change
+     */
+    std::shared_ptr<Core::LinAlg::BlockSparseMatrixBase> split(
+        const Core::LinAlg::SparseMatrix& matrix, const Core::LinAlg::MultiMapExtractor& extractor);
+
+   private:
+    //! block row and local row in that block of a row of the merged matrix
+    struct SplitRow
+    {
+      int block_row;
+      int lid;
+    };
+
+    //! block column and position in the block row of an entry of the merged matrix
+    struct SplitEntry
+    {
+      int block_col;
+      int position;
+    };
+
+    std::shared_ptr<Core::LinAlg::BlockSparseMatrixBase> blocks_;
+    std::shared_ptr<Epetra_Map> row_map_;
+    std::shared_ptr<Epetra_Map> col_map_;
+    std::vector<int> row_ptr_;
+    std::vector<int> col_indices_;
+    std::vector<SplitRow> rows_;
+    std::vector<SplitEntry> entries_;
+  };
+
   /*! \brief Set of standard block-matrix preconditioners
 
     Teko only needs the parameters for the block inverses in the parameter list
     as sublists "Inverse1", "Inverse2",...
     From the parameter list the Teko lists are automatically constructed, no 4C
     SOLVER objects needed!
+
+    The blocks of the matrix are wrapped without copying them. If TEKO_REUSE is set, the
+    parameters of the xml file and the Teko preconditioner are kept, so that re-creating the
+    preconditioner for a matrix with the same layout and the same nullspace and coordinates only
+    rebuilds the block inverses in place.
    */
   class TekoPreconditioner : public PreconditionerTypeBase
   {
@@ -39,14 +89,43 @@ namespace Core::LinearSolver
     /// linear operator used for preconditioning
     std::shared_ptr<Epetra_Operator> prec_operator() const override { return p_; }
 
+    /// once built, a reusing Teko preconditioner rebuilds its block inverses instead of being
+    /// recreated
+    bool reuses_setup() const override { return reuse_ and !prec_.is_null(); }
+
+    /// whether the last setup built a new Teko preconditioner, e.g. because the layout changed
+    bool rebuilt_setup() const override { return rebuilt_setup_; }
+
    private:
     Teuchos::ParameterList& tekolist_;
 
+    //! flag whether the Teko preconditioner is kept between setups
+    const bool reuse_;
+
     //! system of equations used for preconditioning used by P_ only
     Teuchos::RCP<const Thyra::LinearOpBase<double>> pmatrix_;
 
     //! preconditioner
     std::shared_ptr<Epetra_Operator> p_;
+
+    //! parameters read from the xml file at the last full setup
+    Teuchos::RCP<Teuchos::ParameterList> teko_params_;
+
+    //! nullspace and coordinates of the multigrid block inverses attached to the parameters
+    std::vector<std::shared_ptr<Core::LinAlg::MultiVector<double>>> user_data_;
+
+    //! factory and Teko preconditioner whose state is kept to rebuild the block inverses
+    Teuchos::RCP<Thyra::PreconditionerFactoryBase<double>> prec_factory_;
+    Teuchos::RCP<Thyra::PreconditionerBase<double>> prec_;
+
+    //! range map of the matrix the Teko preconditioner was built for
+    std::shared_ptr<Epetra_Map> range_map_;
+
+    //! whether the last setup built a new Teko preconditioner
+    bool rebuilt_setup_ = true;
+
+    //! split of a merged matrix into the blocks of the "extractor"
+    MergedMatrixSplitter splitter_;
   };
 
 
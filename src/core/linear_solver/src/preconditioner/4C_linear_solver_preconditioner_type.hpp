@@ -49,6 +49,19 @@ namespace Core::LinearSolver
 
     /// linear operator used for preconditioning
     virtual std::shared_ptr<Epetra_Operator> prec_operator() const = 0;
+
+    /*!
+       Whether the preconditioner keeps parts of its setup when it is created again for a new
+       matrix. Such preconditioners are not replaced by the solver, but set up again with
+       create = true.
+    */
+    virtual bool reuses_setup() const { return false; }
+
+    /*!
+       Whether the last setup with create = true built the preconditioner from scratch instead of
+       reusing parts of a previous setup.
+    */
+    virtual bool rebuilt_setup() const { return true; }
   };
 }  // namespace Core::LinearSolver
 
@@ -0,0 +1,199 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_linear_solver_preconditioner_muelu.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_linalg_multi_vector.hpp"
+#include "4C_linalg_sparsematrix.hpp"
+#include "4C_linear_solver_method.hpp"
+#include "4C_linear_solver_method_iterative.hpp"
+
+#include <Epetra_Map.h>
+
+#include <fstream>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  using IterativeSolver =
+      Core::LinearSolver::IterativeSolver<Epetra_Operator, Core::LinAlg::MultiVector<double>>;
+
+  /** The tests solve the 1D Laplacian with a CG solver preconditioned by a two level MueLu
+   *  hierarchy that reuses its prolongators. Every setup requests a reset of the solver, as the
+   *  linear solver does at least once per time step.
+   */
+  class MueLuReuseTest : public testing::Test
+  {
+   protected:
+    MueLuReuseTest()
+        : map_(num_rows_, 0, Core::Communication::as_epetra_comm(MPI_COMM_WORLD)),
+          nullspace_(std::make_shared<Core::LinAlg::MultiVector<double>>(map_, 1, true)),
+          coordinates_(std::make_shared<Core::LinAlg::MultiVector<double>>(map_, 1, true)),
+          xml_file_(testing::TempDir() + "muelu_reuse_test.xml")
+    {
+      nullspace_->PutScalar(1.0);
+      for (int lid = 0; lid < map_.NumMyElements(); ++lid)
+        coordinates_->ReplaceMyValue(lid, 0, map_.GID(lid) / static_cast<double>(num_rows_));
+
+      if (Core::Communication::my_mpi_rank(MPI_COMM_WORLD) == 0)
+      {
+        std::ofstream xml(xml_file_);
+        xml << "<ParameterList name=\"MueLu\">\n"
+               "  <Parameter name=\"verbosity\" type=\"string\" value=\"none\"/>\n"
+               "  <Parameter name=\"max levels\" type=\"int\" value=\"2\"/>\n"
+               "  <Parameter name=\"coarse: max size\" type=\"int\" value=\"10\"/>\n"
+               "  <Parameter name=\"multigrid algorithm\" type=\"string\" value=\"sa\"/>\n"
+               "  <Parameter name=\"smoother: type\" type=\"string\" value=\"RELAXATION\"/>\n"
+               "  <ParameterList name=\"smoother: params\">\n"
+               "    <Parameter name=\"relaxation: type\" type=\"string\" value=\"Jacobi\"/>\n"
+               "    <Parameter name=\"relaxation: damping factor\" type=\"double\" "
+               "value=\"0.6\"/>\n"
+               "  </ParameterList>\n"
+               "</ParameterList>\n";
+      }
+      Core::Communication::barrier(MPI_COMM_WORLD);
+    }
+
+    //! 1D Laplacian scaled by @p factor, optionally coupled to the second neighbours as well
+    std::shared_ptr<Epetra_Operator> laplacian(const double factor, const bool second_neighbours)
+    {
+      auto A = std::make_shared<Core::LinAlg::SparseMatrix>(map_, 5, false, true);
+      for (int lid = 0; lid < map_.NumMyElements(); ++lid)
+      {
+        const int row = map_.GID(lid);
+        A->assemble(2.0 * factor, row, row);
+        if (row > 0) A->assemble(-factor, row, row - 1);
+        if (row < num_rows_ - 1) A->assemble(-factor, row, row + 1);
+        if (second_neighbours and row > 1) A->assemble(-0.01 * factor, row, row - 2);
+        if (second_neighbours and row < num_rows_ - 2) A->assemble(-0.01 * factor, row, row + 2);
+      }
+      A->complete();
+      return A->epetra_operator();
+    }
+
+    Teuchos::ParameterList solver_parameters(const double max_iteration_ratio)
+    {
+      Teuchos::ParameterList params;
+      params.set("solver", "belos");
+
+      Teuchos::ParameterList& belos_params = params.sublist("Belos Parameters");
+      belos_params.set("Solver Type", "CG");
+      belos_params.set("Maximum Iterations", 200);
+      belos_params.set("Convergence Tolerance", 1.0e-10);
+      belos_params.set("reuse", 0);
+      belos_params.set("reuse: max iteration ratio", max_iteration_ratio);
+
+      Teuchos::ParameterList& muelu_params = params.sublist("MueLu Parameters");
+      muelu_params.set("MUELU_XML_FILE", xml_file_);
+      muelu_params.set("MUELU_REUSE", Core::LinearSolver::MueLuReuse::prolongator);
+      muelu_params.set("PDE equations", 1);
+      muelu_params.set("null space: dimension", 1);
+      muelu_params.set<std::shared_ptr<Core::LinAlg::MultiVector<double>>>("nullspace", nullspace_);
+      muelu_params.set<std::shared_ptr<Core::LinAlg::MultiVector<double>>>(
+          "Coordinates", coordinates_);
+
+      return params;
+    }
+
+    //! set up the solver with a reset for the matrix @p A and solve with a constant right-hand side
+    void setup_and_solve(IterativeSolver& solver, std::shared_ptr<Epetra_Operator> A)
+    {
+      auto x = std::make_shared<Core::LinAlg::MultiVector<double>>(map_, 1, true);
+      auto b = std::make_shared<Core::LinAlg::MultiVector<double>>(map_, 1, true);
+      b->PutScalar(1.0);
+
+      solver.setup(A, x, b, true, true, nullptr);
+      solver.solve();
+      EXPECT_GT(solver.get_num_iters(), 0);
+    }
+
+    static constexpr int num_rows_ = 200;
+    Epetra_Map map_;
+    std::shared_ptr<Core::LinAlg::MultiVector<double>> nullspace_;
+    std::shared_ptr<Core::LinAlg::MultiVector<double>> coordinates_;
+    std::string xml_file_;
+  };
+
+  TEST_F(MueLuReuseTest, KeepHierarchyAcrossResets)
+  {
+    Teuchos::ParameterList params = solver_parameters(100.0);
+    IterativeSolver solver(MPI_COMM_WORLD, params);
+
+    setup_and_solve(solver, laplacian(1.0, false));
+    const auto preconditioner = solver.preconditioner();
+    ASSERT_NE(preconditioner, nullptr);
+    EXPECT_TRUE(preconditioner->reuses_setup());
+    EXPECT_TRUE(preconditioner->rebuilt_setup());
+
+    // the linear solver keeps a solver that reuses its preconditioner setup on a reset
+    EXPECT_TRUE(solver.reuses_preconditioner_setup());
+
+    // new values with the same graph update the existing hierarchy
+    for (const double factor : {2.0, 0.5, 3.0})
+    {
+      setup_and_solve(solver, laplacian(factor, false));
+      EXPECT_EQ(solver.preconditioner(), preconditioner);
+      EXPECT_FALSE(preconditioner->rebuilt_setup());
+    }
+
+    // a changed graph rebuilds the hierarchy within the same preconditioner
+    setup_and_solve(solver, laplacian(1.0, true));
+    EXPECT_EQ(solver.preconditioner(), preconditioner);
+    EXPECT_TRUE(preconditioner->rebuilt_setup());
+
+    setup_and_solve(solver, laplacian(2.0, true));
+    EXPECT_EQ(solver.preconditioner(), preconditioner);
+    EXPECT_FALSE(preconditioner->rebuilt_setup());
+  }
+
+  TEST_F(MueLuReuseTest, RebuildPreconditionerIfIterationsExceedRatio)
+  {
+    // any solve with the reused hierarchy needs more than half of the reference iterations
+    Teuchos::ParameterList params = solver_parameters(0.5);
+    IterativeSolver solver(MPI_COMM_WORLD, params);
+
+    setup_and_solve(solver, laplacian(1.0, false));
+    const auto first_preconditioner = solver.preconditioner();
+    EXPECT_TRUE(first_preconditioner->rebuilt_setup());
+
+    // the hierarchy is reused once, but the iteration count exceeds the ratio
+    setup_and_solve(solver, laplacian(2.0, false));
+    EXPECT_EQ(solver.preconditioner(), first_preconditioner);
+    EXPECT_FALSE(first_preconditioner->rebuilt_setup());
+
+    // hence, the next setup creates a new preconditioner from scratch
+    setup_and_solve(solver, laplacian(3.0, false));
+    const auto second_preconditioner = solver.preconditioner();
+    EXPECT_NE(second_preconditioner, first_preconditioner);
+    EXPECT_TRUE(second_preconditioner->rebuilt_setup());
+  }
+
+  TEST_F(MueLuReuseTest, KeepPreconditionerWithinRatio)
+  {
+    // the reused hierarchy of a scaled matrix needs the same number of iterations
+    Teuchos::ParameterList params = solver_parameters(1.5);
+    IterativeSolver solver(MPI_COMM_WORLD, params);
+
+    setup_and_solve(solver, laplacian(1.0, false));
+    const int reference_iterations = solver.get_num_iters();
+    const auto preconditioner = solver.preconditioner();
+
+    for (const double factor : {2.0, 4.0})
+    {
+      setup_and_solve(solver, laplacian(factor, false));
+      EXPECT_LE(solver.get_num_iters(), 1.5 * reference_iterations);
+      EXPECT_EQ(solver.preconditioner(), preconditioner);
+      EXPECT_FALSE(preconditioner->rebuilt_setup());
+    }
+  }
+}  // namespace
+
+FOUR_C_NAMESPACE_CLOSE
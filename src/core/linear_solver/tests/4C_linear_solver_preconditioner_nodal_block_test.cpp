@@ -0,0 +1,156 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_linear_solver_preconditioner_nodal_block.hpp"
+
+#include "4C_linalg_multi_vector.hpp"
+#include "4C_linalg_sparsematrix.hpp"
+#include "4C_linear_solver_amgnxn_smoothers.hpp"
+
+#include <Epetra_Map.h>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  /** The tests use the system with two nodes and two dofs per node
+   *
+   *        | 4  1 | 1  0 |        | 1 |
+   *    A = | 1  3 | 0  1 |,   b = | 2 |
+   *        |------|------|        | 3 |
+   *        | 1  0 | 5  2 |        | 4 |
+   *        | 0  1 | 2  4 |
+   *
+   *  with the inverted nodal blocks
+   *
+   *    D0^-1 = 1/11 |  3 -1 |,   D1^-1 = 1/16 |  4 -2 |
+   *                 | -1  4 |                 | -2  5 |
+   */
+  class NodalBlockRelaxationTest : public testing::Test
+  {
+   protected:
+    NodalBlockRelaxationTest()
+        : rowmap_(4, 0, Core::Communication::as_epetra_comm(MPI_COMM_WORLD)),
+          A_(Teuchos::make_rcp<Core::LinAlg::SparseMatrix>(rowmap_, 4, false, true)),
+          b_(rowmap_, 1, true),
+          y_(rowmap_, 1, true)
+    {
+      const double values[4][4] = {{4.0, 1.0, 1.0, 0.0}, {1.0, 3.0, 0.0, 1.0},
+          {1.0, 0.0, 5.0, 2.0}, {0.0, 1.0, 2.0, 4.0}};
+      for (int row = 0; row < 4; ++row)
+      {
+        for (int col = 0; col < 4; ++col)
+          if (values[row][col] != 0.0) A_->assemble(values[row][col], row, col);
+        b_.ReplaceGlobalValue(row, 0, row + 1.0);
+      }
+      A_->complete();
+    }
+
+    void expect_solution(const std::vector<double>& expected)
+    {
+      for (int row = 0; row < 4; ++row) EXPECT_NEAR(y_(0)[row], expected[row], 1.0e-14);
+    }
+
+    Epetra_Map rowmap_;
+    Teuchos::RCP<Core::LinAlg::SparseMatrix> A_;
+    Core::LinAlg::MultiVector<double> b_;
+    Core::LinAlg::MultiVector<double> y_;
+  };
+
+  TEST_F(NodalBlockRelaxationTest, BlockInverse)
+  {
+    // one Jacobi sweep with zero initial guess applied to the unit vectors yields the columns of
+    // the inverted block diagonal
+    Core::LinearSolver::NodalBlockRelaxation relaxation(A_->epetra_matrix(), 2,
+        Core::LinearSolver::NodalBlockRelaxationType::jacobi, 1, 1.0);
+    relaxation.setup();
+
+    Core::LinAlg::MultiVector<double> identity(rowmap_, 4, true);
+    for (int row = 0; row < 4; ++row) identity.ReplaceGlobalValue(row, row, 1.0);
+    Core::LinAlg::MultiVector<double> inverse(rowmap_, 4, true);
+    relaxation.ApplyInverse(identity, inverse);
+
+    const double expected[4][4] = {{3.0 / 11.0, -1.0 / 11.0, 0.0, 0.0},
+        {-1.0 / 11.0, 4.0 / 11.0, 0.0, 0.0}, {0.0, 0.0, 4.0 / 16.0, -2.0 / 16.0},
+        {0.0, 0.0, -2.0 / 16.0, 5.0 / 16.0}};
+    for (int row = 0; row < 4; ++row)
+      for (int col = 0; col < 4; ++col)
+        EXPECT_NEAR(inverse(col)[row], expected[row][col], 1.0e-14);
+  }
+
+  TEST_F(NodalBlockRelaxationTest, JacobiSweep)
+  {
+    Core::LinearSolver::NodalBlockRelaxation relaxation(A_->epetra_matrix(), 2,
+        Core::LinearSolver::NodalBlockRelaxationType::jacobi, 1, 1.0);
+    relaxation.setup();
+    relaxation.apply(b_, y_, true);
+
+    // y = D^-1 b
+    expect_solution({1.0 / 11.0, 7.0 / 11.0, 4.0 / 16.0, 14.0 / 16.0});
+
+    // a second damped sweep starting from there: y += 0.5 D^-1 (b - A y) with
+    // b - A y = (-1/4, -7/8, -1/11, -7/11)
+    Core::LinearSolver::NodalBlockRelaxation damped(A_->epetra_matrix(), 2,
+        Core::LinearSolver::NodalBlockRelaxationType::jacobi, 1, 0.5);
+    damped.setup();
+    damped.apply(b_, y_, false);
+
+    expect_solution({1.0 / 11.0 + 0.5 * (2.0 / 176.0), 7.0 / 11.0 + 0.5 * (-52.0 / 176.0),
+        4.0 / 16.0 + 0.5 * (10.0 / 176.0), 14.0 / 16.0 + 0.5 * (-33.0 / 176.0)});
+  }
+
+  TEST_F(NodalBlockRelaxationTest, GaussSeidelSweep)
+  {
+    Core::LinearSolver::NodalBlockRelaxation relaxation(A_->epetra_matrix(), 2,
+        Core::LinearSolver::NodalBlockRelaxationType::gauss_seidel, 1, 1.0);
+    relaxation.setup();
+    relaxation.apply(b_, y_, true);
+
+    // y0 = D0^-1 b0, y1 = D1^-1 (b1 - L y0) with b1 - L y0 = (32/11, 37/11)
+    expect_solution({1.0 / 11.0, 7.0 / 11.0, 54.0 / 176.0, 121.0 / 176.0});
+  }
+
+  TEST_F(NodalBlockRelaxationTest, SymmetricGaussSeidelSweep)
+  {
+    Core::LinearSolver::NodalBlockRelaxation relaxation(A_->epetra_matrix(), 2,
+        Core::LinearSolver::NodalBlockRelaxationType::symmetric_gauss_seidel, 1, 1.0);
+    relaxation.setup();
+    relaxation.apply(b_, y_, true);
+
+    // the backward sweep leaves y1 of the forward sweep unchanged and corrects
+    // y0 += D0^-1 (-U y1)
+    expect_solution({135.0 / 1936.0, 802.0 / 1936.0, 54.0 / 176.0, 121.0 / 176.0});
+  }
+
+  TEST_F(NodalBlockRelaxationTest, AMGnxnSmootherWrapper)
+  {
+    Core::LinearSolver::AMGNxN::NodalBlockSmootherWrapper smoother(
+        A_, 2, Core::LinearSolver::NodalBlockRelaxationType::gauss_seidel, 1, 1.0);
+    smoother.apply(b_, y_, true);
+
+    expect_solution({1.0 / 11.0, 7.0 / 11.0, 54.0 / 176.0, 121.0 / 176.0});
+  }
+
+  TEST_F(NodalBlockRelaxationTest, Preconditioner)
+  {
+    Teuchos::ParameterList params;
+    params.set("block size", 2);
+    params.set("relaxation: type", std::string("Gauss-Seidel"));
+    params.set("relaxation: sweeps", 1);
+    params.set("relaxation: damping factor", 1.0);
+
+    Core::LinearSolver::NodalBlockPreconditioner preconditioner(params);
+    preconditioner.setup(true, A_->epetra_matrix().get(), nullptr, nullptr);
+    preconditioner.prec_operator()->ApplyInverse(b_, y_);
+
+    expect_solution({1.0 / 11.0, 7.0 / 11.0, 54.0 / 176.0, 121.0 / 176.0});
+  }
+}  // namespace
+
+FOUR_C_NAMESPACE_CLOSE
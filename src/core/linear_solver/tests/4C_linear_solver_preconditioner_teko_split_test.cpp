@@ -0,0 +1,149 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_linear_solver_preconditioner_teko.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_linalg_mapextractor.hpp"
+#include "4C_linalg_sparsematrix.hpp"
+#include "4C_linalg_utils_sparse_algebra_manipulation.hpp"
+
+#include <Epetra_Map.h>
+
+#include <algorithm>
+#include <map>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  /** The tests split a banded matrix with every third row and column in the second block, as for
+   *  a velocity-pressure system, and compare the blocks with the ones of a split from scratch.
+   */
+  class MergedMatrixSplitterTest : public testing::Test
+  {
+   protected:
+    MergedMatrixSplitterTest()
+        : map_(num_rows_, 0, Core::Communication::as_epetra_comm(MPI_COMM_WORLD))
+    {
+      std::vector<std::vector<int>> block_gids(2);
+      for (int lid = 0; lid < map_.NumMyElements(); ++lid)
+        block_gids[map_.GID(lid) % 3 == 2].push_back(map_.GID(lid));
+
+      std::vector<std::shared_ptr<const Epetra_Map>> maps;
+      for (const auto& gids : block_gids)
+        maps.emplace_back(std::make_shared<Epetra_Map>(
+            -1, static_cast<int>(gids.size()), gids.data(), 0, map_.Comm()));
+      extractor_.setup(map_, maps);
+    }
+
+    //! banded matrix with distinct values scaled by @p factor and the given @p bandwidth
+    std::shared_ptr<Core::LinAlg::SparseMatrix> matrix(const double factor, const int bandwidth)
+    {
+      auto A = std::make_shared<Core::LinAlg::SparseMatrix>(map_, 2 * bandwidth + 1, false, true);
+      for (int lid = 0; lid < map_.NumMyElements(); ++lid)
+      {
+        const int row = map_.GID(lid);
+        const int last_col = std::min(row + bandwidth, num_rows_ - 1);
+        for (int col = std::max(row - bandwidth, 0); col <= last_col; ++col)
+          A->assemble(factor * (1.0 + row + 0.1 * col), row, col);
+      }
+      A->complete();
+      return A;
+    }
+
+    //! expect that the blocks of @p actual hold the same entries as the blocks of @p expected
+    static void expect_equal_blocks(const Core::LinAlg::BlockSparseMatrixBase& actual,
+        const Core::LinAlg::BlockSparseMatrixBase& expected)
+    {
+      ASSERT_EQ(actual.rows(), expected.rows());
+      ASSERT_EQ(actual.cols(), expected.cols());
+      for (int row = 0; row < expected.rows(); ++row)
+      {
+        for (int col = 0; col < expected.cols(); ++col)
+        {
+          const Epetra_CrsMatrix& actual_block = *actual.matrix(row, col).epetra_matrix();
+          const Epetra_CrsMatrix& expected_block = *expected.matrix(row, col).epetra_matrix();
+          ASSERT_TRUE(actual_block.RowMap().SameAs(expected_block.RowMap()));
+          EXPECT_EQ(actual_block.NumGlobalNonzeros(), expected_block.NumGlobalNonzeros());
+
+          for (int lid = 0; lid < expected_block.NumMyRows(); ++lid)
+          {
+            EXPECT_EQ(row_entries(actual_block, lid), row_entries(expected_block, lid));
+          }
+        }
+      }
+    }
+
+    //! entries of the local row @p lid of @p A sorted by their global column
+    static std::map<int, double> row_entries(const Epetra_CrsMatrix& A, const int lid)
+    {
+      int numentries;
+      double* values;
+      int* indices;
+      A.ExtractMyRowView(lid, numentries, values, indices);
+
+      std::map<int, double> entries;
+      for (int j = 0; j < numentries; ++j) entries[A.ColMap().GID(indices[j])] = values[j];
+      return entries;
+    }
+
+    static std::shared_ptr<Core::LinAlg::BlockSparseMatrixBase> split_from_scratch(
+        const Core::LinAlg::SparseMatrix& A, const Core::LinAlg::MultiMapExtractor& extractor)
+    {
+      auto blocks = Core::LinAlg::split_matrix<Core::LinAlg::DefaultBlockMatrixStrategy>(
+          A, extractor, extractor);
+      blocks->complete();
+      return blocks;
+    }
+
+    static constexpr int num_rows_ = 30;
+    Epetra_Map map_;
+    Core::LinAlg::MultiMapExtractor extractor_;
+  };
+
+  TEST_F(MergedMatrixSplitterTest, RefillBlocksForSameGraph)
+  {
+    Core::LinearSolver::MergedMatrixSplitter splitter;
+
+    const auto A = matrix(1.0, 1);
+    const auto blocks = splitter.split(*A, extractor_);
+    expect_equal_blocks(*blocks, *split_from_scratch(*A, extractor_));
+
+    // new values with the same graph are copied into the existing blocks
+    for (const double factor : {2.0, -0.5})
+    {
+      const auto B = matrix(factor, 1);
+      EXPECT_EQ(splitter.split(*B, extractor_), blocks);
+      expect_equal_blocks(*blocks, *split_from_scratch(*B, extractor_));
+    }
+  }
+
+  TEST_F(MergedMatrixSplitterTest, SplitAnewForChangedGraph)
+  {
+    Core::LinearSolver::MergedMatrixSplitter splitter;
+
+    const auto A = matrix(1.0, 1);
+    const auto blocks = splitter.split(*A, extractor_);
+
+    // a changed graph creates new blocks and leaves the previous ones untouched
+    const auto B = matrix(2.0, 2);
+    const auto new_blocks = splitter.split(*B, extractor_);
+    EXPECT_NE(new_blocks, blocks);
+    expect_equal_blocks(*new_blocks, *split_from_scratch(*B, extractor_));
+    expect_equal_blocks(*blocks, *split_from_scratch(*A, extractor_));
+
+    // the new graph is refilled in place again
+    const auto C = matrix(3.0, 2);
+    EXPECT_EQ(splitter.split(*C, extractor_), new_blocks);
+    expect_equal_blocks(*new_blocks, *split_from_scratch(*C, extractor_));
+  }
+}  // namespace
+
+FOUR_C_NAMESPACE_CLOSE
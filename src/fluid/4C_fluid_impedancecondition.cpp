@@ -7,10 +7,12 @@
 
 #include "4C_fluid_impedancecondition.hpp"
 
+#include "4C_comm_mpi_utils.hpp"
 #include "4C_fluid_ele_action.hpp"
 #include "4C_fluid_utils.hpp"
 #include "4C_global_data.hpp"
 #include "4C_io.hpp"
+#include "4C_linalg_serialdensematrix.hpp"
 #include "4C_linalg_utils_densematrix_communication.hpp"
 #include "4C_linalg_utils_sparse_algebra_create.hpp"
 #include "4C_linalg_utils_sparse_algebra_manipulation.hpp"
@@ -410,13 +412,6 @@ void FLD::Utils::FluidImpedanceBc::calculate_impedance_tractions_and_update_resi
 
     discret_->evaluate_condition(eleparams2, dQdu, "ImpedanceCond", condid);
 
-    // now move dQdu to one proc
-    std::shared_ptr<Epetra_Map> dofrowmapred = Core::LinAlg::allreduce_e_map(*dofrowmap);
-    Core::LinAlg::Vector<double> dQdu_full(*dofrowmapred, true);
-
-    Core::LinAlg::export_to(*dQdu, dQdu_full);  //!!! add off proc components
-
-
     // calculate d wk/du = d/du ( (v,n)_gamma n,phi)_Gamma were (d wk/du)_i,j= timefacs*
     // (phi_i,n)_Gamma * (phi_j,n)_Gamma
     // Note: this derivative cannot be build on element level, hence we have to do it here!
@@ -424,21 +419,7 @@ void FLD::Utils::FluidImpedanceBc::calculate_impedance_tractions_and_update_resi
 
     const double tfaclhs = eleparams2.get<double>("tfaclhs", 0.0);
 
-    for (int lid = 0; lid < dQdu->MyLength(); lid++)
-    {
-      const int gid = dofrowmap->GID(lid);
-      const double val = (*dQdu)[lid];
-      if (abs(val) > 1e-15)
-      {
-        for (int lid2 = 0; lid2 < dQdu_full.MyLength(); lid2++)
-        {
-          const int gid2 = dofrowmapred->GID(lid2);
-          const double val2 = (dQdu_full)[lid2];
-          const double actmatentry = tfaclhs * val * val2;
-          if (abs(actmatentry) > 1e-15) impedancetbcsysmat_->assemble(actmatentry, gid, gid2);
-        }
-      }
-    }
+    assemble_flow_rate_linearization(*dQdu, tfaclhs, *impedancetbcsysmat_);
 
     impedancetbcsysmat_->complete();
     //  std::cout<<__FILE__<<__LINE__<<*((std::dynamic_pointer_cast<Core::LinAlg::SparseMatrix>(impedancetbcsysmat_))->EpetraMatrix())<<std::endl;
@@ -605,4 +586,39 @@ double FLD::Utils::FluidImpedanceBc::area(const int condid)
   return pararea;
 }  // FluidImplicitTimeInt::Area
 
+/*----------------------------------------------------------------------*
+ |  rank-one linearization of the flow rate                             |
+ *----------------------------------------------------------------------*/
+void FLD::Utils::assemble_flow_rate_linearization(const Core::LinAlg::Vector<double>& dQdu,
+    const double tfaclhs, Core::LinAlg::SparseOperator& sysmat)
+{
+  const Epetra_BlockMap& dofrowmap = dQdu.Map();
+  const int myrank = Core::Communication::my_mpi_rank(dQdu.Comm());
+
+  // only the nonzero entries of dQdu are distributed to all procs instead of the whole vector
+  std::vector<std::pair<int, double>> my_outlet_entries;
+  for (int lid = 0; lid < dQdu.MyLength(); lid++)
+  {
+    const double val = dQdu[lid];
+    if (abs(val) > 1e-15) my_outlet_entries.emplace_back(dofrowmap.GID(lid), val);
+  }
+  const std::vector<std::pair<int, double>> outlet_entries =
+      Core::Communication::all_reduce(my_outlet_entries, dQdu.Comm());
+
+  std::vector<int> outlet_gids;
+  outlet_gids.reserve(outlet_entries.size());
+  for (const auto& [gid, val] : outlet_entries) outlet_gids.push_back(gid);
+
+  Core::LinAlg::SerialDenseMatrix rowvalues(1, outlet_entries.size());
+  for (const auto& [gid, val] : my_outlet_entries)
+  {
+    for (std::size_t j = 0; j < outlet_entries.size(); ++j)
+      rowvalues(0, j) = tfaclhs * val * outlet_entries[j].second;
+
+    const std::vector<int> rowgid(1, gid);
+    const std::vector<int> rowowner(1, myrank);
+    sysmat.assemble(0, rowvalues, rowgid, rowowner, outlet_gids);
+  }
+}
+
 FOUR_C_NAMESPACE_CLOSE
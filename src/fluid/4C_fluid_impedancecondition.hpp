@@ -220,6 +220,15 @@ namespace FLD
       double p_0_;
     };  // class FluidImpedanceBc
 
+    /*!
+    \brief Assemble the rank-one linearization tfaclhs * dQdu * dQdu^T of the flow rate
+
+    The term only couples the outlet dofs, i.e. the nonzero entries of dQdu. Only these entries
+    are distributed to all procs and each proc assembles its owned outlet rows as dense rows.
+    */
+    void assemble_flow_rate_linearization(const Core::LinAlg::Vector<double>& dQdu,
+        const double tfaclhs, Core::LinAlg::SparseOperator& sysmat);
+
   }  // namespace Utils
 }  // namespace FLD
 
@@ -41,6 +41,7 @@
 #include "4C_inpar_xfem.hpp"  //for enums only
 #include "4C_io.hpp"
 #include "4C_io_control.hpp"
+#include "4C_io_discretization_probe_writer.hpp"
 #include "4C_io_discretization_visualization_writer_mesh.hpp"
 #include "4C_io_gmsh.hpp"
 #include "4C_linalg_krylov_projector.hpp"
@@ -369,6 +370,7 @@ void FLD::FluidImplicitTimeInt::init()
     create_faces_extension();
   }
   reconstructder_ = stabparams->get<bool>("Reconstruct_Sec_Der");
+  if (reconstructder_) velgrad_projection_ = FLD::Utils::create_gradient_projection();
 
 }  // FluidImplicitTimeInt::init()
 
@@ -3393,6 +3395,15 @@ void FLD::FluidImplicitTimeInt::statistics_output()
   if (params_->get<bool>("GMSH_OUTPUT")) output_to_gmsh(step_, time_, true);
 }  // FluidImplicitTimeInt::StatisticsOutput
 
+void FLD::FluidImplicitTimeInt::write_probe_output()
+{
+  // velocity and pressure are both interpolated from velnp_
+  if (probe_writer_->has_field("velocity")) probe_writer_->append_field("velocity", *velnp_);
+  if (probe_writer_->has_field("pressure")) probe_writer_->append_field("pressure", *velnp_);
+
+  probe_writer_->write(time_, step_);
+}
+
 void FLD::FluidImplicitTimeInt::write_runtime_output()
 {
   runtime_output_writer_->reset();
@@ -3455,6 +3466,8 @@ void FLD::FluidImplicitTimeInt::write_runtime_output()
  *----------------------------------------------------------------------*/
 void FLD::FluidImplicitTimeInt::output()
 {
+  if (probe_writer_ != nullptr and step_ % probe_interval_ == 0) write_probe_output();
+
   // output of solution
   if (upres_ > 0 and step_ % upres_ == 0)
   {
@@ -34,6 +34,7 @@ namespace Core::FE
 {
   class Discretization;
   class DiscretizationFaces;
+  class NodalL2Projection;
 }  // namespace Core::FE
 namespace Core::IO
 {
@@ -524,6 +525,11 @@ namespace FLD
      */
     virtual void write_runtime_output();
 
+    /*
+     * \brief Write velocity and pressure at the probes
+     */
+    void write_probe_output();
+
     virtual void output_nonlinear_bc();
 
     virtual void output_to_gmsh(const int step, const double time, const bool inflow) const;
@@ -1176,6 +1182,9 @@ namespace FLD
     //! flag to reconstruct second derivative for fluid residual
     bool reconstructder_;
 
+    //! L2 projection of the velocity gradient (keeps the mass matrix between the projections)
+    std::shared_ptr<Core::FE::NodalL2Projection> velgrad_projection_;
+
     /// flag for special turbulent flow
     std::string special_flow_;
 
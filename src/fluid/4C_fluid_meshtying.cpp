@@ -25,6 +25,8 @@
 #include "4C_mortar_interface.hpp"
 #include "4C_mortar_node.hpp"
 
+#include <Epetra_CrsMatrix.h>
+#include <Epetra_Import.h>
 #include <Teuchos_TimeMonitor.hpp>
 
 FOUR_C_NAMESPACE_OPEN
@@ -57,7 +59,10 @@ FLD::Meshtying::Meshtying(std::shared_ptr<Core::FE::Discretization> dis,
       multifield_condelements_(nullptr),
       multifield_condelements_shape_(nullptr),
       multifield_splitmatrix_(false),
-      is_multifield_(false)
+      is_multifield_(false),
+      projectioncolmap_(nullptr),
+      projectionnonzeros_(0),
+      condensedsysmat_(nullptr)
 {
 }
 
@@ -476,6 +481,9 @@ void FLD::Meshtying::evaluate_with_mesh_relocation(
   // call mortar evaluate routine including mesh correction
   adaptermeshtying_->evaluate_with_mesh_relocation(
       discret_, aledis, dispnp, discret_->get_comm(), true);
+
+  // P has changed, hence the slave column projection has to be set up again
+  projectioncolmap_ = nullptr;
 }
 
 /*---------------------------------------------------*/
@@ -707,6 +715,15 @@ void FLD::Meshtying::condensation_sparse_matrix(
 {
   TEUCHOS_FUNC_TIME_MONITOR("Meshtying:  2)   Condensation sparse matrix");
 
+  // Without Dirichlet conditions on the master side in the current iteration, the slave rows and
+  // columns are redirected directly. Otherwise the split version below accounts for the modified
+  // coupling condition.
+  if (not(dconmaster_ and firstnonliniter_))
+  {
+    condensation_operation_redirect_sparse_matrix(*sysmat, residual, velnp);
+    return;
+  }
+
   /**********************************************************************/
   /* Split sysmat and residual                                          */
   /**********************************************************************/
@@ -1199,6 +1216,199 @@ void FLD::Meshtying::condensation_operation_sparse_matrix(
   residual.Update(1.0, *resnew, 0.0);
 }
 
+/*-------------------------------------------------------*/
+/*  Condensation operation sparse matrix by redirection  */
+/*  of the slave rows and columns                        */
+/*-------------------------------------------------------*/
+void FLD::Meshtying::condensation_operation_redirect_sparse_matrix(
+    Core::LinAlg::SparseOperator& sysmat, Core::LinAlg::Vector<double>& residual,
+    Core::LinAlg::Vector<double>& velnp)
+{
+  TEUCHOS_FUNC_TIME_MONITOR("Meshtying:  2.3)   - Condensation Operation");
+
+  // The condensed system is T^T*K*T with T = [1 0; 0 1; 0 P] for the dofs (n, m, s):
+  // -> every slave column is redirected to the master columns with the weights of P
+  // -> every slave row is redirected to the master rows with the weights of P^T
+  // -> the slave block gets the identity
+  // The residual is redirected in the same way including the correction K_(.s)*(v_s - P*v_m),
+  // which is accumulated from the slave columns during the same pass.
+  //
+  // This is equivalent to the split version since K_ms and K_sm vanish (no element contains
+  // both master and slave nodes).
+
+  auto& sparsesysmat = dynamic_cast<Core::LinAlg::SparseMatrix&>(sysmat);
+  const Epetra_CrsMatrix& kcrs = *sparsesysmat.epetra_matrix();
+
+  // get transformation matrix
+  std::shared_ptr<Core::LinAlg::SparseMatrix> P = adaptermeshtying_->get_mortar_matrix_p();
+  const Epetra_CrsMatrix& pcrs = *P->epetra_matrix();
+
+  setup_slave_column_projection(kcrs, pcrs);
+
+  // velocity gap v_s - P*v_m in the column layout of the sysmat
+  std::vector<std::shared_ptr<Core::LinAlg::Vector<double>>> splitvel(3);
+  split_vector(velnp, splitvel);
+  Core::LinAlg::Vector<double> gap(*gsdofrowmap_, true);
+  P->multiply(false, *(splitvel[1]), gap);
+  gap.Update(1.0, *(splitvel[2]), -1.0);
+  Core::LinAlg::Vector<double> gapcol(kcrs.ColMap(), true);
+  Core::LinAlg::export_to(gap, gapcol);
+
+  // the graph of the condensed sysmat is kept, only the values are reset
+  if (condensedsysmat_ == nullptr)
+  {
+    condensedsysmat_ = std::make_shared<Core::LinAlg::SparseMatrix>(
+        *dofrowmap_, 108, false, false, Core::LinAlg::SparseMatrix::FE_MATRIX);
+  }
+  else
+    condensedsysmat_->zero();
+
+  // residual of the slave rows, redirected to the master rows with P^T below
+  Core::LinAlg::Vector<double> slaveres(*gsdofrowmap_, true);
+
+  std::vector<int> colgids;
+  std::vector<double> colvalues;
+  for (int rowlid = 0; rowlid < kcrs.NumMyRows(); ++rowlid)
+  {
+    int numentries;
+    double* values;
+    int* indices;
+    kcrs.ExtractMyRowView(rowlid, numentries, values, indices);
+
+    // redirect the slave columns to the master columns
+    colgids.clear();
+    colvalues.clear();
+    double gapcorrection = 0.0;
+    for (int j = 0; j < numentries; ++j)
+    {
+      const int collid = indices[j];
+      if (not colisslave_[collid])
+      {
+        colgids.push_back(kcrs.GCID(collid));
+        colvalues.push_back(values[j]);
+        continue;
+      }
+
+      gapcorrection += values[j] * gapcol[collid];
+      for (int k = colprojptr_[collid]; k < colprojptr_[collid + 1]; ++k)
+      {
+        colgids.push_back(colprojgids_[k]);
+        colvalues.push_back(values[j] * colprojweights_[k]);
+      }
+    }
+
+    // the residual shares the row map with the sysmat
+    const int rowgid = kcrs.GRID(rowlid);
+    const int slavelid = gsdofrowmap_->LID(rowgid);
+    if (slavelid < 0)
+    {
+      residual[rowlid] += gapcorrection;
+      for (std::size_t k = 0; k < colgids.size(); ++k)
+        condensedsysmat_->fe_assemble(colvalues[k], rowgid, colgids[k]);
+      continue;
+    }
+
+    slaveres[slavelid] = residual[rowlid] + gapcorrection;
+    residual[rowlid] = 0.0;
+
+    // redirect the slave row to the master rows (possibly owned by another processor)
+    int numpentries = 0;
+    double* pvalues;
+    int* pindices;
+    const int err = pcrs.ExtractMyRowView(pcrs.LRID(rowgid), numpentries, pvalues, pindices);
+    if (err)
+      FOUR_C_THROW(
+          "Epetra_CrsMatrix::ExtractMyRowView for slave dof %d returned err=%d", rowgid, err);
+    for (int i = 0; i < numpentries; ++i)
+    {
+      const int mastergid = pcrs.GCID(pindices[i]);
+      for (std::size_t k = 0; k < colgids.size(); ++k)
+        condensedsysmat_->fe_assemble(pvalues[i] * colvalues[k], mastergid, colgids[k]);
+    }
+
+    condensedsysmat_->fe_assemble(1.0, rowgid, rowgid);
+  }
+
+  condensedsysmat_->complete();
+
+  sysmat.un_complete();
+  sysmat.add(*condensedsysmat_, false, 1.0, 0.0);
+  sysmat.complete();
+
+  // r_m: add P^T*(r_s + K_ss*(v_s - P*v_m))
+  Core::LinAlg::Vector<double> fm_mod(*gmdofrowmap_, true);
+  P->multiply(true, slaveres, fm_mod);
+  Core::LinAlg::Vector<double> fm_modexp(*dofrowmap_, true);
+  Core::LinAlg::export_to(fm_mod, fm_modexp);
+  residual.Update(1.0, fm_modexp, 1.0);
+}
+
+/*-------------------------------------------------------*/
+/*  Set up projection of the slave columns               */
+/*-------------------------------------------------------*/
+void FLD::Meshtying::setup_slave_column_projection(
+    const Epetra_CrsMatrix& sysmat, const Epetra_CrsMatrix& P)
+{
+  if (projectioncolmap_ != nullptr and projectioncolmap_->SameAs(sysmat.ColMap()) and
+      projectionnonzeros_ == sysmat.NumGlobalNonzeros())
+    return;
+
+  TEUCHOS_FUNC_TIME_MONITOR("Meshtying:  2.4)   - Setup Slave Column Projection");
+
+  projectioncolmap_ = std::make_shared<Epetra_Map>(sysmat.ColMap());
+  projectionnonzeros_ = sysmat.NumGlobalNonzeros();
+
+  // the graph of the condensed sysmat changes as well
+  condensedsysmat_ = nullptr;
+
+  // identify the slave dofs among the columns of the sysmat
+  Core::LinAlg::Vector<double> isslave(*gsdofrowmap_, false);
+  isslave.PutScalar(1.0);
+  Core::LinAlg::Vector<double> isslavecol(sysmat.ColMap(), true);
+  Core::LinAlg::export_to(isslave, isslavecol);
+
+  const int numcols = sysmat.ColMap().NumMyElements();
+  colisslave_.assign(numcols, false);
+  std::vector<int> slavecolgids;
+  for (int lid = 0; lid < numcols; ++lid)
+  {
+    if (isslavecol[lid] == 0.0) continue;
+    colisslave_[lid] = true;
+    slavecolgids.push_back(sysmat.ColMap().GID(lid));
+  }
+
+  // rows of P for all slave column dofs including the ones owned by other processors
+  Epetra_Map slavecolmap(
+      -1, static_cast<int>(slavecolgids.size()), slavecolgids.data(), 0, sysmat.Comm());
+  Epetra_Import importer(slavecolmap, P.RowMap());
+  Epetra_CrsMatrix slavecolP(::Copy, slavecolmap, 0);
+  int err = slavecolP.Import(P, importer, Insert);
+  if (err) FOUR_C_THROW("Import of the mortar projection matrix returned err=%d", err);
+
+  colprojptr_.assign(numcols + 1, 0);
+  colprojgids_.clear();
+  colprojweights_.clear();
+  std::vector<int> mastergids;
+  std::vector<double> weights;
+  for (int lid = 0; lid < numcols; ++lid)
+  {
+    colprojptr_[lid] = static_cast<int>(colprojgids_.size());
+    if (not colisslave_[lid]) continue;
+
+    const int gid = sysmat.ColMap().GID(lid);
+    const int length = slavecolP.NumGlobalEntries(gid);
+    mastergids.resize(length);
+    weights.resize(length);
+    int numentries = 0;
+    if (length > 0)
+      slavecolP.ExtractGlobalRowCopy(gid, length, numentries, weights.data(), mastergids.data());
+
+    colprojgids_.insert(colprojgids_.end(), mastergids.begin(), mastergids.begin() + numentries);
+    colprojweights_.insert(colprojweights_.end(), weights.begin(), weights.begin() + numentries);
+  }
+  colprojptr_[numcols] = static_cast<int>(colprojgids_.size());
+}
+
 /*-------------------------------------------------------*/
 /*  Condensation operation block matrix     ehrl (04/11) */
 /* (including ALE case   vg 01/14)                       */
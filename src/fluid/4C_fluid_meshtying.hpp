@@ -13,9 +13,11 @@
 #include "4C_coupling_adapter_mortar.hpp"
 #include "4C_inpar_fluid.hpp"
 #include "4C_linalg_mapextractor.hpp"
+#include "4C_linalg_sparsematrix.hpp"
 #include "4C_linalg_vector.hpp"
 
 #include <memory>
+#include <vector>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -65,6 +67,7 @@ namespace FLD
   class Meshtying
   {
     friend class FluidEleParameter;
+    friend class MeshtyingCondensationTest;
 
    public:
     //! Constructor
@@ -230,6 +233,20 @@ namespace FLD
             splitvel  ///> container with split velocity vector
     );
 
+    //! Condensation operation for a sparse matrix (including ALE case):
+    /// the slave columns of the sysmat are redirected to the master columns (weights of P) and
+    /// the slave rows to the master rows (weights of P^T) in a single pass over the assembled
+    /// rows; neither a split of the sysmat nor matrix-matrix products are needed
+    void condensation_operation_redirect_sparse_matrix(
+        Core::LinAlg::SparseOperator& sysmat,    ///> sysmat established by the element routine
+        Core::LinAlg::Vector<double>& residual,  ///> residual established by the element routine
+        Core::LinAlg::Vector<double>& velnp);    ///> current velocity vector
+
+    //! Set up the projection of the slave column dofs of the sysmat onto the master dofs
+    /// (only if the column layout of the sysmat has changed)
+    void setup_slave_column_projection(const Epetra_CrsMatrix& sysmat,  ///> assembled sysmat
+        const Epetra_CrsMatrix& P);  ///> mortar projection (rows: slave dofs, cols: master dofs)
+
     //! Condensation operation for a block matrix (including ALE case):
     /// the original blocks (nn, nm, mn, mm) are manipulated directly;
     /// the remaining blocks (ns, ms, ss, sn, sm) are not touched at all,
@@ -334,6 +351,23 @@ namespace FLD
     //! flag for multifield problems in multifield simulation
     bool is_multifield_;
 
+    //! column map of the sysmat the slave column projection was set up for
+    std::shared_ptr<Epetra_Map> projectioncolmap_;
+
+    //! number of nonzeros of the sysmat the slave column projection was set up for
+    int projectionnonzeros_;
+
+    //! flag for each local column of the sysmat whether it is a slave dof
+    std::vector<bool> colisslave_;
+
+    //! master dofs and weights of P for each local slave column of the sysmat (compressed rows)
+    std::vector<int> colprojptr_;
+    std::vector<int> colprojgids_;
+    std::vector<double> colprojweights_;
+
+    //! condensed sysmat, keeps its graph between the condensation operations
+    std::shared_ptr<Core::LinAlg::SparseMatrix> condensedsysmat_;
+
   };  // end  class Meshtying
 }  // end namespace FLD
 
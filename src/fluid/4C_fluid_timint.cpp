@@ -12,7 +12,9 @@
 #include "4C_fluid_utils_mapextractor.hpp"
 #include "4C_global_data.hpp"
 #include "4C_inpar_fluid.hpp"
+#include "4C_io_discretization_probe_writer.hpp"
 #include "4C_io_discretization_visualization_writer_mesh.hpp"
+#include "4C_io_file_reader.hpp"
 #include "4C_io_visualization_parameters.hpp"
 #include "4C_utils_parameter_list.hpp"
 #include "4C_utils_shared_ptr_from_ref.hpp"
@@ -20,6 +22,7 @@
 #include <Epetra_Map.h>
 #include <Teuchos_ParameterList.hpp>
 
+#include <filesystem>
 #include <memory>
 
 FOUR_C_NAMESPACE_OPEN
@@ -34,6 +37,8 @@ FLD::TimInt::TimInt(const std::shared_ptr<Core::FE::Discretization>& discret,
       output_(output),
       runtime_output_writer_(nullptr),
       runtime_output_params_(),
+      probe_writer_(nullptr),
+      probe_interval_(1),
       time_(0.0),
       step_(0),
       dta_(params_->get<double>("time step size")),
@@ -72,6 +77,43 @@ FLD::TimInt::TimInt(const std::shared_ptr<Core::FE::Discretization>& discret,
                       Global::Problem::instance()->io_params().sublist("RUNTIME VTK OUTPUT"),
                       *Global::Problem::instance()->output_control_file(), time_));
   }
+
+  // probe output at points given in a separate csv file
+  const Teuchos::ParameterList& probe_output_list =
+      Global::Problem::instance()->io_params().sublist("RUNTIME PROBE OUTPUT").sublist("FLUID");
+
+  const auto probe_file = probe_output_list.get<std::string>("PROBE_FILE");
+  if (probe_file != "none")
+  {
+    std::filesystem::path probe_file_path(probe_file);
+    if (probe_file_path.is_relative())
+    {
+      probe_file_path = std::filesystem::path(
+                            Global::Problem::instance()->output_control_file()->input_file_name())
+                            .parent_path() /
+                        probe_file_path;
+    }
+
+    // one column per spatial dimension, the writer rejects discretizations other than 3D
+    const int numdim = Global::Problem::instance()->n_dim();
+    const std::vector<std::vector<double>> coordinates =
+        Core::IO::read_csv_as_columns(numdim, probe_file_path.string());
+
+    std::vector<std::array<double, 3>> probes(coordinates[0].size());
+    for (std::size_t i = 0; i < probes.size(); ++i)
+      for (int d = 0; d < numdim; ++d) probes[i][d] = coordinates[d][i];
+
+    probe_interval_ = probe_output_list.get<int>("INTERVAL_STEPS");
+    if (probe_interval_ < 1) FOUR_C_THROW("INTERVAL_STEPS of the probe output must be positive.");
+
+    probe_writer_ = std::make_shared<Core::IO::DiscretizationProbeWriter>(discret_,
+        std::move(probes), *Global::Problem::instance()->output_control_file(), "fluid_probes");
+
+    if (probe_output_list.get<bool>("VELOCITY"))
+      probe_writer_->register_field("velocity", 0, numdim);
+    if (probe_output_list.get<bool>("PRESSURE"))
+      probe_writer_->register_field("pressure", numdim, 1);
+  }
 }
 
 std::shared_ptr<const Epetra_Map> FLD::TimInt::dof_row_map(unsigned nds)
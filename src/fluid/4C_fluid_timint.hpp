@@ -40,6 +40,7 @@ namespace Core::IO
 {
   class DiscretizationWriter;
   class DiscretizationVisualizationWriterMesh;
+  class DiscretizationProbeWriter;
 }  // namespace Core::IO
 
 namespace FLD
@@ -740,6 +741,12 @@ namespace FLD
     /// runtime output parameter
     Discret::Elements::FluidRuntimeOutputParams runtime_output_params_;
 
+    /// probe output writer sampling velocity and pressure at points given in the input
+    std::shared_ptr<Core::IO::DiscretizationProbeWriter> probe_writer_;
+
+    /// write probe output every probe_interval_ steps
+    int probe_interval_;
+
     //! @name Time loop stuff
     //@{
 
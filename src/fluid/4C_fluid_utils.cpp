@@ -945,11 +945,11 @@ void FLD::Utils::write_doubles_to_file(
  *----------------------------------------------------------------------*/
 void FLD::Utils::project_gradient_and_set_param(Core::FE::Discretization& discret,
     Teuchos::ParameterList& eleparams, std::shared_ptr<const Core::LinAlg::Vector<double>> vel,
-    const std::string paraname, bool alefluid)
+    const std::string paraname, bool alefluid, Core::FE::NodalL2Projection* projection)
 {
   // project gradient
   std::shared_ptr<Core::LinAlg::MultiVector<double>> projected_velgrad =
-      FLD::Utils::project_gradient(discret, vel, alefluid);
+      FLD::Utils::project_gradient(discret, vel, alefluid, projection);
 
   // store multi vector in parameter list after export to col layout
   if (projected_velgrad != nullptr)
@@ -964,7 +964,7 @@ void FLD::Utils::project_gradient_and_set_param(Core::FE::Discretization& discre
  *----------------------------------------------------------------------*/
 std::shared_ptr<Core::LinAlg::MultiVector<double>> FLD::Utils::project_gradient(
     Core::FE::Discretization& discret, std::shared_ptr<const Core::LinAlg::Vector<double>> vel,
-    bool alefluid)
+    bool alefluid, Core::FE::NodalL2Projection* projection)
 {
   // reconstruction of second derivatives for fluid residual
   auto recomethod = Teuchos::getIntegralValue<Inpar::FLUID::GradientReconstructionMethod>(
@@ -1016,10 +1016,15 @@ std::shared_ptr<Core::LinAlg::MultiVector<double>> FLD::Utils::project_gradient(
     break;
     case Inpar::FLUID::gradreco_l2:
     {
-      const int solvernumber =
-          Global::Problem::instance()->fluid_dynamic_params().get<int>("VELGRAD_PROJ_SOLVER");
-      if (solvernumber < 1) FOUR_C_THROW("you have to specify a VELGRAD_PROJ_SOLVER");
-      const auto& solverparams = Global::Problem::instance()->solver_params(solvernumber);
+      std::shared_ptr<Core::FE::NodalL2Projection> local_projection = nullptr;
+      if (projection == nullptr)
+      {
+        local_projection = create_gradient_projection();
+        projection = local_projection.get();
+      }
+      // the mass matrix changes with the moving mesh
+      else if (alefluid)
+        projection->reset();
 
       params.set<FLD::Action>("action", FLD::velgradient_projection);
 
@@ -1028,8 +1033,7 @@ std::shared_ptr<Core::LinAlg::MultiVector<double>> FLD::Utils::project_gradient(
       discret.set_state("vel", vel);
 
       // project velocity gradient of fluid to nodal level via L2 projection
-      projected_velgrad = Core::FE::compute_nodal_l2_projection(discret, "vel", numvec, params,
-          solverparams, Global::Problem::instance()->solver_params_callback());
+      projected_velgrad = projection->project(discret, "vel", numvec, params);
     }
     break;
     default:
@@ -1040,4 +1044,29 @@ std::shared_ptr<Core::LinAlg::MultiVector<double>> FLD::Utils::project_gradient(
   return projected_velgrad;
 }
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+std::shared_ptr<Core::FE::NodalL2Projection> FLD::Utils::create_gradient_projection()
+{
+  const Teuchos::ParameterList& fdyn = Global::Problem::instance()->fluid_dynamic_params();
+  if (Teuchos::getIntegralValue<Inpar::FLUID::GradientReconstructionMethod>(
+          fdyn, "VELGRAD_PROJ_METHOD") != Inpar::FLUID::gradreco_l2)
+    return nullptr;
+
+  // the lumped mass matrix does not need a linear solver
+  if (fdyn.get<bool>("VELGRAD_PROJ_LUMPED_MASS"))
+  {
+    return std::make_shared<Core::FE::NodalL2Projection>(Teuchos::ParameterList(),
+        Global::Problem::instance()->solver_params_callback(),
+        Core::FE::NodalL2Projection::MassMatrix::lumped);
+  }
+
+  const int solvernumber = fdyn.get<int>("VELGRAD_PROJ_SOLVER");
+  if (solvernumber < 1) FOUR_C_THROW("you have to specify a VELGRAD_PROJ_SOLVER");
+
+  return std::make_shared<Core::FE::NodalL2Projection>(
+      Global::Problem::instance()->solver_params(solvernumber),
+      Global::Problem::instance()->solver_params_callback());
+}
+
 FOUR_C_NAMESPACE_CLOSE
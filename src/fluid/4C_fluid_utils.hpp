@@ -26,6 +26,11 @@ namespace Core::DOFSets
   class DofSetInterface;
 }  // namespace Core::DOFSets
 
+namespace Core::FE
+{
+  class NodalL2Projection;
+}
+
 namespace Core::LinAlg
 {
   class MultiMapExtractor;
@@ -536,15 +541,25 @@ namespace FLD
     */
     void project_gradient_and_set_param(Core::FE::Discretization& discret,
         Teuchos::ParameterList& eleparams, std::shared_ptr<const Core::LinAlg::Vector<double>> vel,
-        const std::string paraname, bool alefluid);
+        const std::string paraname, bool alefluid,
+        Core::FE::NodalL2Projection* projection = nullptr);
 
     /*!
     \brief Project velocity gradient, depends on time integrator used
 
+    If a projection created by create_gradient_projection() is passed, its mass matrix is kept
+    for subsequent calls. Otherwise the L2 projection sets up its mass matrix anew.
     */
     std::shared_ptr<Core::LinAlg::MultiVector<double>> project_gradient(
         Core::FE::Discretization& discret, std::shared_ptr<const Core::LinAlg::Vector<double>> vel,
-        bool alefluid);
+        bool alefluid, Core::FE::NodalL2Projection* projection = nullptr);
+
+    /*!
+    \brief Create the L2 projection of the velocity gradient
+
+    \return the projection if VELGRAD_PROJ_METHOD is L2_projection, nullptr otherwise
+    */
+    std::shared_ptr<Core::FE::NodalL2Projection> create_gradient_projection();
 
   }  // namespace Utils
 }  // namespace FLD
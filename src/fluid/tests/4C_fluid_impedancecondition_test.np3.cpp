@@ -0,0 +1,62 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_fluid_impedancecondition.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_linalg_sparsematrix.hpp"
+
+#include <Epetra_Map.h>
+
+#include <cmath>
+
+namespace
+{
+  using namespace FourC;
+
+  TEST(FlowRateLinearizationTest, RankOneOutletBlock)
+  {
+    // the outlet dofs are spread over all procs, all other entries of dQdu vanish
+    constexpr int numdofs = 30;
+    constexpr double tfaclhs = 0.7;
+    const Epetra_Map dofrowmap(numdofs, 0, Core::Communication::as_epetra_comm(MPI_COMM_WORLD));
+
+    Core::LinAlg::Vector<double> dQdu(dofrowmap, true);
+    Core::LinAlg::Vector<double> x(dofrowmap, true);
+    int my_num_outlet_dofs = 0;
+    for (int lid = 0; lid < dofrowmap.NumMyElements(); ++lid)
+    {
+      const int gid = dofrowmap.GID(lid);
+      if (gid % 4 == 1)
+      {
+        dQdu[lid] = 0.1 * gid - 1.0;
+        ++my_num_outlet_dofs;
+      }
+      x[lid] = 1.0 + 0.05 * gid * gid;
+    }
+    int num_outlet_dofs = 0;
+    Core::Communication::sum_all(&my_num_outlet_dofs, &num_outlet_dofs, 1, MPI_COMM_WORLD);
+
+    Core::LinAlg::SparseMatrix sysmat(dofrowmap, 8, false, true);
+    FLD::Utils::assemble_flow_rate_linearization(dQdu, tfaclhs, sysmat);
+    sysmat.complete();
+
+    // only the outlet block is populated
+    EXPECT_EQ(sysmat.epetra_matrix()->NumGlobalNonzeros(), num_outlet_dofs * num_outlet_dofs);
+
+    // sysmat x = tfaclhs dQdu (dQdu^T x)
+    double dQdu_x = 0.0;
+    dQdu.Dot(x, &dQdu_x);
+
+    Core::LinAlg::Vector<double> result(dofrowmap, true);
+    sysmat.multiply(false, x, result);
+    for (int lid = 0; lid < dofrowmap.NumMyElements(); ++lid)
+      EXPECT_NEAR(result[lid], tfaclhs * dQdu[lid] * dQdu_x, 1.0e-12 * std::abs(dQdu_x));
+  }
+}  // namespace
@@ -0,0 +1,250 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_fluid_meshtying.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_fem_discretization.hpp"
+#include "4C_global_data.hpp"
+#include "4C_linalg_blocksparsematrix.hpp"
+#include "4C_linear_solver_method_linalg.hpp"
+#include "4C_utils_singleton_owner.hpp"
+
+#include <Epetra_Map.h>
+
+#include <map>
+#include <set>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace FLD
+{
+  namespace
+  {
+    //! mortar adapter which only provides a given projection from the master to the slave dofs
+    class ProjectionMortarAdapter : public Coupling::Adapter::CouplingMortar
+    {
+     public:
+      ProjectionMortarAdapter(std::shared_ptr<Core::LinAlg::SparseMatrix> projection)
+          : Coupling::Adapter::CouplingMortar(3, Teuchos::ParameterList(),
+                Teuchos::ParameterList(), Core::FE::ShapeFunctionType::polynomial),
+            projection_(std::move(projection))
+      {
+      }
+
+      std::shared_ptr<Core::LinAlg::SparseMatrix> get_mortar_matrix_p() const override
+      {
+        return projection_;
+      }
+
+     private:
+      std::shared_ptr<Core::LinAlg::SparseMatrix> projection_;
+    };
+  }  // namespace
+
+  /** The tests condense a system of interior (gid % 3 == 0), master (gid % 3 == 1) and slave
+   *  (gid % 3 == 2) dofs, where no master dof is coupled to a slave dof, once with the split of
+   *  the sysmat and once with the redirection of the slave rows and columns. Each slave dof is
+   *  projected onto two master dofs.
+   */
+  class MeshtyingCondensationTest : public testing::Test
+  {
+   protected:
+    MeshtyingCondensationTest()
+        : solver_(solver_parameters(), MPI_COMM_WORLD, nullptr, Core::IO::minimal, false)
+    {
+      Global::Problem::instance()->set_parameter_list(std::make_shared<Teuchos::ParameterList>());
+    }
+
+    static Teuchos::ParameterList solver_parameters()
+    {
+      Teuchos::ParameterList params;
+      params.set("solver", "umfpack");
+      return params;
+    }
+
+    //! set up the dof maps and the mortar projection on the communicator @p comm
+    void setup(MPI_Comm comm)
+    {
+      dofrowmap_ =
+          std::make_shared<Epetra_Map>(num_dofs_, 0, Core::Communication::as_epetra_comm(comm));
+
+      std::vector<std::vector<int>> gids(3);
+      std::vector<int> smgids;
+      for (int lid = 0; lid < dofrowmap_->NumMyElements(); ++lid)
+      {
+        const int gid = dofrowmap_->GID(lid);
+        gids[gid % 3].push_back(gid);
+        if (gid % 3 != 0) smgids.push_back(gid);
+      }
+      auto make_map = [&](const std::vector<int>& map_gids)
+      {
+        return std::make_shared<Epetra_Map>(
+            -1, static_cast<int>(map_gids.size()), map_gids.data(), 0, dofrowmap_->Comm());
+      };
+
+      auto projection = std::make_shared<Core::LinAlg::SparseMatrix>(*make_map(gids[2]), 2);
+      for (const int slave : gids[2])
+      {
+        projection->assemble(0.6, slave, slave - 1);
+        projection->assemble(0.4, slave, (slave + 5) % num_dofs_);
+      }
+      projection->complete(*make_map(gids[1]), *make_map(gids[2]));
+
+      discretization_ = std::make_shared<Core::FE::Discretization>("fluid", comm, 3);
+      meshtying_ = std::make_shared<Meshtying>(
+          discretization_, solver_, Inpar::FLUID::condensed_smat, 3, nullptr);
+      meshtying_->dofrowmap_ = dofrowmap_.get();
+      meshtying_->gndofrowmap_ = make_map(gids[0]);
+      meshtying_->gmdofrowmap_ = make_map(gids[1]);
+      meshtying_->gsdofrowmap_ = make_map(gids[2]);
+      meshtying_->gsmdofrowmap_ = make_map(smgids);
+      meshtying_->adaptermeshtying_ = std::make_shared<ProjectionMortarAdapter>(projection);
+    }
+
+    //! sysmat coupling each dof to dofs on other processors, but no master to a slave dof
+    std::shared_ptr<Core::LinAlg::SparseMatrix> sysmat() const
+    {
+      auto A = std::make_shared<Core::LinAlg::SparseMatrix>(*dofrowmap_, 7, false, true);
+      for (int lid = 0; lid < dofrowmap_->NumMyElements(); ++lid)
+      {
+        const int row = dofrowmap_->GID(lid);
+        std::set<int> cols;
+        for (const int offset : {0, 1, -1, 4, -4, 7, -7})
+          cols.insert((row + offset + num_dofs_) % num_dofs_);
+
+        for (const int col : cols)
+        {
+          if ((row % 3) * (col % 3) == 2) continue;
+          A->assemble(row == col ? 10.0 + 0.1 * row : 1.0 + 0.1 * row - 0.03 * col, row, col);
+        }
+      }
+      A->complete();
+      return A;
+    }
+
+    //! vector with distinct entries which do not fulfill the coupling condition
+    std::shared_ptr<Core::LinAlg::Vector<double>> vector(const double factor) const
+    {
+      auto v = std::make_shared<Core::LinAlg::Vector<double>>(*dofrowmap_, true);
+      for (int lid = 0; lid < dofrowmap_->NumMyElements(); ++lid)
+        (*v)[lid] = factor * (1.0 + 0.2 * dofrowmap_->GID(lid) - 0.01 * lid * lid);
+      return v;
+    }
+
+    //! condensation with the split of the sysmat into the interior, master and slave blocks
+    void condense_split(std::shared_ptr<Core::LinAlg::SparseOperator> sysmat,
+        Core::LinAlg::Vector<double>& residual, Core::LinAlg::Vector<double>& velnp)
+    {
+      std::shared_ptr<Core::LinAlg::BlockSparseMatrixBase> splitmatrix;
+      std::vector<std::shared_ptr<Core::LinAlg::Vector<double>>> splitres(3);
+      std::vector<std::shared_ptr<Core::LinAlg::Vector<double>>> splitvel(3);
+      meshtying_->split_matrix(sysmat, splitmatrix);
+      meshtying_->split_vector(residual, splitres);
+      meshtying_->split_vector(velnp, splitvel);
+
+      meshtying_->condensation_operation_sparse_matrix(
+          *sysmat, residual, *splitmatrix, splitres, splitvel);
+    }
+
+    //! condensation with the redirection of the slave rows and columns
+    void condense_redirect(std::shared_ptr<Core::LinAlg::SparseOperator> sysmat,
+        Core::LinAlg::Vector<double>& residual, Core::LinAlg::Vector<double>& velnp)
+    {
+      meshtying_->condensation_operation_redirect_sparse_matrix(*sysmat, residual, velnp);
+    }
+
+    //! condense the same system with both versions and compare the results
+    void expect_equal_condensation()
+    {
+      const auto split_sysmat = sysmat();
+      const auto split_residual = vector(1.0);
+      const auto split_velnp = vector(-0.5);
+      condense_split(split_sysmat, *split_residual, *split_velnp);
+
+      // the redirection is repeated to reuse the graph of the condensed sysmat
+      for (int repetition = 0; repetition < 2; ++repetition)
+      {
+        const auto redirect_sysmat = sysmat();
+        const auto redirect_residual = vector(1.0);
+        const auto redirect_velnp = vector(-0.5);
+        condense_redirect(redirect_sysmat, *redirect_residual, *redirect_velnp);
+
+        expect_near(*redirect_sysmat->epetra_matrix(), *split_sysmat->epetra_matrix());
+        for (int lid = 0; lid < dofrowmap_->NumMyElements(); ++lid)
+          EXPECT_NEAR((*redirect_residual)[lid], (*split_residual)[lid], tol_);
+      }
+    }
+
+    //! expect that @p actual and @p expected have the same nonzero entries
+    void expect_near(const Epetra_CrsMatrix& actual, const Epetra_CrsMatrix& expected) const
+    {
+      ASSERT_TRUE(actual.RowMap().SameAs(expected.RowMap()));
+      for (int lid = 0; lid < expected.NumMyRows(); ++lid)
+      {
+        std::map<int, double> actual_row = row_entries(actual, lid);
+        std::map<int, double> expected_row = row_entries(expected, lid);
+        for (const auto& [col, value] : expected_row) actual_row.try_emplace(col, 0.0);
+        for (const auto& [col, value] : actual_row) expected_row.try_emplace(col, 0.0);
+
+        for (const auto& [col, value] : expected_row)
+          EXPECT_NEAR(actual_row.at(col), value, tol_)
+              << "row " << expected.GRID(lid) << ", column " << col;
+      }
+    }
+
+    static std::map<int, double> row_entries(const Epetra_CrsMatrix& A, const int lid)
+    {
+      int numentries;
+      double* values;
+      int* indices;
+      A.ExtractMyRowView(lid, numentries, values, indices);
+
+      std::map<int, double> entries;
+      for (int j = 0; j < numentries; ++j) entries[A.GCID(indices[j])] += values[j];
+      return entries;
+    }
+
+    static constexpr int num_dofs_ = 18;
+    static constexpr double tol_ = 1.0e-12;
+
+    Core::Utils::SingletonOwnerRegistry::ScopeGuard guard_;
+    Core::LinAlg::Solver solver_;
+    std::shared_ptr<Epetra_Map> dofrowmap_;
+    std::shared_ptr<Core::FE::Discretization> discretization_;
+    std::shared_ptr<Meshtying> meshtying_;
+  };
+
+  TEST_F(MeshtyingCondensationTest, RedirectionMatchesSplitSerial)
+  {
+    setup(MPI_COMM_SELF);
+    expect_equal_condensation();
+  }
+
+  TEST_F(MeshtyingCondensationTest, RedirectionMatchesSplitWithGhostedSlaveColumns)
+  {
+    setup(MPI_COMM_WORLD);
+
+    // the sysmat has slave columns owned by other processors
+    const auto A = sysmat();
+    const Epetra_Map& colmap = A->epetra_matrix()->ColMap();
+    int my_ghosted_slave_columns = 0;
+    for (int lid = 0; lid < colmap.NumMyElements(); ++lid)
+      if (colmap.GID(lid) % 3 == 2 and !dofrowmap_->MyGID(colmap.GID(lid)))
+        ++my_ghosted_slave_columns;
+    int ghosted_slave_columns = 0;
+    Core::Communication::sum_all(
+        &my_ghosted_slave_columns, &ghosted_slave_columns, 1, MPI_COMM_WORLD);
+    EXPECT_GT(ghosted_slave_columns, 0);
+
+    expect_equal_condensation();
+  }
+}  // namespace FLD
+
+FOUR_C_NAMESPACE_CLOSE
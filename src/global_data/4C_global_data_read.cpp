@@ -1785,6 +1785,7 @@ void Global::read_parameter(Global::Problem& problem, Core::IO::InputFile& input
   Core::IO::read_parameters_in_section(input, "IO/RUNTIME VTK OUTPUT/FLUID", *list);
   Core::IO::read_parameters_in_section(input, "IO/RUNTIME VTK OUTPUT/STRUCTURE", *list);
   Core::IO::read_parameters_in_section(input, "IO/RUNTIME VTK OUTPUT/BEAMS", *list);
+  Core::IO::read_parameters_in_section(input, "IO/RUNTIME PROBE OUTPUT/FLUID", *list);
   Core::IO::read_parameters_in_section(input, "IO/RUNTIME VTP OUTPUT STRUCTURE", *list);
   Core::IO::read_parameters_in_section(input, "STRUCTURAL DYNAMIC", *list);
   Core::IO::read_parameters_in_section(input, "STRUCTURAL DYNAMIC/TIMEADAPTIVITY", *list);
@@ -96,8 +96,15 @@ void immersed_problem_drt()
           // init algo
           algo->init(params);
 
-          // ghost structure redundantly on all procs
-          Core::Rebalance::ghost_discretization_on_all_procs(*problem->get_dis("structure"));
+          // ghost structure redundantly on all procs or only near the fluid of each proc
+          if (immersedmethodparams.get<bool>("GHOST_STRUCTURE_REDUNDANTLY"))
+            Core::Rebalance::ghost_discretization_on_all_procs(*problem->get_dis("structure"));
+          else
+          {
+            Immersed::ghost_immersed_discretization_near_background(*problem->get_dis("structure"),
+                *problem->get_dis("fluid"),
+                immersedmethodparams.get<double>("STRUCTURE_GHOSTING_MARGIN"));
+          }
 
           // setup algo
           algo->setup();
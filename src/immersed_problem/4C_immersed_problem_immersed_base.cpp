@@ -9,10 +9,17 @@
 
 #include "4C_adapter_fld_wrapper.hpp"
 #include "4C_adapter_str_fsiwrapper_immersed.hpp"
+#include "4C_comm_mpi_utils.hpp"
 #include "4C_io_control.hpp"
+#include "4C_linalg_utils_densematrix_communication.hpp"
 #include "4C_linalg_utils_sparse_algebra_math.hpp"
 #include "4C_utils_function_of_time.hpp"
 
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <set>
+
 FOUR_C_NAMESPACE_OPEN
 
 
@@ -520,6 +527,115 @@ void Immersed::ImmersedBase::evaluate_interpolation_condition(Core::FE::Discreti
   return;
 }  // evaluate_interpolation_condition
 
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+void Immersed::ghost_immersed_discretization_near_background(Core::FE::Discretization& immerseddis,
+    const Core::FE::Discretization& backgrddis, const double margin)
+{
+  MPI_Comm comm = immerseddis.get_comm();
+  const int myrank = Core::Communication::my_mpi_rank(comm);
+  const int numproc = Core::Communication::num_mpi_ranks(comm);
+
+  // the ghosting is not updated, a structure leaving the box would be missing on this proc
+  if (margin <= 0.0)
+  {
+    FOUR_C_THROW(
+        "STRUCTURE_GHOSTING_MARGIN has to be positive if the immersed discretization is not "
+        "ghosted redundantly, got %f.",
+        margin);
+  }
+
+  if (myrank == 0)
+  {
+    std::cout << "\n Ghost " << immerseddis.name() << " near the " << backgrddis.name()
+              << " of each proc (margin " << margin << ") ..." << std::endl;
+  }
+
+  // bounding box (xmin, xmax, ymin, ymax, zmin, zmax) of the background column nodes of this proc
+  std::array<double, 6> mybox;
+  for (int dim = 0; dim < 3; ++dim)
+  {
+    mybox[2 * dim] = std::numeric_limits<double>::max();
+    mybox[2 * dim + 1] = std::numeric_limits<double>::lowest();
+  }
+  for (int lid = 0; lid < backgrddis.num_my_col_nodes(); ++lid)
+  {
+    const auto& x = backgrddis.l_col_node(lid)->x();
+    for (int dim = 0; dim < 3; ++dim)
+    {
+      mybox[2 * dim] = std::min(mybox[2 * dim], x[dim] - margin);
+      mybox[2 * dim + 1] = std::max(mybox[2 * dim + 1], x[dim] + margin);
+    }
+  }
+  std::vector<double> boxes(6 * numproc);
+  Core::Communication::gather_all(mybox.data(), boxes.data(), 6, comm);
+
+  // send each immersed row element to all other procs whose bounding box it intersects
+  std::vector<std::vector<int>> elestosend(numproc);
+  for (int lid = 0; lid < immerseddis.num_my_row_elements(); ++lid)
+  {
+    const Core::Elements::Element* ele = immerseddis.l_row_element(lid);
+
+    std::array<double, 6> elebox;
+    for (int dim = 0; dim < 3; ++dim)
+    {
+      elebox[2 * dim] = std::numeric_limits<double>::max();
+      elebox[2 * dim + 1] = std::numeric_limits<double>::lowest();
+    }
+    for (int inode = 0; inode < ele->num_node(); ++inode)
+    {
+      const auto& x = ele->nodes()[inode]->x();
+      for (int dim = 0; dim < 3; ++dim)
+      {
+        elebox[2 * dim] = std::min(elebox[2 * dim], x[dim]);
+        elebox[2 * dim + 1] = std::max(elebox[2 * dim + 1], x[dim]);
+      }
+    }
+
+    for (int iproc = 0; iproc < numproc; ++iproc)
+    {
+      if (iproc == myrank) continue;
+
+      bool intersects = true;
+      for (int dim = 0; dim < 3; ++dim)
+      {
+        if (elebox[2 * dim] > boxes[6 * iproc + 2 * dim + 1] or
+            boxes[6 * iproc + 2 * dim] > elebox[2 * dim + 1])
+          intersects = false;
+      }
+      if (intersects) elestosend[iproc].push_back(ele->id());
+    }
+  }
+  std::vector<int> elestoghost;
+  Core::LinAlg::all_to_all_communication(comm, elestosend, elestoghost);
+
+  // extended ghosting for elements
+  std::set<int> elecolset(elestoghost.begin(), elestoghost.end());
+  const Epetra_Map* elecolmap = immerseddis.element_col_map();
+  for (int lid = 0; lid < elecolmap->NumMyElements(); ++lid) elecolset.insert(elecolmap->GID(lid));
+
+  std::vector<int> coleles(elecolset.begin(), elecolset.end());
+  const Epetra_Map extendedelecolmap(
+      -1, coleles.size(), coleles.data(), 0, Core::Communication::as_epetra_comm(comm));
+  immerseddis.export_column_elements(extendedelecolmap);
+
+  // extended ghosting for nodes
+  std::set<int> nodecolset;
+  const Epetra_Map* nodecolmap = immerseddis.node_col_map();
+  for (int lid = 0; lid < nodecolmap->NumMyElements(); ++lid)
+    nodecolset.insert(nodecolmap->GID(lid));
+  for (const int elegid : elestoghost)
+  {
+    const Core::Elements::Element* ele = immerseddis.g_element(elegid);
+    nodecolset.insert(ele->node_ids(), ele->node_ids() + ele->num_node());
+  }
+
+  std::vector<int> colnodes(nodecolset.begin(), nodecolset.end());
+  const Epetra_Map extendednodecolmap(
+      -1, colnodes.size(), colnodes.data(), 0, Core::Communication::as_epetra_comm(comm));
+  immerseddis.export_column_nodes(extendednodecolmap);
+}
+
 /*----------------------------------------------------------------------*/
 /*----------------------------------------------------------------------*/
 void Immersed::ImmersedBase::search_potentially_covered_backgrd_elements(
@@ -332,6 +332,19 @@ namespace Immersed
 
   };  // class ImmersedBase
 
+  /*!
+  \brief ghost the immersed discretization only near the background discretization of each proc
+
+  Instead of ghosting the immersed discretization redundantly on all procs, every proc
+  additionally ghosts the immersed elements whose bounding box (reference configuration)
+  intersects the bounding box of its background column nodes enlarged by margin. The margin has
+  to be positive and cover the motion of the immersed structure and the search radius of the
+  interpolation, since the ghosting is not updated afterwards.
+
+  */
+  void ghost_immersed_discretization_near_background(Core::FE::Discretization& immerseddis,
+      const Core::FE::Discretization& backgrddis, double margin);
+
 
   /*!
   \brief interpolate quantity from the background field to a given immersed point
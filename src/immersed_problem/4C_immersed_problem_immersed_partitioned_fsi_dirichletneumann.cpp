@@ -9,6 +9,7 @@
 
 #include "4C_adapter_fld_fluid_immersed.hpp"
 #include "4C_adapter_str_fsiwrapper_immersed.hpp"
+#include "4C_comm_mpi_utils.hpp"
 #include "4C_fem_geometry_searchtree.hpp"
 #include "4C_fem_geometry_searchtree_service.hpp"
 #include "4C_fluid_ele_action.hpp"
@@ -16,13 +17,43 @@
 #include "4C_immersed_problem_fsi_partitioned_immersed.hpp"
 #include "4C_inpar_fsi.hpp"
 #include "4C_inpar_immersed.hpp"
-#include "4C_linalg_utils_densematrix_communication.hpp"
+#include "4C_linalg_utils_sparse_algebra_manipulation.hpp"
 #include "4C_structure_aux.hpp"
 
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <limits>
+
 FOUR_C_NAMESPACE_OPEN
 
+namespace
+{
+  /*!
+   * \brief reduce the bounding boxes of the parts of the structure available on each proc to the
+   * bounding box of the whole structure (procs without any part do not contribute)
+   */
+  Core::LinAlg::Matrix<3, 2> reduce_xaabb(
+      const Core::LinAlg::Matrix<3, 2>& myxaabb, const bool isempty, MPI_Comm comm)
+  {
+    double mymin[3], mymax[3], min[3], max[3];
+    for (int dim = 0; dim < 3; ++dim)
+    {
+      mymin[dim] = isempty ? std::numeric_limits<double>::max() : myxaabb(dim, 0);
+      mymax[dim] = isempty ? std::numeric_limits<double>::lowest() : myxaabb(dim, 1);
+    }
+    Core::Communication::min_all(mymin, min, 3, comm);
+    Core::Communication::max_all(mymax, max, 3, comm);
+
+    Core::LinAlg::Matrix<3, 2> xaabb;
+    for (int dim = 0; dim < 3; ++dim)
+    {
+      xaabb(dim, 0) = min[dim];
+      xaabb(dim, 1) = max[dim];
+    }
+    return xaabb;
+  }
+}  // namespace
+
 Immersed::ImmersedPartitionedFSIDirichletNeumann::ImmersedPartitionedFSIDirichletNeumann(
     MPI_Comm comm)
     : ImmersedBase(),
@@ -538,30 +569,26 @@ void Immersed::ImmersedPartitionedFSIDirichletNeumann::do_immersed_dirichlet_con
 void Immersed::ImmersedPartitionedFSIDirichletNeumann::setup_structural_discretization()
 {
   // find positions of the immersed structural discretization
-  std::map<int, Core::LinAlg::Matrix<3, 1>> my_currpositions_struct;
-  for (int lid = 0; lid < structdis_->num_my_row_nodes(); ++lid)
+  // (all nodes if the structure is ghosted redundantly on all procs)
+  currpositions_struct_.clear();
+  for (int lid = 0; lid < structdis_->num_my_col_nodes(); ++lid)
   {
-    const Core::Nodes::Node* node = structdis_->l_row_node(lid);
+    const Core::Nodes::Node* node = structdis_->l_col_node(lid);
     Core::LinAlg::Matrix<3, 1> currpos;
 
     currpos(0) = node->x()[0];
     currpos(1) = node->x()[1];
     currpos(2) = node->x()[2];
 
-    my_currpositions_struct[node->id()] = currpos;
+    currpositions_struct_[node->id()] = currpos;
   }
-  // Communicate local currpositions:
-  // map with current structural positions should be same on all procs
-  // to make use of the advantages of ghosting the structure redundantly
-  // on all procs.
-  std::vector<int> procs(numproc_);
-  for (int i = 0; i < numproc_; i++) procs[i] = i;
-  Core::LinAlg::gather<int, Core::LinAlg::Matrix<3, 1>>(
-      my_currpositions_struct, currpositions_struct_, numproc_, procs.data(), get_comm());
 
   // find the bounding box of the elements and initialize the search tree
+  // (a proc without structural elements gets an empty tree in its fluid domain)
   const Core::LinAlg::Matrix<3, 2> rootBox2 =
-      Core::Geo::get_xaab_bof_dis(*structdis_, currpositions_struct_);
+      currpositions_struct_.empty()
+          ? Core::Geo::get_xaab_bof_positions(currpositions_fluid_)
+          : Core::Geo::get_xaab_bof_dis(*structdis_, currpositions_struct_);
   structure_SearchTree_->initialize_tree(
       rootBox2, *structdis_, Core::Geo::TreeType(Core::Geo::OCTTREE));
 
@@ -636,41 +663,39 @@ void Immersed::ImmersedPartitionedFSIDirichletNeumann::prepare_fluid_op()
   // get state
   std::shared_ptr<const Core::LinAlg::Vector<double>> displacements = immersedstructure_->dispnp();
 
-  // find current positions for immersed structural discretization
-  std::map<int, Core::LinAlg::Matrix<3, 1>> my_currpositions_struct;
-  for (int lid = 0; lid < structdis_->num_my_row_nodes(); ++lid)
+  // find current positions for the column nodes of the immersed structural discretization
+  // (all nodes if the structure is ghosted redundantly on all procs)
+  Core::LinAlg::Vector<double> displacements_col(*structdis_->dof_col_map(), true);
+  Core::LinAlg::export_to(*displacements, displacements_col);
+
+  currpositions_struct_.clear();
+  for (int lid = 0; lid < structdis_->num_my_col_nodes(); ++lid)
   {
-    const Core::Nodes::Node* node = structdis_->l_row_node(lid);
+    const Core::Nodes::Node* node = structdis_->l_col_node(lid);
     Core::LinAlg::Matrix<3, 1> currpos;
     std::vector<int> dofstoextract(3);
     std::vector<double> mydisp(3);
 
     // get the current displacement
     structdis_->dof(node, 0, dofstoextract);
-    Core::FE::extract_my_values(*displacements, mydisp, dofstoextract);
+    Core::FE::extract_my_values(displacements_col, mydisp, dofstoextract);
 
     currpos(0) = node->x()[0] + mydisp.at(0);
     currpos(1) = node->x()[1] + mydisp.at(1);
     currpos(2) = node->x()[2] + mydisp.at(2);
 
-    my_currpositions_struct[node->id()] = currpos;
+    currpositions_struct_[node->id()] = currpos;
   }
 
-  // Communicate local currpositions:
-  // map with current structural positions should be same on all procs
-  // to make use of the advantages of ghosting the structure redundantly
-  // on all procs.
-  std::vector<int> procs(numproc_);
-  for (int i = 0; i < numproc_; i++) procs[i] = i;
-  Core::LinAlg::gather<int, Core::LinAlg::Matrix<3, 1>>(
-      my_currpositions_struct, currpositions_struct_, numproc_, procs.data(), get_comm());
-
   // take special care in case of multibody simulations
   if (multibodysimulation_ == false)
   {
     // get bounding box of current configuration of structural dis
-    const Core::LinAlg::Matrix<3, 2> structBox =
-        Core::Geo::get_xaab_bof_dis(*structdis_, currpositions_struct_);
+    const bool isempty = currpositions_struct_.empty();
+    const Core::LinAlg::Matrix<3, 2> mystructBox =
+        isempty ? Core::LinAlg::Matrix<3, 2>(true)
+                : Core::Geo::get_xaab_bof_dis(*structdis_, currpositions_struct_);
+    const Core::LinAlg::Matrix<3, 2> structBox = reduce_xaabb(mystructBox, isempty, get_comm());
     double max_radius =
         sqrt(pow(structBox(0, 0) - structBox(0, 1), 2) + pow(structBox(1, 0) - structBox(1, 1), 2) +
              pow(structBox(2, 0) - structBox(2, 1), 2));
@@ -708,29 +733,20 @@ void Immersed::ImmersedPartitionedFSIDirichletNeumann::prepare_fluid_op()
   else
   {
     // get searchbox conditions on bodies
-    std::map<int, std::shared_ptr<Core::Elements::Element>>::iterator curr;
     std::vector<Core::Conditions::Condition*> conditions;
     structdis_->get_condition("ImmersedSearchbox", conditions);
 
-    // build element list
-    std::map<int, std::set<int>> elementList;
-    std::set<int> settoinsert;
+    // get bounding boxes of the bodies
+    std::vector<Core::LinAlg::Matrix<3, 2>> structboxes;
     for (int i = 0; i < (int)conditions.size(); ++i)
     {
-      for (curr = conditions[i]->geometry().begin(); curr != conditions[i]->geometry().end();
-          ++curr)
-      {
-        settoinsert.insert(curr->second->id());
-      }
-      elementList.insert(std::pair<int, std::set<int>>(i, settoinsert));
-      settoinsert.clear();
+      std::map<int, std::shared_ptr<Core::Elements::Element>>& geometry =
+          conditions[i]->geometry();
+      structboxes.push_back(
+          reduce_xaabb(Core::Geo::get_xaab_bof_eles(geometry, currpositions_struct_),
+              geometry.empty(), get_comm()));
     }
 
-    // get bounding boxes of the bodies
-    std::vector<Core::LinAlg::Matrix<3, 2>> structboxes =
-        Core::Geo::compute_xaabb_for_labeled_structures(
-            *structdis_, currpositions_struct_, elementList);
-
     double max_radius;
 
     // search for background elements within a certain radius around the center of the immersed
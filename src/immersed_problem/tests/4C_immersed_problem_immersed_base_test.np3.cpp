@@ -0,0 +1,184 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_immersed_problem_immersed_base.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_fem_discretization.hpp"
+#include "4C_fem_general_element.hpp"
+#include "4C_fem_general_node.hpp"
+#include "4C_global_data.hpp"
+#include "4C_io_gridgenerator.hpp"
+#include "4C_io_pstream.hpp"
+#include "4C_mat_material_factory.hpp"
+#include "4C_mat_par_bundle.hpp"
+#include "4C_material_parameter_base.hpp"
+#include "4C_rebalance_binning_based.hpp"
+#include "4C_unittest_utils_assertions_test.hpp"
+#include "4C_utils_singleton_owner.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <set>
+#include <string>
+
+namespace
+{
+  using namespace FourC;
+
+  void create_material_in_global_problem()
+  {
+    Core::IO::InputParameterContainer mat_stvenant;
+    mat_stvenant.add("YOUNG", 1.0);
+    mat_stvenant.add("NUE", 0.1);
+    mat_stvenant.add("DENS", 2.0);
+
+    Global::Problem::instance()->materials()->insert(
+        1, Mat::make_parameter(1, Core::Materials::MaterialType::m_stvenant, mat_stvenant));
+  }
+
+  /** The tests ghost a small structure immersed into an elongated background box, where both
+   *  discretizations are distributed over all processors independently of each other.
+   */
+  class GhostImmersedDiscretizationTest : public ::testing::Test
+  {
+   protected:
+    void SetUp() override
+    {
+      create_material_in_global_problem();
+      comm_ = MPI_COMM_WORLD;
+      Core::IO::cout.setup(false, false, false, Core::IO::standard, comm_, 0, 0, "dummyFilePrefix");
+
+      backgrddis_ = create_cuboid("fluid", {0.0, 0.0, 0.0}, {3.0, 1.0, 1.0}, {6, 2, 2});
+      immerseddis_ = create_cuboid("structure", {1.1, 0.2, 0.2}, {1.9, 0.8, 0.8}, {4, 3, 3});
+    }
+
+    void TearDown() override { Core::IO::cout.close(); }
+
+    std::shared_ptr<Core::FE::Discretization> create_cuboid(const std::string& name,
+        const std::array<double, 3>& bottom, const std::array<double, 3>& top,
+        const std::array<int, 3>& interval)
+    {
+      Core::IO::GridGenerator::RectangularCuboidInputs inputData{};
+      inputData.bottom_corner_point_ = bottom;
+      inputData.top_corner_point_ = top;
+      inputData.interval_ = interval;
+      inputData.node_gid_of_first_new_node_ = 0;
+      inputData.elementtype_ = "SOLID";
+      inputData.distype_ = "HEX8";
+      inputData.elearguments_ = "MAT 1 KINEM nonlinear";
+
+      auto dis = std::make_shared<Core::FE::Discretization>(name, comm_, 3);
+      Core::IO::GridGenerator::create_rectangular_cuboid_discretization(*dis, inputData, true);
+      dis->fill_complete(false, false, false);
+      return dis;
+    }
+
+    //! immersed elements of this processor expected after the ghosting with @p margin
+    std::set<int> expected_column_elements(const double margin)
+    {
+      std::array<double, 6> box;
+      for (int dim = 0; dim < 3; ++dim)
+      {
+        box[2 * dim] = std::numeric_limits<double>::max();
+        box[2 * dim + 1] = std::numeric_limits<double>::lowest();
+      }
+      for (int lid = 0; lid < backgrddis_->num_my_col_nodes(); ++lid)
+      {
+        const auto& x = backgrddis_->l_col_node(lid)->x();
+        for (int dim = 0; dim < 3; ++dim)
+        {
+          box[2 * dim] = std::min(box[2 * dim], x[dim] - margin);
+          box[2 * dim + 1] = std::max(box[2 * dim + 1], x[dim] + margin);
+        }
+      }
+
+      // check all elements of a redundant copy of the immersed discretization
+      std::shared_ptr<Core::FE::Discretization> redundantdis = create_cuboid(
+          "structure_redundant", {1.1, 0.2, 0.2}, {1.9, 0.8, 0.8}, {4, 3, 3});
+      Core::Rebalance::ghost_discretization_on_all_procs(*redundantdis);
+      redundantdis->fill_complete(false, false, false);
+
+      std::set<int> expected;
+      for (int lid = 0; lid < immerseddis_->num_my_row_elements(); ++lid)
+        expected.insert(immerseddis_->l_row_element(lid)->id());
+      for (int lid = 0; lid < redundantdis->num_my_col_elements(); ++lid)
+      {
+        const Core::Elements::Element* ele = redundantdis->l_col_element(lid);
+        if (element_box_intersects(*ele, box)) expected.insert(ele->id());
+      }
+      return expected;
+    }
+
+    //! does the bounding box of @p ele intersect @p box (xmin, xmax, ymin, ymax, zmin, zmax)?
+    static bool element_box_intersects(
+        const Core::Elements::Element& ele, const std::array<double, 6>& box)
+    {
+      for (int dim = 0; dim < 3; ++dim)
+      {
+        double elemin = std::numeric_limits<double>::max();
+        double elemax = std::numeric_limits<double>::lowest();
+        for (int inode = 0; inode < ele.num_node(); ++inode)
+        {
+          elemin = std::min(elemin, ele.nodes()[inode]->x()[dim]);
+          elemax = std::max(elemax, ele.nodes()[inode]->x()[dim]);
+        }
+        if (elemin > box[2 * dim + 1] or box[2 * dim] > elemax) return false;
+      }
+      return true;
+    }
+
+    std::set<int> column_elements() const
+    {
+      std::set<int> coleles;
+      for (int lid = 0; lid < immerseddis_->num_my_col_elements(); ++lid)
+        coleles.insert(immerseddis_->l_col_element(lid)->id());
+      return coleles;
+    }
+
+    MPI_Comm comm_;
+    std::shared_ptr<Core::FE::Discretization> backgrddis_;
+    std::shared_ptr<Core::FE::Discretization> immerseddis_;
+
+    Core::Utils::SingletonOwnerRegistry::ScopeGuard guard;
+  };
+
+  TEST_F(GhostImmersedDiscretizationTest, GhostElementsNearBackground)
+  {
+    const double margin = 0.1;
+    const std::set<int> expected = expected_column_elements(margin);
+
+    Immersed::ghost_immersed_discretization_near_background(*immerseddis_, *backgrddis_, margin);
+    immerseddis_->fill_complete(false, false, false);
+
+    EXPECT_EQ(column_elements(), expected);
+
+    // the nodes of all ghosted elements are available
+    for (int lid = 0; lid < immerseddis_->num_my_col_elements(); ++lid)
+    {
+      const Core::Elements::Element* ele = immerseddis_->l_col_element(lid);
+      for (int inode = 0; inode < ele->num_node(); ++inode)
+        EXPECT_TRUE(immerseddis_->have_global_node(ele->node_ids()[inode]));
+    }
+
+    // the structure is not ghosted redundantly
+    int mynumcoleles = immerseddis_->num_my_col_elements();
+    int minnumcoleles = 0;
+    Core::Communication::min_all(&mynumcoleles, &minnumcoleles, 1, comm_);
+    EXPECT_LT(minnumcoleles, immerseddis_->num_global_elements());
+  }
+
+  TEST_F(GhostImmersedDiscretizationTest, ThrowForNonPositiveMargin)
+  {
+    FOUR_C_EXPECT_THROW_WITH_MESSAGE(
+        Immersed::ghost_immersed_discretization_near_background(*immerseddis_, *backgrddis_, 0.0),
+        Core::Exception, "STRUCTURE_GHOSTING_MARGIN has to be positive");
+  }
+}  // namespace
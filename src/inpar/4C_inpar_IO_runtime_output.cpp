@@ -70,6 +70,13 @@ namespace Inpar
           "affects the number of leading zeros in the output file names.",
           &sublist_IO_VTK_structure);
 
+      // whether the nodes shared by several elements are written only once per processor
+      Core::Utils::bool_parameter("SHARED_NODES", "No",
+          "Write each node only once per processor and connect the cells with a processor local "
+          "connectivity instead of writing the nodes of each element separately. Only applies to "
+          "discretizations with Lagrange elements.",
+          &sublist_IO_VTK_structure);
+
       // specify the actual visualization writer
       setStringToIntegralParameter<Core::IO::OutputWriter>("OUTPUT_WRITER", "vtu_per_rank",
           "Specify which output writer shall be used to write the visualization data to disk",
@@ -68,6 +68,24 @@ namespace Inpar
         // whether to write node GIDs
         Core::Utils::bool_parameter(
             "NODE_GID", "No", "write 4C internal node GIDs", &sublist_IO_output_fluid);
+
+        // probe output of the fluid at arbitrary points
+        Teuchos::ParameterList& sublist_IO_probe_fluid =
+            sublist_IO.sublist("RUNTIME PROBE OUTPUT", false, "").sublist("FLUID", false, "");
+
+        Core::Utils::string_parameter("PROBE_FILE", "none",
+            "csv file with the coordinates x,y,z of the probes (one probe per line), relative to "
+            "the input file",
+            &sublist_IO_probe_fluid);
+
+        Core::Utils::int_parameter("INTERVAL_STEPS", 1,
+            "write probe output every INTERVAL_STEPS steps", &sublist_IO_probe_fluid);
+
+        Core::Utils::bool_parameter(
+            "VELOCITY", "Yes", "write velocity at the probes", &sublist_IO_probe_fluid);
+
+        Core::Utils::bool_parameter(
+            "PRESSURE", "Yes", "write pressure at the probes", &sublist_IO_probe_fluid);
       }
     }  // namespace FLUID
   }  // namespace IORuntimeOutput
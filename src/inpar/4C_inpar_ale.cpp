@@ -41,6 +41,11 @@ void Inpar::ALE::set_valid_parameters(Teuchos::ParameterList& list)
   Core::Utils::bool_parameter("UPDATEMATRIX", "no",
       "Update stiffness matrix in every time step (only for linear/material strategies)", &adyn);
 
+  Core::Utils::bool_parameter("REUSE_SOLVER_SETUP", "no",
+      "Reuse the factorization/preconditioner of the unchanged system matrix in subsequent solves "
+      "(only for linear strategies)",
+      &adyn);
+
   Core::Utils::int_parameter("MAXITER", 1, "Maximum number of newton iterations.", &adyn);
   Core::Utils::double_parameter(
       "TOLRES", 1.0e-06, "Absolute tolerance for length scaled L2 residual norm ", &adyn);
@@ -35,6 +35,11 @@ void Inpar::ArtDyn::set_valid_parameters(Teuchos::ParameterList& list)
   Core::Utils::bool_parameter(
       "SOLVESCATRA", "no", "Flag to (de)activate solving scalar transport in blood", &andyn);
 
+  Core::Utils::bool_parameter("LUMPED_MASS", "no",
+      "Flag to replace the linear solve with the consistent mass matrix by a matrix-free update "
+      "with the lumped mass matrix (only ExpTaylorGalerkin)",
+      &andyn);
+
   // number of linear solver used for arterial dynamics
   Core::Utils::int_parameter(
       "LINEAR_SOLVER", -1, "number of linear solver used for arterial dynamics", &andyn);
@@ -291,6 +296,15 @@ void Inpar::ReducedLung::set_valid_parameters(Teuchos::ParameterList& list)
   Core::Utils::int_parameter("LINEAR_SOLVER", -1,
       "number of linear solver used for reduced dim arterial dynamics", &redawdyn);
 
+  Core::Utils::bool_parameter("TREE_SOLVER", "no",
+      "Solve the linear systems by elimination along the airway tree instead of LINEAR_SOLVER",
+      &redawdyn);
+
+  Core::Utils::int_parameter("TREE_SOLVER_MAX_SIZE", 100000,
+      "Maximal number of unknowns for the tree solver, which solves sequentially on the first "
+      "processor; larger systems are solved with LINEAR_SOLVER",
+      &redawdyn);
+
   Core::Utils::bool_parameter(
       "SOLVESCATRA", "no", "Flag to (de)activate solving scalar transport in blood", &redawdyn);
 
@@ -43,9 +43,16 @@ void Inpar::Cardiovascular0D::set_valid_parameters(Teuchos::ParameterList& list)
       "number of linear solver used for cardiovascular 0D-structural problems", &cardvasc0dstruct);
 
   setStringToIntegralParameter<Cardvasc0DSolveAlgo>("SOLALGORITHM", "direct", "",
-      tuple<std::string>("block", "direct"),
+      tuple<std::string>("block", "direct", "schur"),
       tuple<Cardvasc0DSolveAlgo>(Inpar::Cardiovascular0D::cardvasc0dsolve_block,
-          Inpar::Cardiovascular0D::cardvasc0dsolve_direct),
+          Inpar::Cardiovascular0D::cardvasc0dsolve_direct,
+          Inpar::Cardiovascular0D::cardvasc0dsolve_schur),
+      &cardvasc0dstruct);
+
+  Core::Utils::double_parameter("SCHUR_REFRESH_TOL", 0.0,
+      "relative change of the structural stiffness (Frobenius norm) after which the structural "
+      "solutions for the 0D coupling columns are recomputed in the Schur complement solver; 0 "
+      "means recompute in every iteration",
       &cardvasc0dstruct);
 
   Core::Utils::double_parameter("T_PERIOD", -1.0, "periodic time", &cardvasc0dstruct);
@@ -30,6 +30,7 @@ namespace Inpar
     {
       cardvasc0dsolve_direct,  ///< build monolithic 0D cardiovascular-structural system
       cardvasc0dsolve_block,   ///< use block preconditioner for iterative solve
+      cardvasc0dsolve_schur,   ///< Schur complement of the 0D block with the structural solver
     };
 
     enum Cardvasc0DAtriumModel
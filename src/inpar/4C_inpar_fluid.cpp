@@ -291,6 +291,10 @@ void Inpar::FLUID::set_valid_parameters(Teuchos::ParameterList& list)
   Core::Utils::int_parameter(
       "VELGRAD_PROJ_SOLVER", -1, "Number of linear solver used for L2 projection", &fdyn);
 
+  Core::Utils::bool_parameter("VELGRAD_PROJ_LUMPED_MASS", false,
+      "Use a row sum lumped mass matrix for the L2 projection, no linear solver is needed then",
+      &fdyn);
+
   setStringToIntegralParameter<Inpar::FLUID::GradientReconstructionMethod>("VELGRAD_PROJ_METHOD",
       "none", "Flag to (de)activate gradient reconstruction.",
       tuple<std::string>("none", "superconvergent_patch_recovery", "L2_projection"),
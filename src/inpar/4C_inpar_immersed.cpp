@@ -73,6 +73,17 @@ void Inpar::Immersed::set_valid_parameters(Teuchos::ParameterList& list)
       "better mass conservation)",
       &immersedmethod);
 
+  Core::Utils::bool_parameter("GHOST_STRUCTURE_REDUNDANTLY", "yes",
+      "ghost the immersed structure redundantly on all procs; otherwise every proc only ghosts "
+      "the structural elements near its background fluid elements",
+      &immersedmethod);
+
+  Core::Utils::double_parameter("STRUCTURE_GHOSTING_MARGIN", 0.0,
+      "enlargement of the bounding box of the background fluid nodes of each proc when the "
+      "structure is not ghosted redundantly (has to be positive and cover structural motion and "
+      "search radius)",
+      &immersedmethod);
+
   /*----------------------------------------------------------------------*/
   /* parameters for paritioned immersed solvers */
   Teuchos::ParameterList& immersedpart = immersedmethod.sublist("PARTITIONED SOLVER", false, "");
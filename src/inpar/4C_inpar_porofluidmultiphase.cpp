@@ -133,6 +133,10 @@ void Inpar::POROFLUIDMULTIPHASE::set_valid_parameters(Teuchos::ParameterList& li
   Core::Utils::int_parameter("FLUX_PROJ_SOLVER", -1,
       "Number of linear solver used for L2 projection", &porofluidmultiphasedyn);
 
+  Core::Utils::bool_parameter("FLUX_PROJ_LUMPED_MASS", false,
+      "Use a row sum lumped mass matrix for the L2 projection, no linear solver is needed then",
+      &porofluidmultiphasedyn);
+
   setStringToIntegralParameter<FluxReconstructionMethod>("FLUX_PROJ_METHOD", "none",
       "Flag to (de)activate flux reconstruction.", tuple<std::string>("none", "L2_projection"),
       tuple<std::string>("no gradient reconstruction", "gracient reconstruction via l2-projection"),
@@ -48,16 +48,36 @@ namespace Inpar::SOLVER
           "Note! this preconditioner will only be used if the input operator\n"
           "supports the Epetra_RowMatrix interface and the client does not pass\n"
           "in an external preconditioner!",
-          Teuchos::tuple<std::string>("ILU", "MueLu", "MueLu_contactSP", "AMGnxn", "Teko"),
+          Teuchos::tuple<std::string>(
+              "ILU", "MueLu", "MueLu_contactSP", "AMGnxn", "Teko", "NodalBlock"),
           Teuchos::tuple<Core::LinearSolver::PreconditionerType>(
               Core::LinearSolver::PreconditionerType::ilu,
               Core::LinearSolver::PreconditionerType::multigrid_muelu,
               Core::LinearSolver::PreconditionerType::multigrid_muelu_contactsp,
               Core::LinearSolver::PreconditionerType::multigrid_nxn,
-              Core::LinearSolver::PreconditionerType::block_teko),
+              Core::LinearSolver::PreconditionerType::block_teko,
+              Core::LinearSolver::PreconditionerType::nodal_block),
           &list);
     }
 
+    // Nodal block relaxation options
+    {
+      Core::Utils::int_parameter("NODALBLOCK_SIZE", 3,
+          "Number of coupled dofs per node for the \"NodalBlock\" preconditioner.", &list);
+
+      std::vector<std::string> nodalblock_type_valid_input = {
+          "Jacobi", "Gauss-Seidel", "symmetric Gauss-Seidel"};
+      Core::Utils::string_parameter("NODALBLOCK_TYPE", "symmetric Gauss-Seidel",
+          "Relaxation scheme of the \"NodalBlock\" preconditioner.", &list,
+          nodalblock_type_valid_input);
+
+      Core::Utils::int_parameter("NODALBLOCK_SWEEPS", 1,
+          "Number of relaxation sweeps of the \"NodalBlock\" preconditioner.", &list);
+
+      Core::Utils::double_parameter("NODALBLOCK_DAMPING", 1.0,
+          "Damping factor of the \"NodalBlock\" preconditioner.", &list);
+    }
+
     // Ifpack options
     {
       Core::Utils::int_parameter("IFPACKOVERLAP", 0,
@@ -107,12 +127,37 @@ namespace Inpar::SOLVER
     {
       Core::Utils::string_parameter(
           "MUELU_XML_FILE", "none", "xml file defining any MueLu preconditioner", &list);
+
+      Teuchos::setStringToIntegralParameter<Core::LinearSolver::MueLuReuse>("MUELU_REUSE", "none",
+          "Parts of the MueLu multigrid hierarchy that are kept when the preconditioner is "
+          "recomputed for a matrix with unchanged graph: nothing, the aggregates and tentative "
+          "prolongators (tP) or the full prolongators and restrictions (RP)",
+          Teuchos::tuple<std::string>("none", "tP", "RP"),
+          Teuchos::tuple<Core::LinearSolver::MueLuReuse>(Core::LinearSolver::MueLuReuse::none,
+              Core::LinearSolver::MueLuReuse::tentative_prolongator,
+              Core::LinearSolver::MueLuReuse::prolongator),
+          &list);
+
+      Core::Utils::double_parameter("MUELU_REUSE_ITER_RATIO", 2.0,
+          "Rebuild a reused MueLu hierarchy from scratch as soon as the number of linear "
+          "iterations exceeds this multiple of the iterations after the last full setup",
+          &list);
     }
 
     // Teko options
     {
       Core::Utils::string_parameter(
           "TEKO_XML_FILE", "none", "xml file defining any Teko preconditioner", &list);
+
+      Core::Utils::bool_parameter("TEKO_REUSE", "No",
+          "Keep the Teko preconditioner when it is recomputed for a matrix with unchanged layout "
+          "and only rebuild its block inverses",
+          &list);
+
+      Core::Utils::double_parameter("TEKO_REUSE_ITER_RATIO", 2.0,
+          "Rebuild a reused Teko preconditioner from scratch as soon as the number of linear "
+          "iterations exceeds this multiple of the iterations after the last full setup",
+          &list);
     }
 
     // user-given name of solver block (just for beauty)
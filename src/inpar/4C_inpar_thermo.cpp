@@ -109,6 +109,16 @@ void Inpar::Thermo::set_valid_parameters(Teuchos::ParameterList& list)
 
   Core::Utils::bool_parameter(
       "LUMPCAPA", "No", "Lump the capacity matrix for explicit time integration", &tdyn);
+  Core::Utils::bool_parameter("EXPLICIT_SUBCYCLING", "No",
+      "Split explicit time steps into substeps below the estimated critical time step (requires "
+      "LUMPCAPA)",
+      &tdyn);
+  Core::Utils::double_parameter("EXPLICIT_STABILITY_FACTOR", 0.8,
+      "Safety factor on the estimated critical time step of explicit time integration", &tdyn);
+  Core::Utils::double_parameter("EXPLICIT_STABILITY_TEMP_CHANGE", 0.1,
+      "Relative change of the temperature (maximum norm) since the last estimate of the critical "
+      "time step after which it is estimated again",
+      &tdyn);
 
   // number of linear solver used for thermal problems
   Core::Utils::int_parameter(
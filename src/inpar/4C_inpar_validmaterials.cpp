@@ -685,6 +685,21 @@ std::shared_ptr<std::vector<std::shared_ptr<Mat::MaterialDefinition>>> Input::va
         {.description = "Tissue type: M (default), ENDO, EPI, AN, N or NH", .default_value = "M"}));
     m->add_component(
         entry<double>("TIME_SCALE", {.description = "Scale factor for time units of Model"}));
+    m->add_component(entry<bool>("RUSH_LARSEN",
+        {.description = "integrate gating variables with the Rush-Larsen scheme (TNNP only)",
+            .default_value = false}));
+    m->add_component(entry<double>("LOOKUP_TABLE_RESOLUTION",
+        {.description = "sample spacing of the membrane potential for tabulated rate functions, "
+                        "exact evaluation if zero (TNNP only)",
+            .default_value = 0.0}));
+    m->add_component(entry<int>("LOOKUP_TABLE_ORDER",
+        {.description = "interpolation order of the tabulated rate functions: 1 (linear) or 3 "
+                        "(cubic)",
+            .default_value = 1}));
+    m->add_component(entry<double>("LOOKUP_TABLE_TOLERANCE",
+        {.description = "check every table lookup against the exact rate functions with this "
+                        "relative tolerance if positive",
+            .default_value = 0.0}));
 
     Mat::append_material_definition(matlist, m);
   }
@@ -4332,10 +4347,12 @@ std::shared_ptr<std::vector<std::shared_ptr<Mat::MaterialDefinition>>> Input::va
         {.description = "Initialization mode for fibers (1=element fibers, 3=nodal fibers)"}));
     m->add_component(entry<std::string>("ADAPTIVE_HISTORY_STRATEGY",
         {.description = "Strategy for adaptive history integration (none, model_equation, "
-                        "higher_order)",
+                        "higher_order, recursive)",
             .default_value = "none"}));
     m->add_component(entry<double>("ADAPTIVE_HISTORY_TOLERANCE",
-        {.description = "Tolerance of the adaptive history", .default_value = 1e-6}));
+        {.description = "Tolerance of the adaptive history (recursive: distance of the reference "
+                        "stretches the deposited mass is lumped onto)",
+            .default_value = 1e-6}));
 
     Mat::append_material_definition(matlist, m);
   }
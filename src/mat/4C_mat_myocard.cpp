@@ -35,6 +35,12 @@ Mat::PAR::Myocard::Myocard(const Core::Mat::PAR::Parameter::Data& matdata)
       model(matdata.parameters.get<std::string>("MODEL")),
       tissue(matdata.parameters.get<std::string>("TISSUE")),
       time_scale(matdata.parameters.get<double>("TIME_SCALE")),
+      rush_larsen(matdata.parameters.get<bool>("RUSH_LARSEN")),
+      lookup_table({.resolution = matdata.parameters.get<double>("LOOKUP_TABLE_RESOLUTION"),
+          .order = matdata.parameters.get<int>("LOOKUP_TABLE_ORDER"),
+          .check_tolerance = matdata.parameters.get<double>("LOOKUP_TABLE_TOLERANCE")}),
+      rate_lookup_table(
+          model == "TNNP" ? MyocardTenTusscher::create_lookup_table(lookup_table) : nullptr),
       num_gp(0)
 {
 }
@@ -450,6 +456,34 @@ double Mat::Myocard::rea_coeff_deriv(const double phi, const double dt, int gp)
 }
 
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Mat::Myocard::rea_coeff_batch(const std::vector<double>& phi, const double dt,
+    std::vector<double>& reacoeff, std::vector<double>& reacoeff_deriv) const
+{
+  const double dt_model = dt * params_->time_scale;
+
+  // evaluate the perturbed state first such that the internal state finally belongs to phi
+  reacoeff_deriv.assign(phi.size(), 0.0);
+  if (params_->dt_deriv != 0.0)
+  {
+    std::vector<double> phi_perturbed(phi);
+    for (double& val : phi_perturbed) val += params_->dt_deriv;
+    myocard_mat_->rea_coeff_batch(phi_perturbed, dt_model, reacoeff_deriv);
+  }
+
+  myocard_mat_->rea_coeff_batch(phi, dt_model, reacoeff);
+
+  for (std::size_t gp = 0; gp < phi.size(); ++gp)
+  {
+    reacoeff[gp] *= params_->time_scale;
+    if (params_->dt_deriv != 0.0)
+      reacoeff_deriv[gp] =
+          (reacoeff_deriv[gp] * params_->time_scale - reacoeff[gp]) / params_->dt_deriv;
+  }
+}
+
+
 /*----------------------------------------------------------------------*
  |  returns number of internal state variables              cbert 08/13 |
  *----------------------------------------------------------------------*/
@@ -544,7 +578,9 @@ void Mat::Myocard::initialize()
   else if ((params_->model) == "INADA")
     myocard_mat_ = std::make_shared<MyocardInada>(params_->dt_deriv, (params_->tissue));
   else if ((params_->model) == "TNNP")
-    myocard_mat_ = std::make_shared<MyocardTenTusscher>(params_->dt_deriv, (params_->tissue));
+    myocard_mat_ = std::make_shared<MyocardTenTusscher>(
+        params_->dt_deriv, (params_->tissue), params_->num_gp, params_->rush_larsen,
+        params_->rate_lookup_table);
   else if ((params_->model) == "SAN")
     myocard_mat_ = std::make_shared<MyocardSanGarny>(params_->dt_deriv, (params_->tissue));
   else
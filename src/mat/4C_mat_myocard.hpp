@@ -19,6 +19,7 @@
 #include "4C_linalg_serialdensevector.hpp"
 #include "4C_mat_material_factory.hpp"
 #include "4C_mat_myocard_general.hpp"
+#include "4C_mat_myocard_lookup_table.hpp"
 #include "4C_material_base.hpp"
 #include "4C_material_parameter_base.hpp"
 
@@ -60,6 +61,15 @@ namespace Mat
       /// Time factor to correct for different Model specific time units
       const double time_scale;
 
+      /// Integrate the gating variables with the exponential Rush-Larsen scheme (TNNP only)
+      const bool rush_larsen;
+
+      /// Tabulation of the voltage dependent rate functions of the ionic model (TNNP only)
+      const MyocardLookupTable::Settings lookup_table;
+
+      /// Tabulated rate functions shared by all materials of this parameter set (TNNP only)
+      const std::shared_ptr<const MyocardLookupTable> rate_lookup_table;
+
       /// Number of Gauss Points for evaluating the material, i.e. the nonlinear reaction term
       int num_gp;
       //@}
@@ -208,6 +218,10 @@ namespace Mat
     /// compute reaction coefficient derivative for multiple points per element
     double rea_coeff_deriv(const double phi, const double dt, int gp) const;
 
+    /// compute reaction coefficients and their derivatives for all points of the element at once
+    void rea_coeff_batch(const std::vector<double>& phi, const double dt,
+        std::vector<double>& reacoeff, std::vector<double>& reacoeff_deriv) const;
+
     /// compute Heaviside step function
     double gating_function(const double Gate1, const double Gate2, const double p, const double var,
         const double thresh) const;
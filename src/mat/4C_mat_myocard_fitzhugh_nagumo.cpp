@@ -72,6 +72,33 @@ double MyocardFitzhughNagumo::rea_coeff(const double phi, const double dt, int g
   return reacoeff;
 }
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void MyocardFitzhughNagumo::rea_coeff_batch(
+    const std::vector<double>& phi, const double dt, std::vector<double>& reacoeff)
+{
+  const int num_gp = get_number_of_gp();
+  if (static_cast<int>(phi.size()) != num_gp)
+    FOUR_C_THROW("Got %d membrane potentials for %d Gauss points", static_cast<int>(phi.size()),
+        num_gp);
+
+  // gating variable
+  for (int gp = 0; gp < num_gp; ++gp)
+    r_[gp] = tools_.gating_var_calc(dt, r0_[gp], phi[gp] / d_, 1.0 / (b_ * d_));
+
+  // currents
+  reacoeff.resize(num_gp);
+  for (int gp = 0; gp < num_gp; ++gp)
+  {
+    j1_[gp] = c1_ * phi[gp] * (phi[gp] - a_) * (phi[gp] - 1.0);
+    j2_[gp] = c2_ * phi[gp] * r_[gp];
+    reacoeff[gp] = j1_[gp] + j2_[gp];
+  }
+
+  // For electromechanics
+  mechanical_activation_.assign(phi.begin(), phi.end());
+}
+
 /*----------------------------------------------------------------------*
  |  returns number of internal state variables of the material  cbert 08/13 |
  *----------------------------------------------------------------------*/
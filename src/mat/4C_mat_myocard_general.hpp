@@ -13,6 +13,7 @@
 #include "4C_utils_exceptions.hpp"
 
 #include <string>
+#include <vector>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -44,6 +45,25 @@ class MyocardGeneral
   /// compute reaction coefficient
   virtual double rea_coeff(const double phi, const double dt) = 0;
 
+  /*!
+   * \brief compute reaction coefficients of all Gauss points in one pass
+   *
+   * Models that store their internal state as structure of arrays over the Gauss points override
+   * this method with a loop over all points per update stage. The default implementation falls
+   * back to the point-wise evaluation.
+   *
+   * @param phi       (in): membrane potential at every Gauss point
+   * @param dt        (in): time step size
+   * @param reacoeff (out): reaction coefficient at every Gauss point
+   */
+  virtual void rea_coeff_batch(
+      const std::vector<double>& phi, const double dt, std::vector<double>& reacoeff)
+  {
+    reacoeff.resize(phi.size());
+    for (std::size_t gp = 0; gp < phi.size(); ++gp)
+      reacoeff[gp] = rea_coeff(phi[gp], dt, static_cast<int>(gp));
+  };
+
   /// compute reaction coefficient at timestep n
   virtual double rea_coeff_n(const double phi, const double dt) { return 0; };
 
@@ -0,0 +1,117 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_mat_myocard_lookup_table.hpp"
+
+#include "4C_utils_exceptions.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+FOUR_C_NAMESPACE_OPEN
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+MyocardLookupTable::MyocardLookupTable(RateFunctions functions, const int num_functions,
+    const double v_min, const double v_max, const Settings& settings)
+    : functions_(std::move(functions)),
+      num_functions_(num_functions),
+      v_min_(v_min),
+      v_max_(v_max),
+      dv_(settings.resolution),
+      inv_dv_(1.0 / settings.resolution),
+      order_(settings.order),
+      check_tolerance_(settings.check_tolerance),
+      num_samples_(0)
+{
+  if (dv_ <= 0.0) FOUR_C_THROW("Resolution of the lookup table must be positive, got %f", dv_);
+  if (v_max_ <= v_min_) FOUR_C_THROW("Invalid range [%f, %f] of the lookup table", v_min_, v_max_);
+  if (order_ != 1 and order_ != 3)
+    FOUR_C_THROW("Only linear (1) and cubic (3) interpolation in lookup tables, got %d", order_);
+
+  // the cubic interpolation needs one additional sample on each side of an interval
+  num_samples_ = static_cast<int>(std::ceil((v_max_ - v_min_) * inv_dv_)) + 1;
+  num_samples_ = std::max(num_samples_, order_ + 1);
+  v_max_ = v_min_ + (num_samples_ - 1) * dv_;
+
+  table_.resize(static_cast<std::size_t>(num_samples_) * num_functions_);
+  for (int i = 0; i < num_samples_; ++i)
+    functions_(v_min_ + i * dv_, &table_[static_cast<std::size_t>(i) * num_functions_]);
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void MyocardLookupTable::evaluate(const double v, double* values) const
+{
+  if (v < v_min_ or v > v_max_ or std::isnan(v))
+  {
+    functions_(v, values);
+    return;
+  }
+
+  interpolate(v, values);
+
+  if (check_tolerance_ > 0.0) check(v, values);
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void MyocardLookupTable::interpolate(const double v, double* values) const
+{
+  const double x = (v - v_min_) * inv_dv_;
+
+  if (order_ == 1)
+  {
+    const int i = std::clamp(static_cast<int>(x), 0, num_samples_ - 2);
+    const double w = x - i;
+
+    const double* row0 = &table_[static_cast<std::size_t>(i) * num_functions_];
+    const double* row1 = row0 + num_functions_;
+    for (int f = 0; f < num_functions_; ++f) values[f] = row0[f] + w * (row1[f] - row0[f]);
+  }
+  else
+  {
+    // Lagrange polynomial through the samples i-1, i, i+1, i+2
+    const int i = std::clamp(static_cast<int>(x), 1, num_samples_ - 3);
+    const double w = x - i;
+
+    const double l0 = -w * (w - 1.0) * (w - 2.0) / 6.0;
+    const double l1 = (w + 1.0) * (w - 1.0) * (w - 2.0) / 2.0;
+    const double l2 = -(w + 1.0) * w * (w - 2.0) / 2.0;
+    const double l3 = (w + 1.0) * w * (w - 1.0) / 6.0;
+
+    const double* row0 = &table_[static_cast<std::size_t>(i - 1) * num_functions_];
+    const double* row1 = row0 + num_functions_;
+    const double* row2 = row1 + num_functions_;
+    const double* row3 = row2 + num_functions_;
+    for (int f = 0; f < num_functions_; ++f)
+      values[f] = l0 * row0[f] + l1 * row1[f] + l2 * row2[f] + l3 * row3[f];
+  }
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void MyocardLookupTable::check(const double v, const double* values) const
+{
+  std::vector<double> exact(num_functions_);
+  functions_(v, exact.data());
+
+  for (int f = 0; f < num_functions_; ++f)
+  {
+    const double error = std::abs(values[f] - exact[f]);
+    if (error > check_tolerance_ * std::max(1.0, std::abs(exact[f])))
+    {
+      FOUR_C_THROW(
+          "Lookup table error %e of rate function %d at membrane potential %f exceeds the "
+          "tolerance %e. Decrease the resolution of the lookup table.",
+          error, f, v, check_tolerance_);
+    }
+  }
+}
+
+FOUR_C_NAMESPACE_CLOSE
@@ -0,0 +1,97 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_MAT_MYOCARD_LOOKUP_TABLE_HPP
+#define FOUR_C_MAT_MYOCARD_LOOKUP_TABLE_HPP
+
+#include "4C_config.hpp"
+
+#include <functional>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+/*----------------------------------------------------------------------*/
+/// Lookup table for rate functions of ionic models that only depend on the membrane potential
+///
+/// A model declares its voltage-only rate functions (steady states, time constants, ...) as one
+/// callable that evaluates all of them for a given membrane potential. The table samples this
+/// callable once on an equidistant grid and replaces every later evaluation by a polynomial
+/// interpolation between the samples. Outside of the tabulated range the exact functions are
+/// evaluated.
+///
+/// In the optional check mode every lookup is compared to the exact functions and an error is
+/// thrown if the interpolation error exceeds the given tolerance.
+class MyocardLookupTable
+{
+ public:
+  /// evaluate all rate functions for membrane potential 'v' and write them to 'values'
+  using RateFunctions = std::function<void(const double v, double* values)>;
+
+  /// user settings of the lookup table
+  struct Settings
+  {
+    /// spacing of the samples in membrane potential (a lookup table is only used if positive)
+    double resolution = 0.0;
+
+    /// interpolation order between the samples (1: linear, 3: cubic)
+    int order = 1;
+
+    /// check every lookup against the exact functions if positive
+    double check_tolerance = 0.0;
+  };
+
+  /// sample 'num_functions' rate functions on [v_min, v_max]
+  MyocardLookupTable(RateFunctions functions, const int num_functions, const double v_min,
+      const double v_max, const Settings& settings);
+
+  /// evaluate all rate functions at membrane potential 'v'
+  void evaluate(const double v, double* values) const;
+
+  /// number of tabulated functions
+  int num_functions() const { return num_functions_; }
+
+  /// number of samples per function
+  int num_samples() const { return num_samples_; }
+
+ private:
+  /// interpolate all rate functions at membrane potential 'v' inside of the tabulated range
+  void interpolate(const double v, double* values) const;
+
+  /// compare interpolated values to the exact ones
+  void check(const double v, const double* values) const;
+
+  /// exact rate functions
+  RateFunctions functions_;
+
+  /// number of tabulated functions
+  const int num_functions_;
+
+  /// lower and upper bound of the tabulated range
+  const double v_min_;
+  double v_max_;
+
+  /// sample spacing and its inverse
+  const double dv_;
+  const double inv_dv_;
+
+  /// interpolation order
+  const int order_;
+
+  /// tolerance of the check mode
+  const double check_tolerance_;
+
+  /// number of samples
+  int num_samples_;
+
+  /// sampled values, all functions of one sample are stored contiguously
+  std::vector<double> table_;
+};
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
@@ -337,6 +337,66 @@ double MyocardMinimal::rea_coeff(const double phi, const double dt, int gp)
 }
 
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void MyocardMinimal::rea_coeff_batch(
+    const std::vector<double>& phi, const double dt, std::vector<double>& reacoeff)
+{
+  const int num_gp = get_number_of_gp();
+  if (static_cast<int>(phi.size()) != num_gp)
+    FOUR_C_THROW("Got %d membrane potentials for %d Gauss points", static_cast<int>(phi.size()),
+        num_gp);
+
+  const double p = 1000.0;
+
+  // gating variables ([7] page 545 and [8])
+  for (int gp = 0; gp < num_gp; ++gp)
+  {
+    const double Tau_vm = tools_.gating_function(tau_v1m_, tau_v2m_, p, phi[gp], theta_vm_);
+    const double v_inf = tools_.gating_function(1.0, 0.0, p, phi[gp], theta_vm_);
+    const double Tau_v = tools_.gating_function(Tau_vm, tau_vp_, p, phi[gp], theta_v_);
+    const double v_inf_GF = tools_.gating_function(v_inf, 0.0, p, phi[gp], theta_v_);
+    v_[gp] = tools_.gating_var_calc(dt, v0_[gp], v_inf_GF, Tau_v);
+  }
+
+  for (int gp = 0; gp < num_gp; ++gp)
+  {
+    const double Tau_wm = tools_.gating_function(tau_w1m_, tau_w2m_, k_wm_, phi[gp], u_wm_);
+    const double w_inf =
+        tools_.gating_function(1.0 - phi[gp] / tau_winf_, w_infs_, p, phi[gp], theta_o_);
+    const double Tau_w = tools_.gating_function(Tau_wm, tau_wp_, p, phi[gp], theta_w_);
+    const double w_inf_GF = tools_.gating_function(w_inf, 0.0, p, phi[gp], theta_w_);
+    w_[gp] = tools_.gating_var_calc(dt, w0_[gp], w_inf_GF, Tau_w);
+  }
+
+  for (int gp = 0; gp < num_gp; ++gp)
+  {
+    const double Tau_s = tools_.gating_function(tau_s1_, tau_s2_, p, phi[gp], theta_w_);
+    const double s_inf = tools_.gating_function(0.0, 1.0, k_s_, phi[gp], u_s_);
+    s_[gp] = tools_.gating_var_calc(dt, s0_[gp], s_inf, Tau_s);
+  }
+
+  // currents J_fi, J_so and J_si ([7] page 545)
+  reacoeff.resize(num_gp);
+  for (int gp = 0; gp < num_gp; ++gp)
+  {
+    const double Tau_so = tools_.gating_function(tau_so1_, tau_so2_, k_so_, phi[gp], u_so_);
+    const double Tau_o = tools_.gating_function(tau_o1_, tau_o2_, p, phi[gp], theta_o_);
+
+    jfi_[gp] = -tools_.gating_function(0.0,
+        v_[gp] * (phi[gp] - theta_v_) * (u_u_ - phi[gp]) / tau_fi_, p, phi[gp], theta_v_);
+    jso_[gp] =
+        tools_.gating_function((phi[gp] - u_o_) / Tau_o, 1.0 / Tau_so, p, phi[gp], theta_w_);
+    jsi_[gp] = -tools_.gating_function(0.0, w_[gp] * s_[gp] / tau_si_, p, phi[gp], theta_w_);
+
+    reacoeff[gp] = jfi_[gp] + jso_[gp] + jsi_[gp];
+  }
+
+  // Store necessary variables for mechanical activation and electromechanical coupling
+  if (num_gp > 0) mechanical_activation_ = phi.back();
+}
+
+
 double MyocardMinimal::rea_coeff_n(const double phi, const double dt, int gp)
 {
   double reacoeff = 0.0;
@@ -12,6 +12,8 @@
 #include "4C_io_linedefinition.hpp"
 #include "4C_mat_par_bundle.hpp"
 
+#include <cmath>
+#include <utility>
 #include <vector>
 
 FOUR_C_NAMESPACE_OPEN
@@ -203,8 +205,13 @@ MyocardTenTusscher::MyocardTenTusscher() {}
 /*----------------------------------------------------------------------*
  |  Constructor                                    (public)  cbert 08/13 |
  *----------------------------------------------------------------------*/
-MyocardTenTusscher::MyocardTenTusscher(const double eps_deriv_myocard, const std::string tissue)
-    : tools_(), s0_(29, 0.0), s_(29, 0.0), r_(29, 0.0), a_(82, 0.0), c_(63, 0.0)
+MyocardTenTusscher::MyocardTenTusscher(const double eps_deriv_myocard, const std::string tissue,
+    int num_gp, bool rush_larsen, std::shared_ptr<const MyocardLookupTable> lookup_table)
+    : tools_(),
+      rush_larsen_(rush_larsen),
+      lookup_table_(std::move(lookup_table)),
+      s_init_(29, 0.0),
+      c_(63, 0.0)
 
 {
   voi_ = 0.0;
@@ -213,25 +220,25 @@ MyocardTenTusscher::MyocardTenTusscher(const double eps_deriv_myocard, const std
   if (tissue == "M")
   {
     // initial conditions
-    s0_[0] = -85.423;
-    s0_[1] = 138.52;
-    s0_[2] = 10.132;
-    s0_[3] = 0.000153;
-    s0_[4] = 0.0165;
-    s0_[5] = 0.473;
-    s0_[6] = 0.0174;
-    s0_[7] = 0.00165;
-    s0_[8] = 0.749;
-    s0_[9] = 0.6788;
-    s0_[10] = 0.00042;
-    s0_[11] = 3.288e-5;
-    s0_[12] = 0.7026;
-    s0_[13] = 0.9526;
-    s0_[14] = 0.9942;
-    s0_[15] = 0.999998;
-    s0_[16] = 2.347e-8;
-    s0_[17] = 4.272;
-    s0_[18] = 0.8978;
+    s_init_[0] = -85.423;
+    s_init_[1] = 138.52;
+    s_init_[2] = 10.132;
+    s_init_[3] = 0.000153;
+    s_init_[4] = 0.0165;
+    s_init_[5] = 0.473;
+    s_init_[6] = 0.0174;
+    s_init_[7] = 0.00165;
+    s_init_[8] = 0.749;
+    s_init_[9] = 0.6788;
+    s_init_[10] = 0.00042;
+    s_init_[11] = 3.288e-5;
+    s_init_[12] = 0.7026;
+    s_init_[13] = 0.9526;
+    s_init_[14] = 0.9942;
+    s_init_[15] = 0.999998;
+    s_init_[16] = 2.347e-8;
+    s_init_[17] = 4.272;
+    s_init_[18] = 0.8978;
 
     // Model constants
     c_[0] = 8314.472;
@@ -291,25 +298,25 @@ MyocardTenTusscher::MyocardTenTusscher(const double eps_deriv_myocard, const std
   else if (tissue == "EPI")
   {
     // initial conditions
-    s0_[0] = -85.23;
-    s0_[1] = 136.89;
-    s0_[2] = 8.604;
-    s0_[3] = 0.000126;
-    s0_[4] = 0.00621;
-    s0_[5] = 0.4712;
-    s0_[6] = 0.0095;
-    s0_[7] = 0.00172;
-    s0_[8] = 0.7444;
-    s0_[9] = 0.7045;
-    s0_[10] = 0.00036;
-    s0_[11] = 3.373e-5;
-    s0_[12] = 0.7888;
-    s0_[13] = 0.9755;
-    s0_[14] = 0.9953;
-    s0_[15] = 0.999998;
-    s0_[16] = 2.42e-8;
-    s0_[17] = 3.64;
-    s0_[18] = 0.9073;
+    s_init_[0] = -85.23;
+    s_init_[1] = 136.89;
+    s_init_[2] = 8.604;
+    s_init_[3] = 0.000126;
+    s_init_[4] = 0.00621;
+    s_init_[5] = 0.4712;
+    s_init_[6] = 0.0095;
+    s_init_[7] = 0.00172;
+    s_init_[8] = 0.7444;
+    s_init_[9] = 0.7045;
+    s_init_[10] = 0.00036;
+    s_init_[11] = 3.373e-5;
+    s_init_[12] = 0.7888;
+    s_init_[13] = 0.9755;
+    s_init_[14] = 0.9953;
+    s_init_[15] = 0.999998;
+    s_init_[16] = 2.42e-8;
+    s_init_[17] = 3.64;
+    s_init_[18] = 0.9073;
 
     // Model constants
     c_[0] = 8314.472;
@@ -369,25 +376,25 @@ MyocardTenTusscher::MyocardTenTusscher(const double eps_deriv_myocard, const std
   else if (tissue == "ENDO")
   {
     // initial conditions
-    s0_[0] = -86.709;
-    s0_[1] = 138.4;
-    s0_[2] = 10.355;
-    s0_[3] = 0.00013;
-    s0_[4] = 0.00448;
-    s0_[5] = 0.476;
-    s0_[6] = 0.0087;
-    s0_[7] = 0.00155;
-    s0_[8] = 0.7573;
-    s0_[9] = 0.7225;
-    s0_[10] = 0.00036;
-    s0_[11] = 3.164e-5;
-    s0_[12] = 0.8009;
-    s0_[13] = 0.9778;
-    s0_[14] = 0.9953;
-    s0_[15] = 0.3212;
-    s0_[16] = 2.235e-8;
-    s0_[17] = 3.715;
-    s0_[18] = 0.9068;
+    s_init_[0] = -86.709;
+    s_init_[1] = 138.4;
+    s_init_[2] = 10.355;
+    s_init_[3] = 0.00013;
+    s_init_[4] = 0.00448;
+    s_init_[5] = 0.476;
+    s_init_[6] = 0.0087;
+    s_init_[7] = 0.00155;
+    s_init_[8] = 0.7573;
+    s_init_[9] = 0.7225;
+    s_init_[10] = 0.00036;
+    s_init_[11] = 3.164e-5;
+    s_init_[12] = 0.8009;
+    s_init_[13] = 0.9778;
+    s_init_[14] = 0.9953;
+    s_init_[15] = 0.3212;
+    s_init_[16] = 2.235e-8;
+    s_init_[17] = 3.715;
+    s_init_[18] = 0.9068;
 
     // Model constants
     c_[0] = 8314.472;
@@ -445,225 +452,282 @@ MyocardTenTusscher::MyocardTenTusscher(const double eps_deriv_myocard, const std
     c_[52] = 0.00005468;
   }
 
-  s_ = s0_;
+  resize_internal_state_variables(num_gp);
 }
 
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+std::shared_ptr<const MyocardLookupTable> MyocardTenTusscher::create_lookup_table(
+    const MyocardLookupTable::Settings& settings)
+{
+  if (settings.resolution <= 0.0) return nullptr;
+
+  // tabulated range of the membrane potential in mV, the exact functions are used outside
+  constexpr double v_min = -150.0;
+  constexpr double v_max = 100.0;
+
+  return std::make_shared<const MyocardLookupTable>(
+      voltage_rate_functions, num_rate_functions_, v_min, v_max, settings);
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
 double MyocardTenTusscher::rea_coeff(const double phi, const double dt)
 {
-  s0_[0] = phi;
-  s_[0] = phi;
-
-  // Compute new gating variables
-  // ----------------------------
-
-  // s_[12] is f in component L_type_Ca_current_f_gate (dimensionless).
-  a_[7] = 1.0 / (1.0 + (exp(((s0_[0] + 20.0) / 7.0))));
-  a_[20] = 1102.50 * (exp((-(pow((s0_[0] + 27.0), 2.0)) / 225.0))) +
-           200.0 / (1.0 + (exp(((13.0 - s0_[0]) / 10.0)))) +
-           180.0 / (1.0 + (exp(((s0_[0] + 30.0) / 10.0)))) + 20.0000;
-  r_[12] = (a_[7] - s0_[12]) / a_[20];
-  s_[12] = tools_.gating_var_calc(dt, s0_[12], a_[7], a_[20]);
-
-  // s_[13] is f2 in component L_type_Ca_current_f2_gate (dimensionless).
-  a_[8] = 0.67 / (1.0 + (exp(((s0_[0] + 35.0) / 7.0)))) + 0.33;
-  a_[21] = 562.0 * (exp((-(pow((s0_[0] + 27.0), 2.0)) / 240.0))) +
-           31.0 / (1.0 + (exp(((25.0 - s0_[0]) / 10.0)))) +
-           80.0 / (1.0 + (exp(((s0_[0] + 30.0) / 10.0))));
-  r_[13] = (a_[8] - s0_[13]) / a_[21];
-  s_[13] = tools_.gating_var_calc(dt, s0_[13], a_[8], a_[21]);
-
-  // s_[14] is fCass in component L_type_Ca_current_fCass_gate (dimensionless).
-  a_[9] = 0.6 / (1.0 + (pow((s0_[10] / 0.05), 2.0))) + 0.4;
-  a_[22] = 80.0 / (1.0 + (pow((s0_[10] / 0.05), 2.0))) + 2.0;
-  r_[14] = (a_[9] - s0_[14]) / a_[22];
-  s_[14] = tools_.gating_var_calc(dt, s0_[14], a_[9], a_[22]);
-
-  // s_[15] is s in component transient_outward_current_s_gate (dimensionless).
-  a_[10] = 1.0 / (1.0 + (exp(((s0_[0] + 20.0) / 5.0))));
-  a_[23] = 85.0 * (exp((-(pow((s0_[0] + 45.0), 2.0)) / 320.0))) +
-           5.0 / (1.0 + (exp(((s0_[0] - 20.0) / 5.0)))) + 3.0;
-  r_[15] = (a_[10] - s0_[15]) / a_[23];
-  s_[15] = tools_.gating_var_calc(dt, s0_[15], a_[10], a_[23]);
-
-  // s_[16] is r in component transient_outward_current_r_gate (dimensionless).
-  a_[11] = 1.0 / (1.0 + (exp(((20.0 - s0_[0]) / 6.0))));
-  a_[24] = 9.5 * (exp((-(pow((s0_[0] + 40.0), 2.0)) / 1800.0))) + 0.8;
-  r_[16] = (a_[11] - s0_[16]) / a_[24];
-  s_[16] = tools_.gating_var_calc(dt, s0_[16], a_[11], a_[24]);
-
-  // s_[4] is Xr1 in component rapid_time_dependent_potassium_current_Xr1_gate (dimensionless).
-  a_[0] = 1.0 / (1.0 + (exp(((-26.0 - s0_[0]) / 7.0))));
-  a_[13] = 450.0 / (1.0 + (exp(((-45.0 - s0_[0]) / 10.0))));
-  a_[26] = 6.0 / (1.0 + (exp(((s0_[0] + 30.0) / 11.5))));
-  a_[34] = 1.0 * a_[13] * a_[26];
-  r_[4] = (a_[0] - s0_[4]) / a_[34];
-  s_[4] = tools_.gating_var_calc(dt, s0_[4], a_[0], a_[34]);
-
-  // s_[5] is Xr2 in component rapid_time_dependent_potassium_current_Xr2_gate (dimensionless).
-  a_[1] = 1.0 / (1.0 + (exp(((s0_[0] + 88.0) / 24.0))));
-  a_[14] = 3.0 / (1.0 + (exp(((-60.0 - s0_[0]) / 20.0))));
-  a_[27] = 1.12 / (1.0 + (exp(((s0_[0] - 60.0) / 20.0))));
-  a_[35] = 1.0 * a_[14] * a_[27];
-  r_[5] = (a_[1] - s0_[5]) / a_[35];
-  s_[5] = tools_.gating_var_calc(dt, s0_[5], a_[1], a_[35]);
-
-  // s_[6] is Xs in component slow_time_dependent_potassium_current_Xs_gate (dimensionless).
-  a_[2] = 1.0 / (1.0 + (exp(((-5.0 - s0_[0]) / 14.0))));
-  a_[15] = 1400.0 / pow((1.0 + (exp(((5.0 - s0_[0]) / 6.0)))), 1.0 / 2);
-  a_[28] = 1.0 / (1.0 + (exp(((s0_[0] - 35.0) / 15.0))));
-  a_[36] = 1.0 * a_[15] * a_[28] + 80.0;
-  r_[6] = (a_[2] - s0_[6]) / a_[36];
-  s_[6] = tools_.gating_var_calc(dt, s0_[6], a_[2], a_[36]);
-
-  // s_[7] is m in component fast_sodium_current_m_gate (dimensionless).
-  a_[3] = 1.0 / (pow((1.0 + (exp(((-56.86 - s0_[0]) / 9.03)))), 2.0));
-  a_[16] = 1.0 / (1.0 + (exp(((-60.0 - s0_[0]) / 5.0))));
-  a_[29] =
-      0.1 / (1.0 + (exp(((s0_[0] + 35.0) / 5.0)))) + 0.1 / (1.0 + (exp(((s0_[0] - 50.0) / 200.0))));
-  a_[37] = 1.0 * a_[16] * a_[29];
-  r_[7] = (a_[3] - s0_[7]) / a_[37];
-  s_[7] = tools_.gating_var_calc(dt, s0_[7], a_[3], a_[37]);
-
-  // s_[8] is h in component fast_sodium_current_h_gate (dimensionless).
-  a_[4] = 1.0 / (pow((1.0 + (exp(((s0_[0] + 71.55) / 7.43)))), 2.0));
-  a_[17] = (s0_[0] < -40.0 ? 0.057 * (exp((-(s0_[0] + 80.0) / 6.8))) : 0.0);
-  a_[30] = (s0_[0] < -40.0 ? 2.7 * (exp((0.079 * s0_[0]))) + 310000.0 * (exp((0.3485 * s0_[0])))
-                           : 0.77 / (0.13 * (1.0 + (exp(((s0_[0] + 10.66) / -11.1))))));
-  a_[38] = 1.0 / (a_[17] + a_[30]);
-  r_[8] = (a_[4] - s0_[8]) / a_[38];
-  s_[8] = tools_.gating_var_calc(dt, s0_[8], a_[4], a_[38]);
-
-  // s_[9] is j in component fast_sodium_current_j_gate (dimensionless).
-  a_[5] = 1.0 / (pow((1.0 + (exp(((s0_[0] + 71.55) / 7.43)))), 2.0));
-  a_[18] = (s0_[0] < -40.0
-                ? (((-25428.0 * (exp((0.2444 * s0_[0]))) - 6.948e-06 * (exp((-0.04391 * s0_[0])))) *
-                       (s0_[0] + 37.78)) /
-                      1.0) /
-                      (1.0 + (exp((0.311000 * (s0_[0] + 79.2300)))))
-                : 0.0);
-  a_[31] =
-      (s0_[0] < -40.0
-              ? (0.02424 * (exp((-0.01052 * s0_[0])))) / (1.0 + (exp((-0.1378 * (s0_[0] + 40.14)))))
-              : (0.6 * (exp((0.057 * s0_[0])))) / (1.0 + (exp((-0.100000 * (s0_[0] + 32.0))))));
-  a_[39] = 1.0 / (a_[18] + a_[31]);
-  r_[9] = (a_[5] - s0_[9]) / a_[39];
-  s_[9] = tools_.gating_var_calc(dt, s0_[9], a_[5], a_[39]);
-
-  // s_[11] is d in component L_type_Ca_current_d_gate (dimensionless).
-  a_[6] = 1.0 / (1.0 + (exp(((-8.0 - s0_[0]) / 7.5))));
-  a_[19] = 1.4 / (1.0 + (exp(((-35.0 - s0_[0]) / 13.0)))) + 0.25;
-  a_[32] = 1.4 / (1.0 + (exp(((s0_[0] + 5.0) / 5.0))));
-  a_[40] = 1.0 / (1.0 + (exp(((50.0 - s0_[0]) / 20.0))));
-  a_[42] = 1.0 * a_[19] * a_[32] + a_[40];
-  r_[11] = (a_[6] - s0_[11]) / a_[42];
-  s_[11] = tools_.gating_var_calc(dt, s0_[11], a_[6], a_[42]);
-
-  // Compute membrane currents
-  // -------------------------
-  a_[55] = ((((c_[21] * c_[10]) / (c_[10] + c_[22])) * s0_[2]) / (s0_[2] + c_[23])) /
-           (1.0 + 0.1245 * (exp(((-0.1 * s_[0] * c_[2]) / (c_[0] * c_[1])))) +
-               0.0353000 * (exp(((-s_[0] * c_[2]) / (c_[0] * c_[1])))));
-  a_[25] = ((c_[0] * c_[1]) / c_[2]) * (log((c_[11] / s0_[2])));
-  a_[50] = c_[16] * (pow(s_[7], 3.0))*s_[8] * s_[9] * (s_[0] - a_[25]);
-  a_[51] = c_[17] * (s_[0] - a_[25]);
-  a_[56] =
-      (c_[24] * ((exp(((c_[27] * s_[0] * c_[2]) / (c_[0] * c_[1])))) * (pow(s0_[2], 3.0))*c_[12] -
-                    (exp((((c_[27] - 1.0) * s_[0] * c_[2]) / (c_[0] * c_[1])))) *
-                        (pow(c_[11], 3.0))*s_[3] * c_[26])) /
-      (((pow(c_[29], 3.0)) + (pow(c_[11], 3.0))) * (c_[28] + c_[12]) *
-          (1.0 + c_[25] * (exp((((c_[27] - 1.0) * s_[0] * c_[2]) / (c_[0] * c_[1]))))));
-
-  // s_[2] is Na_i in component sodium_dynamics (millimolar).
-  r_[2] =
-      ((-1.0 * (a_[50] + a_[51] + 3.0 * a_[55] + 3.0 * a_[56])) / (1.0 * c_[4] * c_[2])) * c_[3];
-  s_[2] = tools_.gating_var_calc(dt, s0_[2], 0, -s0_[2] / r_[2]);
-
-  a_[33] = ((c_[0] * c_[1]) / c_[2]) * (log((c_[10] / s0_[1])));
-  a_[44] = 0.1 / (1.0 + (exp((0.06 * ((s0_[0] - a_[33]) - 200.0)))));
-  a_[45] = (3.0 * (exp((0.0002 * ((s0_[0] - a_[33]) + 100.0)))) +
-               (exp((0.1 * ((s0_[0] - a_[33]) - 10.0))))) /
-           (1.0 + (exp((-0.5 * (s0_[0] - a_[33])))));
-  a_[46] = a_[44] / (a_[44] + a_[45]);
-  a_[47] = c_[13] * a_[46] * pow((c_[10] / 5.4), 1.0 / 2) * (s_[0] - a_[33]);
-  a_[54] = c_[20] * s_[16] * s_[15] * (s_[0] - a_[33]);
-  a_[48] = c_[14] * pow((c_[10] / 5.4), 1.0 / 2) * s_[4] * s_[5] * (s_[0] - a_[33]);
-  a_[41] =
-      ((c_[0] * c_[1]) / c_[2]) * (log(((c_[10] + c_[9] * c_[11]) / (s0_[1] + c_[9] * s_[2]))));
-  a_[49] = c_[15] * (pow(s0_[6], 2.0)) * (s0_[0] - a_[41]);
-  a_[52] =
-      (((c_[18] * s_[11] * s_[12] * s_[13] * s_[14] * 4.0 * (s_[0] - 15.0) * (pow(c_[2], 2.0))) /
-           (c_[0] * c_[1])) *
-          (0.25 * s_[10] * (exp(((2.0 * (s_[0] - 15.0) * c_[2]) / (c_[0] * c_[1])))) - c_[12])) /
-      ((exp(((2.0 * (s_[0] - 15.0) * c_[2]) / (c_[0] * c_[1])))) - 1.0);
-  a_[43] = ((0.5 * c_[0] * c_[1]) / c_[2]) * (log((c_[12] / s0_[3])));
-  a_[53] = c_[19] * (s_[0] - a_[43]);
-  a_[58] = (c_[32] * (s_[0] - a_[33])) / (1.0 + (exp(((25.0 - s_[0]) / 5.98))));
-  a_[57] = (c_[30] * s_[3]) / (s_[3] + c_[31]);
-  a_[12] = 0.0;  //(VOI_ -  (floor((VOI_/c_[6])))*c_[6]>=c_[5]&&VOI_ -
-                 //(floor((VOI_/c_[6])))*c_[6]<=c_[5]+c_[7] ? - c_[8] : 0.0); // EXTERNAL STIMULUS
-
-  // Compute reaction coefficient (I_K1 + I_to + I_Kr + I_Ks + I_CaL + I_NaK + I_Na + I_b_Na +
-  // I_NaCa + I_b_Ca + I_p_K + I_stim)
-  // ---------------------------------------------------------------------------------------------------------------------------
-  r_[0] = (a_[47] + a_[54] + a_[48] + a_[49] + a_[52] + a_[55] + a_[50] + a_[51] + a_[56] + a_[53] +
-           a_[58] + a_[57] + a_[12]);
-
-  // s_[1] is K_i in component potassium_dynamics (millimolar).
-  r_[1] = ((-1.0 * ((a_[47] + a_[54] + a_[48] + a_[49] + a_[58] + a_[12]) - 2.0 * a_[55])) /
-              (1.0 * c_[4] * c_[2])) *
-          c_[3];
-  s_[1] = tools_.gating_var_calc(dt, s0_[1], 0, -s0_[1] / r_[1]);
-
-  // s_[3] is Ca_i in component calcium_dynamics (millimolar).
-  a_[59] = c_[44] / (1.0 + (pow(c_[42], 2.0)) / (pow(s0_[3], 2.0)));
-  a_[60] = c_[43] * (s0_[17] - s0_[3]);
-  a_[61] = c_[41] * (s0_[10] - s0_[3]);
-  a_[63] = 1.0 / (1.0 + (c_[45] * c_[46]) / (pow((s0_[3] + c_[46]), 2.0)));
-  r_[3] = a_[63] *
-          ((((a_[60] - a_[59]) * c_[51]) / c_[4] + a_[61]) -
-              (1.0 * ((a_[53] + a_[57]) - 2.0 * a_[56]) * c_[3]) / (2.0 * 1.0 * c_[4] * c_[2]));
-  s_[3] = tools_.gating_var_calc(dt, s0_[3], 0, -s0_[3] / r_[3]);
-
-  // s_[18] is R_prime in component calcium_dynamics (dimensionless).
-  a_[62] = c_[38] - (c_[38] - c_[39]) / (1.0 + (pow((c_[37] / s0_[17]), 2.0)));
-  a_[65] = c_[34] * a_[62];
-  r_[18] = -a_[65] * s0_[10] * s0_[18] + c_[36] * (1.0 - s0_[18]);
-  s_[18] = tools_.gating_var_calc(dt, s0_[18], 0, -s0_[18] / r_[18]);
-
-  // s0_[17] is Ca_SR in component calcium_dynamics (millimolar).
-  a_[64] = c_[33] / a_[62];
-  a_[66] = (a_[64] * (pow(s0_[10], 2.0))*s0_[18]) / (c_[35] + a_[64] * (pow(s0_[10], 2.0)));
-  a_[67] = c_[40] * a_[66] * (s0_[17] - s0_[10]);
-  a_[68] = 1.0 / (1.0 + (c_[47] * c_[48]) / (pow((s0_[17] + c_[48]), 2.0)));
-  r_[17] = a_[68] * (a_[59] - (a_[67] + a_[60]));
-  s_[17] = tools_.gating_var_calc(dt, s0_[17], 0, -s0_[17] / r_[17]);
-
-  // s_[10] is Ca_ss in component calcium_dynamics (millimolar).
-  a_[69] = 1.0 / (1.0 + (c_[49] * c_[50]) / (pow((s0_[10] + c_[50]), 2.0)));
-  r_[10] = a_[69] *
-           (((-1.0 * a_[52] * c_[3]) / (2.0 * 1.0 * c_[52] * c_[2]) + (a_[67] * c_[51]) / c_[52]) -
-               (a_[61] * c_[4]) / c_[52]);
-  s_[10] = tools_.gating_var_calc(dt, s0_[10], 0, -s0_[10] / r_[10]);
-
-  // Update rest of state variables
-  // ------------------------------
-  // s_[1] = s0_[1] + dt * r_[1];
-  // s_[2] = s0_[2] + dt * r_[2];
-  // s_[3] = s0_[3] + dt * r_[3];
-  // s_[10] = s0_[10] + dt * r_[10];
-  // s_[17] = s0_[17] + dt * r_[17];
-  // s_[18] = s0_[18] + dt * r_[18];
-
-  // for (int i=0; i<19; i++)
-  //  s_[i] = s0_[i] + dt * r_[i];
-
-
-  double reacoeff = r_[0];
-
-  return reacoeff;
+  return rea_coeff(phi, dt, 0);
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+double MyocardTenTusscher::rea_coeff(const double phi, const double dt, int gp)
+{
+  evaluate_gauss_points(&phi, dt, gp, gp + 1);
+
+  return r_[0][gp];
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void MyocardTenTusscher::rea_coeff_batch(
+    const std::vector<double>& phi, const double dt, std::vector<double>& reacoeff)
+{
+  const int num_gp = get_number_of_gp();
+  if (static_cast<int>(phi.size()) != num_gp)
+    FOUR_C_THROW("Got %d membrane potentials for %d Gauss points", static_cast<int>(phi.size()),
+        num_gp);
+
+  evaluate_gauss_points(phi.data(), dt, 0, num_gp);
+
+  reacoeff.assign(r_[0].begin(), r_[0].end());
+}
+
+
+/*----------------------------------------------------------------------*
+ | Every stage below is a loop over the given range of Gauss points     |
+ | working on the structure of arrays state, such that the transcendent |
+ | functions of one stage are evaluated for all points in a row.        |
+ *----------------------------------------------------------------------*/
+void MyocardTenTusscher::evaluate_gauss_points(
+    const double* phi, const double dt, int gp_begin, int gp_end)
+{
+  for (int q = gp_begin; q < gp_end; ++q)
+  {
+    s0_[0][q] = phi[q - gp_begin];
+    s_[0][q] = phi[q - gp_begin];
+  }
+
+  for (int q = gp_begin; q < gp_end; ++q)
+  {
+    // Compute new gating variables
+    // ----------------------------
+
+    // steady states and time constants of the voltage gated channels
+    std::array<double, num_rate_functions_> rates;
+    if (lookup_table_ != nullptr)
+      lookup_table_->evaluate(s0_[0][q], rates.data());
+    else
+      voltage_rate_functions(s0_[0][q], rates.data());
+
+    for (int g = 0; g < num_voltage_gates_; ++g)
+    {
+      const auto& [state, inf, tau] = voltage_gates_[g];
+      a_[inf][q] = rates[2 * g];
+      a_[tau][q] = rates[2 * g + 1];
+      r_[state][q] = (a_[inf][q] - s0_[state][q]) / a_[tau][q];
+      s_[state][q] = gating_update(dt, s0_[state][q], a_[inf][q], a_[tau][q]);
+    }
+
+    // s_[14] is fCass in component L_type_Ca_current_fCass_gate (dimensionless).
+    a_[9][q] = 0.6 / (1.0 + (pow((s0_[10][q] / 0.05), 2.0))) + 0.4;
+    a_[22][q] = 80.0 / (1.0 + (pow((s0_[10][q] / 0.05), 2.0))) + 2.0;
+    r_[14][q] = (a_[9][q] - s0_[14][q]) / a_[22][q];
+    s_[14][q] = gating_update(dt, s0_[14][q], a_[9][q], a_[22][q]);
+  }
+
+  for (int q = gp_begin; q < gp_end; ++q)
+  {
+    // Compute membrane currents
+    // -------------------------
+    a_[55][q] = ((((c_[21] * c_[10]) / (c_[10] + c_[22])) * s0_[2][q]) / (s0_[2][q] + c_[23])) /
+                (1.0 + 0.1245 * (exp(((-0.1 * s_[0][q] * c_[2]) / (c_[0] * c_[1])))) +
+                    0.0353000 * (exp(((-s_[0][q] * c_[2]) / (c_[0] * c_[1])))));
+    a_[25][q] = ((c_[0] * c_[1]) / c_[2]) * (log((c_[11] / s0_[2][q])));
+    a_[50][q] = c_[16] * (pow(s_[7][q], 3.0)) * s_[8][q] * s_[9][q] * (s_[0][q] - a_[25][q]);
+    a_[51][q] = c_[17] * (s_[0][q] - a_[25][q]);
+    a_[56][q] = (c_[24] * ((exp(((c_[27] * s_[0][q] * c_[2]) / (c_[0] * c_[1])))) *
+                                 (pow(s0_[2][q], 3.0)) * c_[12] -
+                             (exp((((c_[27] - 1.0) * s_[0][q] * c_[2]) / (c_[0] * c_[1])))) *
+                                 (pow(c_[11], 3.0)) * s_[3][q] * c_[26])) /
+                (((pow(c_[29], 3.0)) + (pow(c_[11], 3.0))) * (c_[28] + c_[12]) *
+                    (1.0 +
+                        c_[25] * (exp((((c_[27] - 1.0) * s_[0][q] * c_[2]) / (c_[0] * c_[1]))))));
+
+    // s_[2] is Na_i in component sodium_dynamics (millimolar).
+    r_[2][q] = ((-1.0 * (a_[50][q] + a_[51][q] + 3.0 * a_[55][q] + 3.0 * a_[56][q])) /
+                   (1.0 * c_[4] * c_[2])) *
+               c_[3];
+    s_[2][q] = tools_.gating_var_calc(dt, s0_[2][q], 0, -s0_[2][q] / r_[2][q]);
+
+    a_[33][q] = ((c_[0] * c_[1]) / c_[2]) * (log((c_[10] / s0_[1][q])));
+    a_[44][q] = 0.1 / (1.0 + (exp((0.06 * ((s0_[0][q] - a_[33][q]) - 200.0)))));
+    a_[45][q] = (3.0 * (exp((0.0002 * ((s0_[0][q] - a_[33][q]) + 100.0)))) +
+                    (exp((0.1 * ((s0_[0][q] - a_[33][q]) - 10.0))))) /
+                (1.0 + (exp((-0.5 * (s0_[0][q] - a_[33][q])))));
+    a_[46][q] = a_[44][q] / (a_[44][q] + a_[45][q]);
+    a_[47][q] = c_[13] * a_[46][q] * pow((c_[10] / 5.4), 1.0 / 2) * (s_[0][q] - a_[33][q]);
+    a_[54][q] = c_[20] * s_[16][q] * s_[15][q] * (s_[0][q] - a_[33][q]);
+    a_[48][q] =
+        c_[14] * pow((c_[10] / 5.4), 1.0 / 2) * s_[4][q] * s_[5][q] * (s_[0][q] - a_[33][q]);
+    a_[41][q] = ((c_[0] * c_[1]) / c_[2]) *
+                (log(((c_[10] + c_[9] * c_[11]) / (s0_[1][q] + c_[9] * s_[2][q]))));
+    a_[49][q] = c_[15] * (pow(s0_[6][q], 2.0)) * (s0_[0][q] - a_[41][q]);
+    a_[52][q] = (((c_[18] * s_[11][q] * s_[12][q] * s_[13][q] * s_[14][q] * 4.0 *
+                      (s_[0][q] - 15.0) * (pow(c_[2], 2.0))) /
+                     (c_[0] * c_[1])) *
+                    (0.25 * s_[10][q] *
+                            (exp(((2.0 * (s_[0][q] - 15.0) * c_[2]) / (c_[0] * c_[1])))) -
+                        c_[12])) /
+                ((exp(((2.0 * (s_[0][q] - 15.0) * c_[2]) / (c_[0] * c_[1])))) - 1.0);
+    a_[43][q] = ((0.5 * c_[0] * c_[1]) / c_[2]) * (log((c_[12] / s0_[3][q])));
+    a_[53][q] = c_[19] * (s_[0][q] - a_[43][q]);
+    a_[58][q] = (c_[32] * (s_[0][q] - a_[33][q])) / (1.0 + (exp(((25.0 - s_[0][q]) / 5.98))));
+    a_[57][q] = (c_[30] * s_[3][q]) / (s_[3][q] + c_[31]);
+    // EXTERNAL STIMULUS: (VOI_ -  (floor((VOI_/c_[6])))*c_[6]>=c_[5]&&VOI_ -
+    // (floor((VOI_/c_[6])))*c_[6]<=c_[5]+c_[7] ? - c_[8] : 0.0);
+    a_[12][q] = 0.0;
+
+    // Compute reaction coefficient (I_K1 + I_to + I_Kr + I_Ks + I_CaL + I_NaK + I_Na + I_b_Na +
+    // I_NaCa + I_b_Ca + I_p_K + I_stim)
+    // ---------------------------------------------------------------------------------------------
+    r_[0][q] = (a_[47][q] + a_[54][q] + a_[48][q] + a_[49][q] + a_[52][q] + a_[55][q] +
+                a_[50][q] + a_[51][q] + a_[56][q] + a_[53][q] + a_[58][q] + a_[57][q] + a_[12][q]);
+
+    // s_[1] is K_i in component potassium_dynamics (millimolar).
+    r_[1][q] = ((-1.0 * ((a_[47][q] + a_[54][q] + a_[48][q] + a_[49][q] + a_[58][q] + a_[12][q]) -
+                            2.0 * a_[55][q])) /
+                   (1.0 * c_[4] * c_[2])) *
+               c_[3];
+    s_[1][q] = tools_.gating_var_calc(dt, s0_[1][q], 0, -s0_[1][q] / r_[1][q]);
+
+    // s_[3] is Ca_i in component calcium_dynamics (millimolar).
+    a_[59][q] = c_[44] / (1.0 + (pow(c_[42], 2.0)) / (pow(s0_[3][q], 2.0)));
+    a_[60][q] = c_[43] * (s0_[17][q] - s0_[3][q]);
+    a_[61][q] = c_[41] * (s0_[10][q] - s0_[3][q]);
+    a_[63][q] = 1.0 / (1.0 + (c_[45] * c_[46]) / (pow((s0_[3][q] + c_[46]), 2.0)));
+    r_[3][q] = a_[63][q] * ((((a_[60][q] - a_[59][q]) * c_[51]) / c_[4] + a_[61][q]) -
+                               (1.0 * ((a_[53][q] + a_[57][q]) - 2.0 * a_[56][q]) * c_[3]) /
+                                   (2.0 * 1.0 * c_[4] * c_[2]));
+    s_[3][q] = tools_.gating_var_calc(dt, s0_[3][q], 0, -s0_[3][q] / r_[3][q]);
+
+    // s_[18] is R_prime in component calcium_dynamics (dimensionless).
+    a_[62][q] = c_[38] - (c_[38] - c_[39]) / (1.0 + (pow((c_[37] / s0_[17][q]), 2.0)));
+    a_[65][q] = c_[34] * a_[62][q];
+    r_[18][q] = -a_[65][q] * s0_[10][q] * s0_[18][q] + c_[36] * (1.0 - s0_[18][q]);
+    s_[18][q] = tools_.gating_var_calc(dt, s0_[18][q], 0, -s0_[18][q] / r_[18][q]);
+
+    // s0_[17] is Ca_SR in component calcium_dynamics (millimolar).
+    a_[64][q] = c_[33] / a_[62][q];
+    a_[66][q] = (a_[64][q] * (pow(s0_[10][q], 2.0)) * s0_[18][q]) /
+                (c_[35] + a_[64][q] * (pow(s0_[10][q], 2.0)));
+    a_[67][q] = c_[40] * a_[66][q] * (s0_[17][q] - s0_[10][q]);
+    a_[68][q] = 1.0 / (1.0 + (c_[47] * c_[48]) / (pow((s0_[17][q] + c_[48]), 2.0)));
+    r_[17][q] = a_[68][q] * (a_[59][q] - (a_[67][q] + a_[60][q]));
+    s_[17][q] = tools_.gating_var_calc(dt, s0_[17][q], 0, -s0_[17][q] / r_[17][q]);
+
+    // s_[10] is Ca_ss in component calcium_dynamics (millimolar).
+    a_[69][q] = 1.0 / (1.0 + (c_[49] * c_[50]) / (pow((s0_[10][q] + c_[50]), 2.0)));
+    r_[10][q] = a_[69][q] * (((-1.0 * a_[52][q] * c_[3]) / (2.0 * 1.0 * c_[52] * c_[2]) +
+                                 (a_[67][q] * c_[51]) / c_[52]) -
+                                (a_[61][q] * c_[4]) / c_[52]);
+    s_[10][q] = tools_.gating_var_calc(dt, s0_[10][q], 0, -s0_[10][q] / r_[10][q]);
+  }
+}
+
+/*----------------------------------------------------------------------*
+ | steady states and time constants of the voltage gated channels in    |
+ | the order of voltage_gates_, which only depend on the membrane       |
+ | potential and are hence suited for tabulation                        |
+ *----------------------------------------------------------------------*/
+void MyocardTenTusscher::voltage_rate_functions(const double V, double* rates)
+{
+  // f in component L_type_Ca_current_f_gate (dimensionless).
+  rates[0] = 1.0 / (1.0 + (exp(((V + 20.0) / 7.0))));
+  rates[1] = 1102.50 * (exp((-(pow((V + 27.0), 2.0)) / 225.0))) +
+             200.0 / (1.0 + (exp(((13.0 - V) / 10.0)))) +
+             180.0 / (1.0 + (exp(((V + 30.0) / 10.0)))) + 20.0000;
+
+  // f2 in component L_type_Ca_current_f2_gate (dimensionless).
+  rates[2] = 0.67 / (1.0 + (exp(((V + 35.0) / 7.0)))) + 0.33;
+  rates[3] = 562.0 * (exp((-(pow((V + 27.0), 2.0)) / 240.0))) +
+             31.0 / (1.0 + (exp(((25.0 - V) / 10.0)))) + 80.0 / (1.0 + (exp(((V + 30.0) / 10.0))));
+
+  // s in component transient_outward_current_s_gate (dimensionless).
+  rates[4] = 1.0 / (1.0 + (exp(((V + 20.0) / 5.0))));
+  rates[5] = 85.0 * (exp((-(pow((V + 45.0), 2.0)) / 320.0))) +
+             5.0 / (1.0 + (exp(((V - 20.0) / 5.0)))) + 3.0;
+
+  // r in component transient_outward_current_r_gate (dimensionless).
+  rates[6] = 1.0 / (1.0 + (exp(((20.0 - V) / 6.0))));
+  rates[7] = 9.5 * (exp((-(pow((V + 40.0), 2.0)) / 1800.0))) + 0.8;
+
+  // Xr1 in component rapid_time_dependent_potassium_current_Xr1_gate (dimensionless).
+  const double alpha_xr1 = 450.0 / (1.0 + (exp(((-45.0 - V) / 10.0))));
+  const double beta_xr1 = 6.0 / (1.0 + (exp(((V + 30.0) / 11.5))));
+  rates[8] = 1.0 / (1.0 + (exp(((-26.0 - V) / 7.0))));
+  rates[9] = 1.0 * alpha_xr1 * beta_xr1;
+
+  // Xr2 in component rapid_time_dependent_potassium_current_Xr2_gate (dimensionless).
+  const double alpha_xr2 = 3.0 / (1.0 + (exp(((-60.0 - V) / 20.0))));
+  const double beta_xr2 = 1.12 / (1.0 + (exp(((V - 60.0) / 20.0))));
+  rates[10] = 1.0 / (1.0 + (exp(((V + 88.0) / 24.0))));
+  rates[11] = 1.0 * alpha_xr2 * beta_xr2;
+
+  // Xs in component slow_time_dependent_potassium_current_Xs_gate (dimensionless).
+  const double alpha_xs = 1400.0 / pow((1.0 + (exp(((5.0 - V) / 6.0)))), 1.0 / 2);
+  const double beta_xs = 1.0 / (1.0 + (exp(((V - 35.0) / 15.0))));
+  rates[12] = 1.0 / (1.0 + (exp(((-5.0 - V) / 14.0))));
+  rates[13] = 1.0 * alpha_xs * beta_xs + 80.0;
+
+  // m in component fast_sodium_current_m_gate (dimensionless).
+  const double alpha_m = 1.0 / (1.0 + (exp(((-60.0 - V) / 5.0))));
+  const double beta_m =
+      0.1 / (1.0 + (exp(((V + 35.0) / 5.0)))) + 0.1 / (1.0 + (exp(((V - 50.0) / 200.0))));
+  rates[14] = 1.0 / (pow((1.0 + (exp(((-56.86 - V) / 9.03)))), 2.0));
+  rates[15] = 1.0 * alpha_m * beta_m;
+
+  // h in component fast_sodium_current_h_gate (dimensionless).
+  const double alpha_h = (V < -40.0 ? 0.057 * (exp((-(V + 80.0) / 6.8))) : 0.0);
+  const double beta_h = (V < -40.0 ? 2.7 * (exp((0.079 * V))) + 310000.0 * (exp((0.3485 * V)))
+                                   : 0.77 / (0.13 * (1.0 + (exp(((V + 10.66) / -11.1))))));
+  rates[16] = 1.0 / (pow((1.0 + (exp(((V + 71.55) / 7.43)))), 2.0));
+  rates[17] = 1.0 / (alpha_h + beta_h);
+
+  // j in component fast_sodium_current_j_gate (dimensionless).
+  const double alpha_j =
+      (V < -40.0 ? (((-25428.0 * (exp((0.2444 * V))) - 6.948e-06 * (exp((-0.04391 * V)))) *
+                        (V + 37.78)) /
+                       1.0) /
+                       (1.0 + (exp((0.311000 * (V + 79.2300)))))
+                 : 0.0);
+  const double beta_j =
+      (V < -40.0 ? (0.02424 * (exp((-0.01052 * V)))) / (1.0 + (exp((-0.1378 * (V + 40.14)))))
+                 : (0.6 * (exp((0.057 * V)))) / (1.0 + (exp((-0.100000 * (V + 32.0))))));
+  rates[18] = 1.0 / (pow((1.0 + (exp(((V + 71.55) / 7.43)))), 2.0));
+  rates[19] = 1.0 / (alpha_j + beta_j);
+
+  // d in component L_type_Ca_current_d_gate (dimensionless).
+  const double alpha_d = 1.4 / (1.0 + (exp(((-35.0 - V) / 13.0)))) + 0.25;
+  const double beta_d = 1.4 / (1.0 + (exp(((V + 5.0) / 5.0))));
+  const double gamma_d = 1.0 / (1.0 + (exp(((50.0 - V) / 20.0))));
+  rates[20] = 1.0 / (1.0 + (exp(((-8.0 - V) / 7.5))));
+  rates[21] = 1.0 * alpha_d * beta_d + gamma_d;
 }
 
+
 /*----------------------------------------------------------------------*
  |  returns number of internal state variables of the material  cbert 08/13 |
  *----------------------------------------------------------------------*/
@@ -673,15 +737,22 @@ int MyocardTenTusscher::get_number_of_internal_state_variables() const { return
  |  returns current internal state of the material          cbert 08/13 |
  *----------------------------------------------------------------------*/
 double MyocardTenTusscher::get_internal_state(const int k) const
+{
+  return get_internal_state(k, 0);
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+double MyocardTenTusscher::get_internal_state(const int k, int gp) const
 {
   double val = 0.0;
   if (k == -1)
   {
-    val = s0_[3];  // Free cytoplasmatic calcium concentration
+    val = s0_[3][gp];  // Free cytoplasmatic calcium concentration
   }
   else
   {
-    val = s0_[k];
+    val = s0_[k][gp];
   }
   return val;
 }
@@ -690,16 +761,23 @@ double MyocardTenTusscher::get_internal_state(const int k) const
  |  set  internal state of the material                     cbert 08/13 |
  *----------------------------------------------------------------------*/
 void MyocardTenTusscher::set_internal_state(const int k, const double val)
+{
+  set_internal_state(k, val, 0);
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void MyocardTenTusscher::set_internal_state(const int k, const double val, int gp)
 {
   if (k == -1)
   {
-    s0_[3] = val;  // Free cytoplasmatic calcium concentration
-    s_[3] = val;
+    s0_[3][gp] = val;  // Free cytoplasmatic calcium concentration
+    s_[3][gp] = val;
   }
   else
   {
-    s0_[k] = val;
-    s_[k] = val;
+    s0_[k][gp] = val;
+    s_[k][gp] = val;
   }
   return;
 }
@@ -714,11 +792,13 @@ int MyocardTenTusscher::get_number_of_ionic_currents() const { return 15; }
  *----------------------------------------------------------------------*/
 double MyocardTenTusscher::get_ionic_currents(const int k) const
 {
-  double val = 0.0;
-  val = a_[47 + k];
-  return val;
+  return get_ionic_currents(k, 0);
 }
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+double MyocardTenTusscher::get_ionic_currents(const int k, int gp) const { return a_[47 + k][gp]; }
+
 /*----------------------------------------------------------------------*
  |  update of material at the end of a time step             ljag 07/12 |
  *----------------------------------------------------------------------*/
@@ -731,4 +811,30 @@ void MyocardTenTusscher::update(const double phi, const double dt)
   return;
 }
 
+/*----------------------------------------------------------------------*
+ |  resize internal state variables                                     |
+ *----------------------------------------------------------------------*/
+void MyocardTenTusscher::resize_internal_state_variables(int gp)
+{
+  // new Gauss points start from the initial conditions of the tissue type
+  s0_.resize(29);
+  s_.resize(29);
+  r_.resize(29);
+  a_.resize(82);
+  for (std::size_t k = 0; k < s0_.size(); ++k)
+  {
+    s0_[k].resize(gp, s_init_[k]);
+    s_[k].resize(gp, s_init_[k]);
+    r_[k].resize(gp, 0.0);
+  }
+  for (auto& a : a_) a.resize(gp, 0.0);
+
+  return;
+}
+
+/*----------------------------------------------------------------------*
+ |  get number of Gauss points                                          |
+ *----------------------------------------------------------------------*/
+int MyocardTenTusscher::get_number_of_gp() const { return s0_[0].size(); }
+
 FOUR_C_NAMESPACE_CLOSE
@@ -18,10 +18,14 @@
 #include "4C_linalg_serialdensevector.hpp"
 #include "4C_mat_material_factory.hpp"
 #include "4C_mat_myocard_general.hpp"
+#include "4C_mat_myocard_lookup_table.hpp"
 #include "4C_mat_myocard_tools.hpp"
 #include "4C_material_base.hpp"
 #include "4C_material_parameter_base.hpp"
 
+#include <array>
+#include <memory>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*----------------------------------------------------------------------*/
@@ -49,40 +53,114 @@ class MyocardTenTusscher : public MyocardGeneral
   MyocardTenTusscher();
 
   /// construct empty material object
-  explicit MyocardTenTusscher(const double eps_deriv_myocard, const std::string tissue);
+  explicit MyocardTenTusscher(const double eps_deriv_myocard, const std::string tissue,
+      int num_gp = 1, bool rush_larsen = false,
+      std::shared_ptr<const MyocardLookupTable> lookup_table = nullptr);
+
+  /// tabulate the voltage-only rate functions, returns nullptr if no table is requested
+  static std::shared_ptr<const MyocardLookupTable> create_lookup_table(
+      const MyocardLookupTable::Settings& settings);
 
   /// compute reaction coefficient
   double rea_coeff(const double phi, const double dt) override;
 
+  /// compute reaction coefficient for multiple points per element
+  double rea_coeff(const double phi, const double dt, int gp) override;
+
+  /// compute reaction coefficients of all Gauss points in one pass
+  void rea_coeff_batch(
+      const std::vector<double>& phi, const double dt, std::vector<double>& reacoeff) override;
+
   ///  returns number of internal state variables of the material
   int get_number_of_internal_state_variables() const override;
 
   ///  return current internal state of the material
   double get_internal_state(const int k) const override;
 
+  ///  returns current internal state of the material for multiple points per element
+  double get_internal_state(const int k, int gp) const override;
+
   ///  set internal state of the material
   void set_internal_state(const int k, const double val) override;
 
+  ///  set internal state of the material for multiple points per element
+  void set_internal_state(const int k, const double val, int gp) override;
+
   ///  return number of ionic currents
   int get_number_of_ionic_currents() const override;
 
   ///  return ionic currents
   double get_ionic_currents(const int k) const override;
 
+  ///  return ionic currents for multiple points per element
+  double get_ionic_currents(const int k, int gp) const override;
+
   /// time update for this material
   void update(const double phi, const double dt) override;
 
+  /// resize internal state variables if number of Gauss point changes
+  void resize_internal_state_variables(int gp) override;
+
+  /// get number of Gauss points
+  int get_number_of_gp() const override;
+
  private:
+  /// number of gating variables whose rates only depend on the membrane potential
+  static constexpr int num_voltage_gates_ = 11;
+
+  /// number of voltage-only rate functions (steady state and time constant per gate)
+  static constexpr int num_rate_functions_ = 2 * num_voltage_gates_;
+
+  /// state, steady state and time constant indices of the voltage gated channels
+  static constexpr std::array<std::array<int, 3>, num_voltage_gates_> voltage_gates_ = {{
+      {12, 7, 20},  // f
+      {13, 8, 21},  // f2
+      {15, 10, 23},  // s
+      {16, 11, 24},  // r
+      {4, 0, 34},  // Xr1
+      {5, 1, 35},  // Xr2
+      {6, 2, 36},  // Xs
+      {7, 3, 37},  // m
+      {8, 4, 38},  // h
+      {9, 5, 39},  // j
+      {11, 6, 42},  // d
+  }};
+
+  /// evaluate all voltage-only rate functions at membrane potential V
+  static void voltage_rate_functions(const double V, double* rates);
+
+  /// evaluate the model for the Gauss points [gp_begin, gp_end) stage by stage
+  void evaluate_gauss_points(const double* phi, const double dt, int gp_begin, int gp_end);
+
+  /// update of a Hodgkin-Huxley type gating variable
+  double gating_update(const double dt, double y_0, const double y_inf, const double y_tau) const
+  {
+    return rush_larsen_ ? tools_.gating_var_calc_rush_larsen(dt, y_0, y_inf, y_tau)
+                        : tools_.gating_var_calc(dt, y_0, y_inf, y_tau);
+  }
+
   MyocardTools tools_;
 
   /// perturbation for numerical approximation of the derivative
   double eps_deriv_;
 
-  /// gating variables Inada
-  std::vector<double> s0_;
-  std::vector<double> s_;
-  std::vector<double> r_;
-  std::vector<double> a_;
+  /// use the Rush-Larsen integrator for the gating variables
+  bool rush_larsen_;
+
+  /// tabulated voltage-only rate functions (owned by the material parameters and shared by all
+  /// instances of one material)
+  std::shared_ptr<const MyocardLookupTable> lookup_table_;
+
+  /// initial values of the state variables
+  std::vector<double> s_init_;
+
+  /// state, rate and algebraic variables stored as structure of arrays, i.e. s0_[k][gp]
+  std::vector<std::vector<double>> s0_;
+  std::vector<std::vector<double>> s_;
+  std::vector<std::vector<double>> r_;
+  std::vector<std::vector<double>> a_;
+
+  /// model constants
   std::vector<double> c_;
 
   double voi_;  // current time (for debugging with CellML)
@@ -40,4 +40,14 @@ double MyocardTools::gating_var_calc(
   return y_1;
 }
 
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+double MyocardTools::gating_var_calc_rush_larsen(
+    const double dt, double y_0, const double y_inf, const double y_tau) const
+{
+  // Solve dy/dt = (1/a)*(y_inf-y) exactly for constant y_inf and y_tau
+  return y_inf + (y_0 - y_inf) * exp(-dt / y_tau);
+}
+
 FOUR_C_NAMESPACE_CLOSE
@@ -35,6 +35,11 @@ class MyocardTools
   /// compute gating variable 'y' from dy/dt = (y_inf-y)/y_tau
   double gating_var_calc(const double dt, double y_0, const double y_inf, const double y_tau) const;
 
+  /// compute gating variable 'y' from dy/dt = (y_inf-y)/y_tau with the exponential Rush-Larsen
+  /// integrator, i.e. exact integration for frozen membrane potential
+  double gating_var_calc_rush_larsen(
+      const double dt, double y_0, const double y_inf, const double y_tau) const;
+
 };  // Myocard_Tools
 
 FOUR_C_NAMESPACE_CLOSE
@@ -66,6 +66,10 @@ namespace
     {
       return Mixture::HistoryAdaptionStrategy::higher_order_integration;
     }
+    else if (input == "recursive")
+    {
+      return Mixture::HistoryAdaptionStrategy::recursive;
+    }
     else
     {
       FOUR_C_THROW("Unknown history adaption strategy %s!", input.c_str());
@@ -20,9 +20,11 @@
 #include <Sacado.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <tuple>
 #include <type_traits>
 
 FOUR_C_NAMESPACE_OPEN
@@ -128,6 +130,120 @@ namespace
     return std::make_tuple(integration + history_integration, derivative);
   }
 
+  /*!
+   * @brief Returns the integration weights of one timestep of size dt for the exponential survival
+   * function of the recursive history
+   *
+   * The integrand is interpolated linearly within the timestep and integrated exactly against the
+   * survival function. The weight of the increment at the beginning of the timestep is returned
+   * without the decay over the timestep.
+   */
+  std::tuple<double, double> evaluate_recursive_integration_weights(
+      const double decay_time, const double dt)
+  {
+    const double a = dt / decay_time;
+
+    // series expansion to avoid cancellation for small timesteps
+    if (a < 1e-4)
+    {
+      return std::make_tuple(
+          dt * (0.5 + a / 6.0 + a * a / 24.0), dt * (0.5 - a / 6.0 + a * a / 24.0));
+    }
+
+    return std::make_tuple(
+        decay_time * (std::expm1(a) / a - 1.0), decay_time * (1.0 + std::expm1(-a) / a));
+  }
+
+  template <typename Number, typename Integrand>
+  Number integrate_over_history(const Mixture::FullConstrainedMixtureFiber<Number>& fiber,
+      const double time, Integrand integrand)
+  {
+    if (fiber.adaptive_history_strategy_ != Mixture::HistoryAdaptionStrategy::recursive)
+      return integrate_over_deposition_history<Number>(fiber.history_, integrand);
+
+    Number integration_result = 0;
+    for (const auto& increment : fiber.lumped_history_) integration_result += integrand(increment);
+
+    // contribution of the last increment in the history to the current timestep
+    if (fiber.history_.size() > 0)
+    {
+      const Mixture::MassIncrement<Number>& last_increment = fiber.history_.back().timesteps.back();
+      const double weight_begin =
+          std::get<0>(evaluate_recursive_integration_weights(fiber.growth_evolution_.decay_time_,
+              time - last_increment.deposition_time));
+      integration_result += weight_begin * integrand(last_increment);
+    }
+
+    return integration_result;
+  }
+
+  template <typename Number, typename Integrand>
+  std::tuple<Number, Number> integrate_last_timestep(
+      const Mixture::FullConstrainedMixtureFiber<Number>& fiber,
+      const Mixture::MassIncrement<Number>& current_increment, Integrand integrand,
+      Number history_integration)
+  {
+    if (fiber.adaptive_history_strategy_ != Mixture::HistoryAdaptionStrategy::recursive)
+    {
+      return integrate_last_timestep_with_derivative<Number>(
+          fiber.history_.back(), current_increment, integrand, history_integration);
+    }
+
+    const double weight_end = std::get<1>(
+        evaluate_recursive_integration_weights(fiber.growth_evolution_.decay_time_,
+            current_increment.deposition_time -
+                fiber.history_.back().timesteps.back().deposition_time));
+
+    return std::make_tuple(
+        history_integration + weight_end * integrand(current_increment), Number(weight_end));
+  }
+
+  /*!
+   * @brief Lumps the deposited mass onto the nearest reference stretch of the recursive history
+   *
+   * The lumped increments store the integrated mass as production rate with a unit growth scalar
+   * such that the usual integrands can be evaluated on them. Only mass of the same sign is lumped
+   * together, conserving the mass and its first moment w.r.t. the reference stretch.
+   */
+  template <typename Number>
+  void lump_mass_increment(std::vector<Mixture::MassIncrement<Number>>& lumped_history,
+      const Number reference_stretch, const Number mass, const double time, const Number tolerance)
+  {
+    if (mass == 0.0) return;
+
+    auto nearest = lumped_history.end();
+    Number min_distance = tolerance;
+    for (auto increment = lumped_history.begin(); increment != lumped_history.end(); ++increment)
+    {
+      if ((increment->growth_scalar_production_rate > 0.0) != (mass > 0.0)) continue;
+
+      const Number distance = std::abs(increment->reference_stretch - reference_stretch);
+      if (distance <= min_distance)
+      {
+        min_distance = distance;
+        nearest = increment;
+      }
+    }
+
+    if (nearest == lumped_history.end())
+    {
+      lumped_history.emplace_back(Mixture::MassIncrement<Number>{
+          .reference_stretch = reference_stretch,
+          .growth_scalar = 1.0,
+          .growth_scalar_production_rate = mass,
+          .deposition_time = time,
+      });
+      return;
+    }
+
+    const Number total_mass = nearest->growth_scalar_production_rate + mass;
+    nearest->reference_stretch = (nearest->growth_scalar_production_rate *
+                                         nearest->reference_stretch +
+                                     mass * reference_stretch) /
+                                 total_mass;
+    nearest->growth_scalar_production_rate = total_mass;
+  }
+
   template <typename Number>
   static inline Number evaluate_i4(Number lambda_e)
   {
@@ -251,6 +367,15 @@ void Mixture::FullConstrainedMixtureFiber<double>::pack(Core::Communication::Pac
     interval.adaptivity_info.pack(data);
   }
 
+  data.add_to_pack(lumped_history_.size());
+  for (const auto& item : lumped_history_)
+  {
+    data.add_to_pack(item.reference_stretch);
+    data.add_to_pack(item.growth_scalar);
+    data.add_to_pack(item.growth_scalar_production_rate);
+    data.add_to_pack(item.deposition_time);
+  }
+
   data.add_to_pack(current_time_);
 
   data.add_to_pack(computed_growth_scalar_);
@@ -297,6 +422,16 @@ void Mixture::FullConstrainedMixtureFiber<double>::unpack(Core::Communication::U
     interval.adaptivity_info.unpack(buffer);
   }
 
+  std::size_t size_of_lumped_history;
+  extract_from_pack(buffer, size_of_lumped_history);
+  lumped_history_.resize(size_of_lumped_history);
+  for (auto& item : lumped_history_)
+  {
+    extract_from_pack(buffer, item.reference_stretch);
+    extract_from_pack(buffer, item.growth_scalar);
+    extract_from_pack(buffer, item.growth_scalar_production_rate);
+    extract_from_pack(buffer, item.deposition_time);
+  }
 
   extract_from_pack(buffer, current_time_);
 
@@ -322,7 +457,10 @@ void Mixture::FullConstrainedMixtureFiber<Number>::recompute_state(
     current_time_shift_ = 0.0;
   }
 
-  if (enable_growth_ && history_.size() > 0) update_base_delta_time(history_.back(), dt);
+  // the recursive history integration does not rely on a constant timestep
+  if (enable_growth_ && history_.size() > 0 &&
+      adaptive_history_strategy_ != HistoryAdaptionStrategy::recursive)
+    update_base_delta_time(history_.back(), dt);
   compute_internal_variables();
 }
 
@@ -351,7 +489,7 @@ Number Mixture::FullConstrainedMixtureFiber<Number>::compute_history_cauchy_stre
   const Number scaled_cauchy_stress_history =
       growth_evolution_.evaluate_survival_function(time) *
           evaluate_fiber_material_cauchy_stress<Number>(*fiber_material_, lambda_pre_ * lambda_f) +
-      integrate_over_deposition_history<Number>(history_, current_scaled_cauchy_stress_integrand);
+      integrate_over_history<Number>(*this, time, current_scaled_cauchy_stress_integrand);
 
   return scaled_cauchy_stress_history / growth_scalar;
 }
@@ -489,13 +627,13 @@ Mixture::FullConstrainedMixtureFiber<Number>::get_local_newton_evaluator() const
   // stress)
   const Number growth_scalar_history =
       growth_evolution_.evaluate_survival_function(current_time_ - reference_time_) +
-      integrate_over_deposition_history<Number>(history_, current_growth_scalar_integrand);
+      integrate_over_history<Number>(*this, current_time_, current_growth_scalar_integrand);
 
   const Number scaled_cauchy_stress_history =
       growth_evolution_.evaluate_survival_function(current_time_ - reference_time_) *
           evaluate_fiber_material_cauchy_stress<Number>(
               *fiber_material_, lambda_pre_ * current_state_.lambda_f) +
-      integrate_over_deposition_history<Number>(history_, current_scaled_cauchy_stress_integrand);
+      integrate_over_history<Number>(*this, current_time_, current_scaled_cauchy_stress_integrand);
 
   return [=, this](const Core::LinAlg::Matrix<2, 1, Number>& growth_scalar_and_cauchy_stress)
   {
@@ -510,8 +648,8 @@ Mixture::FullConstrainedMixtureFiber<Number>::get_local_newton_evaluator() const
             (cauchy_stress - sig_h_) / sig_h_) /
         sig_h_;
     const auto [my_growth_scalar, dmy_growth_scalar_dintegrand] =
-        integrate_last_timestep_with_derivative<Number>(history_.back(), current_increment,
-            current_growth_scalar_integrand, growth_scalar_history);
+        integrate_last_timestep<Number>(
+            *this, current_increment, current_growth_scalar_integrand, growth_scalar_history);
 
     const Number dmy_growth_scalar_dsig =
         dmy_growth_scalar_dintegrand *
@@ -522,7 +660,7 @@ Mixture::FullConstrainedMixtureFiber<Number>::get_local_newton_evaluator() const
         current_dgrowth_scalar_integrand_dgrowth_scalar(current_increment);
 
     const auto [my_scaled_cauchy_stress, dmy_scaled_cauchy_stress_dintegrand] =
-        integrate_last_timestep_with_derivative<Number>(history_.back(), current_increment,
+        integrate_last_timestep<Number>(*this, current_increment,
             current_scaled_cauchy_stress_integrand, scaled_cauchy_stress_history);
 
 
@@ -580,15 +718,15 @@ Number Mixture::FullConstrainedMixtureFiber<
           evaluate_d_fiber_material_cauchy_stress_d_lambda_e_sq<Number>(
               *fiber_material_, lambda_pre_ * current_state_.lambda_f) *
           std::pow(lambda_pre_, 2) +
-      integrate_over_deposition_history<Number>(
-          history_, dscaled_cauchy_stress_integrand_d_lambda_f_sq);
+      integrate_over_history<Number>(
+          *this, current_time_, dscaled_cauchy_stress_integrand_d_lambda_f_sq);
 
   const MassIncrement<Number> current_increment =
       evaluate_current_mass_increment(computed_growth_scalar_, computed_sigma_);
 
   const auto [dscaled_cauchy_stress_lambda_f_sq,
       ddscaled_cauchy_stress_integrand_d_lambda_f_sq_d_integrand] =
-      integrate_last_timestep_with_derivative(history_.back(), current_increment,
+      integrate_last_timestep<Number>(*this, current_increment,
           dscaled_cauchy_stress_integrand_d_lambda_f_sq,
           Dscaled_cauchy_stress_D_lambda_f_sq_history);
 
@@ -645,14 +783,16 @@ void Mixture::FullConstrainedMixtureFiber<Number>::compute_internal_variables()
     computed_growth_scalar_ =
         growth_evolution_.evaluate_survival_function(
             current_time_ + current_time_shift_ - reference_time_) +
-        integrate_over_deposition_history<Number>(history_, current_growth_scalar_integrand);
+        integrate_over_history<Number>(
+            *this, current_time_ + current_time_shift_, current_growth_scalar_integrand);
 
     computed_sigma_ = (growth_evolution_.evaluate_survival_function(
                            current_time_ + current_time_shift_ - reference_time_) *
                               evaluate_fiber_material_cauchy_stress<Number>(
                                   *fiber_material_, lambda_pre_ * current_state_.lambda_f) +
-                          integrate_over_deposition_history<Number>(
-                              history_, current_scaled_cauchy_stress_integrand)) /
+                          integrate_over_history<Number>(*this,
+                              current_time_ + current_time_shift_,
+                              current_scaled_cauchy_stress_integrand)) /
                       computed_growth_scalar_;
 
 
@@ -662,8 +802,8 @@ void Mixture::FullConstrainedMixtureFiber<Number>::compute_internal_variables()
                 evaluate_d_fiber_material_cauchy_stress_d_lambda_e_sq<Number>(
                     *fiber_material_, lambda_pre_ * current_state_.lambda_f) *
                 std::pow(lambda_pre_, 2) +
-            integrate_over_deposition_history<Number>(
-                history_, current_dscaled_cauchy_stress_integrand_d_lambda_f_sq)) /
+            integrate_over_history<Number>(
+                *this, current_time_, current_dscaled_cauchy_stress_integrand_d_lambda_f_sq)) /
         computed_growth_scalar_;
 
     return;
@@ -776,6 +916,7 @@ void Mixture::FullConstrainedMixtureFiber<Number>::add_time(const double delta_t
       increment.deposition_time += delta_time;
     }
   }
+  for (auto& increment : lumped_history_) increment.deposition_time += delta_time;
   reference_time_ += delta_time;
 }
 
@@ -900,6 +1041,35 @@ void Mixture::FullConstrainedMixtureFiber<Number>::update()
           }
           break;
         }
+        case HistoryAdaptionStrategy::recursive:
+        {
+          // integrate the last timestep into the lumped history and only keep the current mass
+          // increment
+          std::vector<MassIncrement<Number>>& timesteps = history_.back().timesteps;
+          const MassIncrement<Number> begin = timesteps[timesteps.size() - 2];
+          const MassIncrement<Number> end = timesteps.back();
+
+          const double dt = end.deposition_time - begin.deposition_time;
+          const double decay = growth_evolution_.evaluate_survival_function(dt);
+          const auto [weight_begin, weight_end] =
+              evaluate_recursive_integration_weights(growth_evolution_.decay_time_, dt);
+
+          for (auto& increment : lumped_history_)
+          {
+            increment.growth_scalar_production_rate *= decay;
+            increment.deposition_time = end.deposition_time;
+          }
+
+          lump_mass_increment<Number>(lumped_history_, begin.reference_stretch,
+              weight_begin * decay * begin.growth_scalar_production_rate * begin.growth_scalar,
+              end.deposition_time, adaptive_tolerance_);
+          lump_mass_increment<Number>(lumped_history_, end.reference_stretch,
+              weight_end * end.growth_scalar_production_rate * end.growth_scalar,
+              end.deposition_time, adaptive_tolerance_);
+
+          timesteps.erase(timesteps.begin(), timesteps.end() - 1);
+          break;
+        }
         case HistoryAdaptionStrategy::window:
         {
           std::size_t num_total_items = 0;
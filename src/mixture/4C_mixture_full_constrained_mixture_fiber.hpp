@@ -57,7 +57,8 @@ namespace Mixture
     none,
     window,
     model_equation,
-    higher_order_integration
+    higher_order_integration,
+    recursive
   };
 
 
@@ -88,6 +89,12 @@ namespace Mixture
    * variables is dynamically adapted to ensure efficient memory usage and fast evaluation times
    * while keeping the integration error low.
    *
+   * With the recursive history strategy, the deposition history is not stored at all. Since the
+   * survival function is exponential, all previously deposited mass decays with the same factor
+   * within a timestep, such that the history integrals can be updated recursively. The deposited
+   * mass is lumped onto discrete reference stretches that are at least the adaptive tolerance
+   * apart, which bounds the memory and the evaluation cost independent of the simulated time.
+   *
    * @note This model is expensive in memory usage compared to the homogenized constrained mixture
    * fiber.
    *
@@ -288,6 +295,9 @@ namespace Mixture
     DepositionHistory<Number> history_{};
     std::size_t window_size = 0;
 
+    /// deposited mass lumped onto discrete reference stretches (only for the recursive strategy)
+    std::vector<MassIncrement<Number>> lumped_history_{};
+
     /// current data
     double current_time_ = 0.0;
 
@@ -1532,9 +1532,26 @@ void POROFLUIDMULTIPHASE::TimIntImpl::reconstruct_flux()
   {
     case Inpar::POROFLUIDMULTIPHASE::gradreco_l2:
     {
-      const auto& solverparams = Global::Problem::instance()->solver_params(fluxreconsolvernum_);
-      flux_ = Core::FE::compute_nodal_l2_projection(*discret_, "phinp_fluid", numvec, eleparams,
-          solverparams, Global::Problem::instance()->solver_params_callback());
+      if (flux_projection_ == nullptr)
+      {
+        // the lumped mass matrix does not need a linear solver
+        if (poroparams_.get<bool>("FLUX_PROJ_LUMPED_MASS"))
+        {
+          flux_projection_ = std::make_shared<Core::FE::NodalL2Projection>(
+              Teuchos::ParameterList(), Global::Problem::instance()->solver_params_callback(),
+              Core::FE::NodalL2Projection::MassMatrix::lumped);
+        }
+        else
+        {
+          flux_projection_ = std::make_shared<Core::FE::NodalL2Projection>(
+              Global::Problem::instance()->solver_params(fluxreconsolvernum_),
+              Global::Problem::instance()->solver_params_callback());
+        }
+      }
+      // the mass matrix changes with the deforming mesh
+      if (isale_) flux_projection_->reset();
+
+      flux_ = flux_projection_->project(*discret_, "phinp_fluid", numvec, eleparams);
       break;
     }
     default:
@@ -45,6 +45,11 @@ namespace Core::IO
   class DiscretizationWriter;
 }
 
+namespace Core::FE
+{
+  class NodalL2Projection;
+}
+
 namespace Core::LinAlg
 {
   class Solver;
@@ -526,6 +531,9 @@ namespace POROFLUIDMULTIPHASE
     //! solver number for flux reconstruction
     const int fluxreconsolvernum_;
 
+    //! L2 projection for flux reconstruction (keeps the factorized mass matrix)
+    std::shared_ptr<Core::FE::NodalL2Projection> flux_projection_;
+
     //! what to do when nonlinear solution fails
     enum Inpar::POROFLUIDMULTIPHASE::DivContAct divcontype_;
 
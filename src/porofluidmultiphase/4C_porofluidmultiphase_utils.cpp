@@ -8,6 +8,7 @@
 #include "4C_porofluidmultiphase_utils.hpp"
 
 #include "4C_adapter_porofluidmultiphase.hpp"
+#include "4C_comm_mpi_utils.hpp"
 #include "4C_fem_general_utils_createdis.hpp"
 #include "4C_fem_geometry_intersection_service.hpp"
 #include "4C_fem_geometry_intersection_service.templates.hpp"
@@ -24,23 +25,29 @@
 #include "4C_rebalance_binning_based.hpp"
 #include "4C_rebalance_print.hpp"
 
+#include <algorithm>
+#include <limits>
+
 FOUR_C_NAMESPACE_OPEN
 
 
 namespace
 {
-  std::vector<int> get_coupling_arteries_node_to_point(
-      std::shared_ptr<Core::FE::Discretization> artdis, Core::FE::Discretization& artsearchdis)
+  /*!
+   * \brief get the elements of the artery coupling nodes owned by this processor (node-to-point
+   * coupling), i.e., each coupling element is listed on exactly one processor
+   */
+  std::vector<int> get_coupling_arteries_node_to_point(Core::FE::Discretization& artdis)
   {
-    // this vector will be filled
-    std::vector<int> artEleGIDs_help;
+    const int myrank = Core::Communication::my_mpi_rank(artdis.get_comm());
+
+    // this set will be filled
+    std::set<int> artEleGIDs_help;
 
     // get 1D coupling IDs from Input
     std::vector<Core::Conditions::Condition*> artCoupcond;
 
-    artdis->get_condition("ArtPorofluidCouplConNodeToPoint", artCoupcond);
-
-    artEleGIDs_help.reserve(artCoupcond.size());
+    artdis.get_condition("ArtPorofluidCouplConNodeToPoint", artCoupcond);
 
     // get global element Ids from artery coupling nodes
     for (const auto& iter : artCoupcond)
@@ -49,18 +56,22 @@ namespace
 
       for (auto const nodeid : *ArteryNodeIds)
       {
-        Core::Nodes::Node* artnode = artsearchdis.g_node(nodeid);
+        if (not artdis.have_global_node(nodeid)) continue;
+        Core::Nodes::Node* artnode = artdis.g_node(nodeid);
+        if (artnode->owner() != myrank) continue;
+
         Core::Elements::Element** artele = artnode->elements();
         // get Id of corresponding element; Note: in lung modeling only most distal nodes
         // are coupled, so coupling nodes can only belong to one element
         const int elementID = artele[0]->id();
         // safety check if assertion is true
         FOUR_C_ASSERT(elementID >= 0, "It is not possible to have a negative element ID!");
-        artEleGIDs_help.push_back(elementID);
+        artEleGIDs_help.insert(elementID);
       }
     }
-    return artEleGIDs_help;
+    return std::vector<int>(artEleGIDs_help.begin(), artEleGIDs_help.end());
   }
+
 }  // namespace
 
 /*----------------------------------------------------------------------*/
@@ -208,9 +219,8 @@ std::map<int, std::set<int>> POROFLUIDMULTIPHASE::Utils::extended_ghosting_arter
   artdis->fill_complete();
   if (!contdis.filled()) contdis.fill_complete();
 
-  // create the fully overlapping search discretization
-  std::shared_ptr<Core::FE::Discretization> artsearchdis =
-      create_fully_overlapping_artery_discretization(*artdis, "artsearchdis", false);
+  MPI_Comm comm = contdis.get_comm();
+  const int numproc = Core::Communication::num_mpi_ranks(comm);
 
   // to be filled with additional elements to be ghosted
   std::set<int> elecolset;
@@ -230,29 +240,104 @@ std::map<int, std::set<int>> POROFLUIDMULTIPHASE::Utils::extended_ghosting_arter
     nodecolset.insert(gid);
   }
 
-  // get artEleGIDs depending on the coupling method
+  // get artEleGIDs depending on the coupling method, each element is listed on exactly one
+  // processor
   const std::vector<int> artEleGIDs = std::invoke(
       [&]()
       {
         if (couplingmethod == Inpar::ArteryNetwork::ArteryPoroMultiphaseScatraCouplingMethod::ntp)
         {
-          return get_coupling_arteries_node_to_point(artdis, *artsearchdis);
+          return get_coupling_arteries_node_to_point(*artdis);
         }
         else
         {
           std::vector<int> artEleGIDs_help;
-          artEleGIDs_help.reserve(artsearchdis->element_col_map()->NumMyElements());
-          for (int iart = 0; iart < artsearchdis->element_col_map()->NumMyElements(); ++iart)
+          artEleGIDs_help.reserve(artdis->element_row_map()->NumMyElements());
+          for (int iart = 0; iart < artdis->element_row_map()->NumMyElements(); ++iart)
           {
-            artEleGIDs_help.push_back(artsearchdis->element_col_map()->GID(iart));
+            artEleGIDs_help.push_back(artdis->element_row_map()->GID(iart));
           }
           return artEleGIDs_help;
         }
       });
 
-  // search with the fully overlapping discretization
-  std::map<int, std::set<int>> nearbyelepairs = oct_tree_search(contdis, *artdis, *artsearchdis,
-      evaluate_on_lateral_surface, artEleGIDs, elecolset, nodecolset);
+  // bounding box of the 2D/3D column elements of each processor
+  std::vector<double> myaabb(6);
+  for (int idim = 0; idim < 3; ++idim)
+  {
+    myaabb[2 * idim] = std::numeric_limits<double>::max();
+    myaabb[2 * idim + 1] = std::numeric_limits<double>::lowest();
+  }
+  for (const auto& [contelegid, aabb_contele] :
+      Core::Geo::get_current_xaab_bs(contdis, get_nodal_positions(contdis, contdis.node_col_map())))
+  {
+    for (int idim = 0; idim < 3; ++idim)
+    {
+      myaabb[2 * idim] = std::min(myaabb[2 * idim], aabb_contele(idim, 0));
+      myaabb[2 * idim + 1] = std::max(myaabb[2 * idim + 1], aabb_contele(idim, 1));
+    }
+  }
+  std::vector<double> aabbs(6 * numproc);
+  Core::Communication::gather_all(myaabb.data(), aabbs.data(), 6, comm);
+  std::vector<Core::LinAlg::Matrix<3, 2>> aabb_procs(numproc);
+  for (int iproc = 0; iproc < numproc; ++iproc)
+    for (int idim = 0; idim < 3; ++idim)
+      for (int j = 0; j < 2; ++j) aabb_procs[iproc](idim, j) = aabbs[6 * iproc + 2 * idim + j];
+
+  // send each artery element to the processors whose 2D/3D elements it may intersect, instead of
+  // searching the whole artery network on every processor
+  std::vector<std::vector<int>> candidates_to_send(numproc);
+  {
+    std::map<int, Core::LinAlg::Matrix<3, 1>> positions_artery =
+        get_nodal_positions(*artdis, artdis->node_col_map());
+    for (const int artelegid : artEleGIDs)
+    {
+      const Core::LinAlg::Matrix<3, 2> aabb_artery =
+          get_aabb(artdis->g_element(artelegid), positions_artery, evaluate_on_lateral_surface);
+      for (int iproc = 0; iproc < numproc; ++iproc)
+      {
+        if (Core::Geo::intersection_of_b_vs(aabb_procs[iproc], aabb_artery))
+          candidates_to_send[iproc].push_back(artelegid);
+      }
+    }
+  }
+  std::vector<int> candidates;
+  Core::LinAlg::all_to_all_communication(comm, candidates_to_send, candidates);
+
+  // ghost the candidates temporarily, the search is performed on the artery discretization itself
+  {
+    std::set<int> searchelecolset(elecolset);
+    searchelecolset.insert(candidates.begin(), candidates.end());
+    std::vector<int> coleles(searchelecolset.begin(), searchelecolset.end());
+    const Epetra_Map searchelecolmap(
+        -1, coleles.size(), coleles.data(), 0, Core::Communication::as_epetra_comm(comm));
+    artdis->export_column_elements(searchelecolmap);
+
+    std::set<int> searchnodecolset(nodecolset);
+    for (const int artelegid : candidates)
+    {
+      const Core::Elements::Element* artele = artdis->g_element(artelegid);
+      searchnodecolset.insert(artele->node_ids(), artele->node_ids() + artele->num_node());
+    }
+    std::vector<int> colnodes(searchnodecolset.begin(), searchnodecolset.end());
+    const Epetra_Map searchnodecolmap(
+        -1, colnodes.size(), colnodes.data(), 0, Core::Communication::as_epetra_comm(comm));
+    artdis->export_column_nodes(searchnodecolmap);
+
+    artdis->fill_complete();
+  }
+
+  // search only the candidates of this processor
+  std::map<int, std::set<int>> nearbyelepairs =
+      oct_tree_search(contdis, *artdis, evaluate_on_lateral_surface, candidates);
+
+  // only the artery elements with coupling partners (and their nodes) remain ghosted
+  for (const auto& [artelegid, closeeles] : nearbyelepairs)
+  {
+    const Core::Elements::Element* artele = artdis->g_element(artelegid);
+    elecolset.insert(artelegid);
+    nodecolset.insert(artele->node_ids(), artele->node_ids() + artele->num_node());
+  }
 
   // extended ghosting for elements
   std::vector<int> coleles(elecolset.begin(), elecolset.end());
@@ -307,8 +392,7 @@ POROFLUIDMULTIPHASE::Utils::create_fully_overlapping_artery_discretization(
  *----------------------------------------------------------------------*/
 std::map<int, std::set<int>> POROFLUIDMULTIPHASE::Utils::oct_tree_search(
     Core::FE::Discretization& contdis, Core::FE::Discretization& artdis,
-    Core::FE::Discretization& artsearchdis, const bool evaluate_on_lateral_surface,
-    const std::vector<int> artEleGIDs, std::set<int>& elecolset, std::set<int>& nodecolset)
+    const bool evaluate_on_lateral_surface, const std::vector<int>& artEleGIDs)
 {
   // this map will be filled
   std::map<int, std::set<int>> nearbyelepairs;
@@ -335,23 +419,14 @@ std::map<int, std::set<int>> POROFLUIDMULTIPHASE::Utils::oct_tree_search(
   double dtcpu = timersearch.wallTime();
   // *********** time measurement ***********
 
-  // nodal positions of artery-discretization (fully overlapping)
-  std::map<int, Core::LinAlg::Matrix<3, 1>> positions_artery;
-  // nodal positions of artery-discretization (row-map format)
-  std::map<int, Core::LinAlg::Matrix<3, 1>> my_positions_artery =
-      get_nodal_positions(artdis, artdis.node_row_map());
+  // nodal positions of artery discretization (column-map format)
+  std::map<int, Core::LinAlg::Matrix<3, 1>> positions_artery =
+      get_nodal_positions(artdis, artdis.node_col_map());
 
-  // gather
-  std::vector<int> procs(Core::Communication::num_mpi_ranks(contdis.get_comm()));
-  for (int i = 0; i < Core::Communication::num_mpi_ranks(contdis.get_comm()); i++) procs[i] = i;
-  Core::LinAlg::gather<int, Core::LinAlg::Matrix<3, 1>>(my_positions_artery, positions_artery,
-      Core::Communication::num_mpi_ranks(contdis.get_comm()), procs.data(), contdis.get_comm());
-
-  // do the actual search on fully overlapping artery discretization
-  for (unsigned int iart = 0; iart < artEleGIDs.size(); ++iart)
+  // do the actual search
+  for (const int artelegid : artEleGIDs)
   {
-    const int artelegid = artEleGIDs[iart];
-    Core::Elements::Element* artele = artsearchdis.g_element(artelegid);
+    Core::Elements::Element* artele = artdis.g_element(artelegid);
 
     // axis-aligned bounding box of artery
     const Core::LinAlg::Matrix<3, 2> aabb_artery =
@@ -362,29 +437,7 @@ std::map<int, std::set<int>> POROFLUIDMULTIPHASE::Utils::oct_tree_search(
     searchTree.search_collisions(aabb_cont, aabb_artery, 0, closeeles);
 
     // nearby elements found
-    if (closeeles.size() > 0)
-    {
-      nearbyelepairs[artelegid] = closeeles;
-
-      // add elements and nodes for extended ghosting of artery discretization
-      if (not artdis.have_global_element(artelegid))
-      {
-        elecolset.insert(artelegid);
-        const int* nodeids = artele->node_ids();
-        for (int inode = 0; inode < artele->num_node(); ++inode) nodecolset.insert(nodeids[inode]);
-      }
-    }
-
-    // estimate of duration for search (check how long the search took for 1/20 of all elements, the
-    // estimated total time of the search is then 20 times this time)
-    if (iart == (0.05 * artEleGIDs.size()))
-    {
-      double mydtsearch = timersearch.wallTime() - dtcpu;
-      double maxdtsearch = 0.0;
-      Core::Communication::max_all(&mydtsearch, &maxdtsearch, 1, contdis.get_comm());
-      if (Core::Communication::my_mpi_rank(contdis.get_comm()) == 0)
-        std::cout << "Estimated duration: " << 20.0 * (maxdtsearch) << "s" << std::endl;
-    }
+    if (closeeles.size() > 0) nearbyelepairs[artelegid] = closeeles;
   }
 
   // *********** time measurement ***********
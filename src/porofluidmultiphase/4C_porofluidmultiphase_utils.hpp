@@ -80,6 +80,11 @@ namespace POROFLUIDMULTIPHASE
 
     /**
      * \brief extend ghosting for artery discretization
+     *
+     * The artery network is not made fully overlapping: every processor sends its artery elements
+     * to the processors whose 2D/3D elements they may intersect (bounding boxes), the candidates
+     * are searched there and only the artery elements with coupling partners remain ghosted.
+     *
      * @param[in] contdis  discretization of 2D/3D domain
      * @param[in] artdis   discretization of 1D domain
      * @param[in] evaluate_on_lateral_surface   is coupling evaluated on lateral surface?
@@ -108,20 +113,16 @@ namespace POROFLUIDMULTIPHASE
     /**
      * \brief perform octtree search for NTP coupling
      * @param[in] contdis       discretization of 2D/3D domain
-     * @param[in] artdis        discretization of 1D domain
-     * @param[in] artsearchdis  fully overlapping discretization of 1D domain on which search is
-     * performed
+     * @param[in] artdis        discretization of 1D domain, holds the elements in artEleGIDs and
+     *                          their nodes in column format
      * @param[in] evaluate_on_lateral_surface   is coupling evaluated on lateral surface?
      * @param[in] artEleGIDs   vector of artery coupling element Ids
-     * @param[out] elecolset    additional elements that need to be ghosted are filled into this set
-     * @param[out] nodecolset   additional nodes that need to be ghosted are filled into this set
      * @return                  set of nearby element pairs as seen from the artery discretization,
      *                          each artery element with a vector of close 3D elements
      */
     std::map<int, std::set<int>> oct_tree_search(Core::FE::Discretization& contdis,
-        Core::FE::Discretization& artdis, Core::FE::Discretization& artsearchdis,
-        const bool evaluate_on_lateral_surface, const std::vector<int> artEleGIDs,
-        std::set<int>& elecolset, std::set<int>& nodecolset);
+        Core::FE::Discretization& artdis, const bool evaluate_on_lateral_surface,
+        const std::vector<int>& artEleGIDs);
 
     /*!
      * \brief get nodal positions of discretization as std::map
@@ -0,0 +1,197 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_porofluidmultiphase_utils.hpp"
+
+#include "4C_art_net_artery.hpp"
+#include "4C_comm_mpi_utils.hpp"
+#include "4C_fem_discretization.hpp"
+#include "4C_fem_general_node.hpp"
+#include "4C_global_data.hpp"
+#include "4C_io_gridgenerator.hpp"
+#include "4C_io_input_parameter_container.hpp"
+#include "4C_io_pstream.hpp"
+#include "4C_mat_material_factory.hpp"
+#include "4C_mat_par_bundle.hpp"
+#include "4C_material_parameter_base.hpp"
+#include "4C_utils_singleton_owner.hpp"
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  void create_materials_in_global_problem()
+  {
+    Core::IO::InputParameterContainer mat_stvenant;
+    mat_stvenant.add("YOUNG", 1.0);
+    mat_stvenant.add("NUE", 0.1);
+    mat_stvenant.add("DENS", 2.0);
+    Global::Problem::instance()->materials()->insert(
+        1, Mat::make_parameter(1, Core::Materials::MaterialType::m_stvenant, mat_stvenant));
+
+    Core::IO::InputParameterContainer mat_artery;
+    mat_artery.add("VISCOSITY", 1.0);
+    mat_artery.add("DENS", 1.0);
+    mat_artery.add("YOUNG", 1.0);
+    mat_artery.add("NUE", 0.5);
+    mat_artery.add("TH", 0.01);
+    mat_artery.add("PEXT1", 0.0);
+    mat_artery.add("PEXT2", 0.0);
+    mat_artery.add("VISCOSITYLAW", std::string("CONSTANT"));
+    mat_artery.add("BLOOD_VISC_SCALE_DIAM_TO_MICRONS", 1.0);
+    mat_artery.add("VARYING_DIAMETERLAW", std::string("CONSTANT"));
+    mat_artery.add("VARYING_DIAMETER_FUNCTION", -1);
+    mat_artery.add("COLLAPSE_THRESHOLD", -1.0);
+    Global::Problem::instance()->materials()->insert(
+        2, Mat::make_parameter(2, Core::Materials::MaterialType::m_cnst_art, mat_artery));
+  }
+
+  /** The tests couple an artery, which runs diagonally through the unit cube and partly outside of
+   *  it, with a hex8 discretization of the cube. Both discretizations are distributed over all
+   *  processors independently of each other.
+   */
+  class ExtendedGhostingArteryTest : public ::testing::Test
+  {
+   protected:
+    void SetUp() override
+    {
+      create_materials_in_global_problem();
+      comm_ = MPI_COMM_WORLD;
+      Core::IO::cout.setup(false, false, false, Core::IO::standard, comm_, 0, 0, "dummyFilePrefix");
+
+      // 3 x 3 x 4 hex8 elements on the unit cube
+      Core::IO::GridGenerator::RectangularCuboidInputs inputData{};
+      inputData.bottom_corner_point_ = std::array<double, 3>{0.0, 0.0, 0.0};
+      inputData.top_corner_point_ = std::array<double, 3>{1.0, 1.0, 1.0};
+      inputData.interval_ = std::array<int, 3>{3, 3, 4};
+      inputData.node_gid_of_first_new_node_ = 0;
+      inputData.elementtype_ = "SOLID";
+      inputData.distype_ = "HEX8";
+      inputData.elearguments_ = "MAT 1 KINEM nonlinear";
+
+      contdis_ = std::make_shared<Core::FE::Discretization>("porofluid", comm_, 3);
+      Core::IO::GridGenerator::create_rectangular_cuboid_discretization(
+          *contdis_, inputData, true);
+      contdis_->fill_complete(false, false, false);
+
+      artdis_ = std::make_shared<Core::FE::Discretization>("artery", comm_, 3);
+      create_artery();
+    }
+
+    void TearDown() override { Core::IO::cout.close(); }
+
+    //! line of artery elements, each processor holds a contiguous part of it
+    void create_artery()
+    {
+      const int myrank = Core::Communication::my_mpi_rank(comm_);
+      const int numproc = Core::Communication::num_mpi_ranks(comm_);
+      auto owner = [&](const int node) { return node * numproc / num_artery_nodes_; };
+      auto add_node = [&](const int node)
+      {
+        const double s = node / (num_artery_nodes_ - 1.0);
+        const std::vector<double> x = {-0.4 + 1.8 * s, 0.15 + 0.7 * s, -0.3 + 1.5 * s};
+        artdis_->add_node(std::make_shared<Core::Nodes::Node>(node, x, owner(node)));
+      };
+
+      Core::IO::InputParameterContainer container;
+      container.add("MAT", 2);
+      container.add("GP", 2);
+      container.add("TYPE", std::string("PressureBased"));
+      container.add("DIAM", 0.1);
+
+      for (int node = 0; node < num_artery_nodes_; ++node)
+      {
+        if (owner(node) == myrank) add_node(node);
+      }
+      for (int ele = 0; ele < num_artery_nodes_ - 1; ++ele)
+      {
+        if (owner(ele) != myrank) continue;
+        if (owner(ele + 1) != myrank) add_node(ele + 1);
+
+        auto artele = std::make_shared<Discret::Elements::Artery>(ele, myrank);
+        const std::array<int, 2> nodeids = {ele, ele + 1};
+        artele->set_node_ids(2, nodeids.data());
+        artele->read_element("ARTERY", "LINE2", container);
+        artdis_->add_element(artele);
+      }
+      artdis_->fill_complete(false, false, false);
+    }
+
+    //! nearby element pairs of this processor found by searching the fully overlapping artery
+    std::map<int, std::set<int>> search_fully_overlapping(const bool evaluate_on_lateral_surface)
+    {
+      std::shared_ptr<Core::FE::Discretization> artsearchdis =
+          POROFLUIDMULTIPHASE::Utils::create_fully_overlapping_artery_discretization(
+              *artdis_, "artery_search", false);
+
+      std::vector<int> artelegids;
+      for (int lid = 0; lid < artsearchdis->num_my_col_elements(); ++lid)
+        artelegids.push_back(artsearchdis->l_col_element(lid)->id());
+
+      return POROFLUIDMULTIPHASE::Utils::oct_tree_search(
+          *contdis_, *artsearchdis, evaluate_on_lateral_surface, artelegids);
+    }
+
+    void expect_same_pairs_as_fully_overlapping_search(const bool evaluate_on_lateral_surface)
+    {
+      const std::map<int, std::set<int>> expected =
+          search_fully_overlapping(evaluate_on_lateral_surface);
+
+      const std::map<int, std::set<int>> nearbyelepairs =
+          POROFLUIDMULTIPHASE::Utils::extended_ghosting_artery_discretization(*contdis_, artdis_,
+              evaluate_on_lateral_surface,
+              Inpar::ArteryNetwork::ArteryPoroMultiphaseScatraCouplingMethod::gpts);
+
+      EXPECT_EQ(nearbyelepairs, expected);
+
+      // the artery elements with coupling partners and their nodes are ghosted
+      for (const auto& [artelegid, closeeles] : nearbyelepairs)
+      {
+        ASSERT_TRUE(artdis_->have_global_element(artelegid));
+        const Core::Elements::Element* artele = artdis_->g_element(artelegid);
+        for (int inode = 0; inode < artele->num_node(); ++inode)
+          EXPECT_TRUE(artdis_->have_global_node(artele->node_ids()[inode]));
+      }
+
+      // some artery elements couple with 2D/3D elements on processors which do not own them
+      int my_num_ghosted_pairs = 0;
+      for (const auto& [artelegid, closeeles] : nearbyelepairs)
+      {
+        if (artdis_->g_element(artelegid)->owner() != Core::Communication::my_mpi_rank(comm_))
+          ++my_num_ghosted_pairs;
+      }
+      int num_ghosted_pairs = 0;
+      Core::Communication::sum_all(&my_num_ghosted_pairs, &num_ghosted_pairs, 1, comm_);
+      EXPECT_GT(num_ghosted_pairs, 0);
+    }
+
+    static constexpr int num_artery_nodes_ = 25;
+
+    MPI_Comm comm_;
+    std::shared_ptr<Core::FE::Discretization> contdis_;
+    std::shared_ptr<Core::FE::Discretization> artdis_;
+
+    Core::Utils::SingletonOwnerRegistry::ScopeGuard guard;
+  };
+
+  TEST_F(ExtendedGhostingArteryTest, SamePairsAsFullyOverlappingSearch)
+  {
+    expect_same_pairs_as_fully_overlapping_search(false);
+  }
+
+  TEST_F(ExtendedGhostingArteryTest, SamePairsAsFullyOverlappingSearchOnLateralSurface)
+  {
+    expect_same_pairs_as_fully_overlapping_search(true);
+  }
+}  // namespace
@@ -103,6 +103,9 @@ std::shared_ptr<Airway::RedAirwayImplicitTimeInt> dyn_red_airways_drt(bool Coupl
   airwaystimeparams.set("tolerance", rawdyn.get<double>("TOLERANCE"));
   // Maximum number of iterations
   airwaystimeparams.set("maximum iteration steps", rawdyn.get<int>("MAXITERATIONS"));
+  // Elimination along the airway tree
+  airwaystimeparams.set("tree solver", rawdyn.get<bool>("TREE_SOLVER"));
+  airwaystimeparams.set("tree solver max size", rawdyn.get<int>("TREE_SOLVER_MAX_SIZE"));
 
   if (rawdyn.get<bool>("COMPAWACINTER"))
     airwaystimeparams.set("CompAwAcInter", true);
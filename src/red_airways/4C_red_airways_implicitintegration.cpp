@@ -71,6 +71,12 @@ Airway::RedAirwayImplicitTimeInt::RedAirwayImplicitTimeInt(
   non_lin_tol_ = params_.get<double>("tolerance");
   // solve Aw-AC-Interdependency
   compAwAcInter_ = params_.get<bool>("CompAwAcInter");
+  // direct elimination along the airway tree
+  if (params_.get<bool>("tree solver", false))
+  {
+    tree_solver_ =
+        std::make_unique<TreeSolver>(64, params_.get<int>("tree solver max size", 100000));
+  }
 
   // calculate acini volume0 flag; option for acini volume adjustment via prestress
   calcV0PreStress_ = params_.get<bool>("CalcV0PreStress");
@@ -1030,11 +1036,32 @@ void Airway::RedAirwayImplicitTimeInt::solve(
     {
       TEUCHOS_FUNC_TIME_MONITOR("      + solver calls");
     }
+    // Try the elimination along the airway tree first
+    bool solved = false;
+    if (tree_solver_)
+    {
+      solved = tree_solver_->solve(
+          *std::dynamic_pointer_cast<Core::LinAlg::SparseMatrix>(sysmat_), *pnp_, *rhs_);
+
+      // the topology of the network does not change, so there is no point in trying again
+      if (!tree_solver_->is_setup())
+      {
+        if (!myrank_)
+          std::cout << "Airway network is too large or not tree-like enough for the tree "
+                       "solver, using LINEAR_SOLVER instead"
+                    << std::endl;
+        tree_solver_ = nullptr;
+      }
+    }
+
     // Call solver
-    Core::LinAlg::SolverParams solver_params;
-    solver_params.refactor = true;
-    solver_params.reset = true;
-    solver_->solve(sysmat_->epetra_operator(), pnp_, rhs_, solver_params);
+    if (!solved)
+    {
+      Core::LinAlg::SolverParams solver_params;
+      solver_params.refactor = true;
+      solver_params.reset = true;
+      solver_->solve(sysmat_->epetra_operator(), pnp_, rhs_, solver_params);
+    }
   }
 
   // end time measurement for solver
@@ -18,6 +18,7 @@
 #include "4C_linalg_utils_sparse_algebra_create.hpp"
 #include "4C_linalg_utils_sparse_algebra_manipulation.hpp"
 #include "4C_linalg_vector.hpp"
+#include "4C_red_airways_tree_solver.hpp"
 #include "4C_utils_function.hpp"
 #include "4C_utils_parameter_list.fwd.hpp"
 
@@ -264,6 +265,8 @@ namespace Airway
     //! reduced dimensional airway network discretization
     std::shared_ptr<Core::FE::Discretization> discret_;
     std::unique_ptr<Core::LinAlg::Solver> solver_;
+    //! direct solver exploiting the tree topology of the network (optional)
+    std::unique_ptr<TreeSolver> tree_solver_;
     Teuchos::ParameterList params_;
     Core::IO::DiscretizationWriter& output_;
     //! the processor ID from the communicator
@@ -517,6 +517,9 @@ void Airway::RedAirwayTissue::setup_red_airways()
   airwaystimeparams.set("tolerance", rawdyn.get<double>("TOLERANCE"));
   // Maximum number of iterations
   airwaystimeparams.set("maximum iteration steps", rawdyn.get<int>("MAXITERATIONS"));
+  // Elimination along the airway tree
+  airwaystimeparams.set("tree solver", rawdyn.get<bool>("TREE_SOLVER"));
+  airwaystimeparams.set("tree solver max size", rawdyn.get<int>("TREE_SOLVER_MAX_SIZE"));
   // compute Interdependency
   if (rawdyn.get<bool>("COMPAWACINTER"))
     airwaystimeparams.set("CompAwAcInter", true);
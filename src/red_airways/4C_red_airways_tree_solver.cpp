@@ -0,0 +1,441 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_red_airways_tree_solver.hpp"
+
+#include "4C_linalg_sparsematrix.hpp"
+#include "4C_linalg_utils_densematrix_communication.hpp"
+#include "4C_linalg_vector.hpp"
+#include "4C_utils_exceptions.hpp"
+
+#include <Epetra_CrsMatrix.h>
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  /// relative size of a pivot below which the elimination is considered to break down
+  constexpr double pivot_tolerance = 1.0e-14;
+
+  /// position of entry (row, col) in compressed row storage, -1 if structurally zero
+  int find_position(const std::vector<int>& row_ptr, const std::vector<int>& cols, const int row,
+      const int col)
+  {
+    for (int k = row_ptr[row]; k < row_ptr[row + 1]; ++k)
+      if (cols[k] == col) return k;
+    return -1;
+  }
+
+  /// value at a position in compressed row storage, zero if structurally zero
+  double value_at(const std::vector<double>& values, const int pos)
+  {
+    return pos < 0 ? 0.0 : values[pos];
+  }
+}  // namespace
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+Airway::TreeSolver::TreeSolver(const int max_num_separators, const int max_size)
+    : max_num_separators_(max_num_separators), max_size_(max_size)
+{
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+bool Airway::TreeSolver::solve(const Core::LinAlg::SparseMatrix& A,
+    Core::LinAlg::Vector<double>& x, const Core::LinAlg::Vector<double>& b)
+{
+  if (!A.filled()) FOUR_C_THROW("The tree solver expects a filled system matrix");
+
+  const Epetra_CrsMatrix& matrix = *A.epetra_matrix();
+  const Epetra_Map& rowmap = matrix.RowMap();
+  const Epetra_Comm& comm = rowmap.Comm();
+  const bool parallel = comm.NumProc() > 1;
+
+  // the sequential elimination is not meant for large systems
+  if (matrix.NumGlobalRows() > max_size_)
+  {
+    is_setup_ = false;
+    return false;
+  }
+
+  // in parallel the whole system is gathered on the first rank and solved there
+  if (parallel and (!source_map_ or !source_map_->SameAs(rowmap)))
+  {
+    source_map_ = std::make_shared<Epetra_Map>(rowmap);
+    root_map_ = Core::LinAlg::allreduce_e_map(rowmap, 0);
+    importer_ = std::make_shared<Epetra_Import>(*root_map_, rowmap);
+  }
+
+  // all other ranks hold an empty system, which is trivially analyzed and factorized
+  bool pattern_changed = false;
+  if (parallel)
+  {
+    Epetra_CrsMatrix gathered(Copy, *root_map_, 0);
+    const int err = gathered.Import(matrix, *importer_, Insert);
+    if (err) FOUR_C_THROW("Gathering of the system matrix failed with error code %d", err);
+    pattern_changed = extract_system(gathered);
+  }
+  else
+    pattern_changed = extract_system(matrix);
+
+  // the symbolic analysis only has to be redone if the sparsity pattern changed
+  if (pattern_changed) setup(row_ptr_, cols_);
+
+  // all ranks have to agree on the result of the first rank
+  int local_success = is_setup_ ? 1 : 0;
+  int success = 0;
+  comm.MinAll(&local_success, &success, 1);
+  is_setup_ = success == 1;
+  if (!is_setup_) return false;
+
+  local_success = factorize(values_) ? 1 : 0;
+  comm.MinAll(&local_success, &success, 1);
+  if (success == 0) return false;
+
+  std::vector<double> solution(row_ptr_.size() - 1);
+  if (parallel)
+  {
+    Core::LinAlg::Vector<double> gathered(*root_map_, false);
+    const int err = gathered.Import(b, *importer_, Insert);
+    if (err) FOUR_C_THROW("Gathering of the right hand side failed with error code %d", err);
+    std::copy(gathered.Values(), gathered.Values() + gathered.MyLength(), solution.begin());
+
+    solve(solution);
+
+    std::copy(solution.begin(), solution.end(), gathered.Values());
+    const int err_scatter = x.Export(gathered, *importer_, Insert);
+    if (err_scatter)
+      FOUR_C_THROW("Distribution of the solution failed with error code %d", err_scatter);
+  }
+  else
+  {
+    std::copy(b.Values(), b.Values() + b.MyLength(), solution.begin());
+    solve(solution);
+    std::copy(solution.begin(), solution.end(), x.Values());
+  }
+
+  return true;
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+bool Airway::TreeSolver::extract_system(const Epetra_CrsMatrix& A)
+{
+  const Epetra_BlockMap& map = A.RowMap();
+  const int num_rows = map.NumMyElements();
+
+  std::vector<int> row_ptr(num_rows + 1, 0);
+  std::vector<int> cols;
+  cols.reserve(cols_.size());
+  values_.clear();
+  values_.reserve(cols_.size());
+
+  std::vector<double> row_values(A.MaxNumEntries());
+  std::vector<int> row_indices(A.MaxNumEntries());
+  for (int row = 0; row < num_rows; ++row)
+  {
+    int num_entries = 0;
+    const int err = A.ExtractGlobalRowCopy(map.GID(row), static_cast<int>(row_values.size()),
+        num_entries, row_values.data(), row_indices.data());
+    if (err) FOUR_C_THROW("Extraction of row %d failed with error code %d", map.GID(row), err);
+
+    for (int k = 0; k < num_entries; ++k)
+    {
+      const int col = map.LID(row_indices[k]);
+      if (col < 0) FOUR_C_THROW("Column %d of the system matrix is not a row", row_indices[k]);
+      cols.push_back(col);
+      values_.push_back(row_values[k]);
+    }
+    row_ptr[row + 1] = static_cast<int>(cols.size());
+  }
+
+  const bool pattern_changed = row_ptr != row_ptr_ or cols != cols_;
+  row_ptr_ = std::move(row_ptr);
+  cols_ = std::move(cols);
+
+  return pattern_changed;
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+bool Airway::TreeSolver::setup(const std::vector<int>& row_ptr, const std::vector<int>& cols)
+{
+  if (&row_ptr != &row_ptr_) row_ptr_ = row_ptr;
+  if (&cols != &cols_) cols_ = cols;
+
+  is_setup_ = false;
+  const int num_rows = static_cast<int>(row_ptr_.size()) - 1;
+
+  // undirected matrix graph, since Dirichlet conditions destroy the structural symmetry
+  std::vector<std::vector<int>> adjacency(num_rows);
+  for (int row = 0; row < num_rows; ++row)
+  {
+    for (int k = row_ptr_[row]; k < row_ptr_[row + 1]; ++k)
+    {
+      if (cols_[k] == row) continue;
+      adjacency[row].push_back(cols_[k]);
+      adjacency[cols_[k]].push_back(row);
+    }
+  }
+  for (auto& neighbors : adjacency)
+  {
+    std::sort(neighbors.begin(), neighbors.end());
+    neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+  }
+
+  // breadth-first search on all unknowns that are not excluded, returns the visiting order
+  const auto build_forest = [&](const std::vector<int>& excluded, std::vector<int>& parent)
+  {
+    std::vector<int> order;
+    order.reserve(num_rows);
+    parent.assign(num_rows, -1);
+    std::vector<bool> visited(num_rows, false);
+
+    for (int root = 0; root < num_rows; ++root)
+    {
+      if (visited[root] or excluded[root] >= 0) continue;
+
+      std::queue<int> queue;
+      queue.push(root);
+      visited[root] = true;
+      while (!queue.empty())
+      {
+        const int node = queue.front();
+        queue.pop();
+        order.push_back(node);
+        for (const int neighbor : adjacency[node])
+        {
+          if (visited[neighbor] or excluded[neighbor] >= 0) continue;
+          visited[neighbor] = true;
+          parent[neighbor] = node;
+          queue.push(neighbor);
+        }
+      }
+    }
+    return order;
+  };
+
+  // every edge that is not part of a spanning forest closes a loop and one of its ends becomes
+  // a separator of the Schur complement
+  separators_.clear();
+  separator_id_.assign(num_rows, -1);
+  {
+    std::vector<int> spanning_parent;
+    build_forest(separator_id_, spanning_parent);
+
+    for (int row = 0; row < num_rows; ++row)
+    {
+      for (const int neighbor : adjacency[row])
+      {
+        if (neighbor < row or spanning_parent[row] == neighbor or
+            spanning_parent[neighbor] == row)
+          continue;
+        if (separator_id_[row] >= 0 or separator_id_[neighbor] >= 0) continue;
+
+        if (num_separators() == max_num_separators_) return false;
+        separator_id_[neighbor] = num_separators();
+        separators_.push_back(neighbor);
+      }
+    }
+  }
+
+  // without the separators the remaining graph is a forest
+  order_ = build_forest(separator_id_, parent_);
+
+  diag_pos_.resize(num_rows);
+  to_parent_pos_.assign(num_rows, -1);
+  from_parent_pos_.assign(num_rows, -1);
+  for (int row = 0; row < num_rows; ++row)
+  {
+    diag_pos_[row] = find_position(row_ptr_, cols_, row, row);
+    if (parent_[row] < 0) continue;
+    to_parent_pos_[row] = find_position(row_ptr_, cols_, row, parent_[row]);
+    from_parent_pos_[row] = find_position(row_ptr_, cols_, parent_[row], row);
+  }
+
+  is_setup_ = true;
+  return true;
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+bool Airway::TreeSolver::factorize(const std::vector<double>& values)
+{
+  if (!is_setup_) FOUR_C_THROW("Symbolic analysis of the tree solver missing");
+  if (&values != &values_) values_ = values;
+
+  const int num_rows = static_cast<int>(row_ptr_.size()) - 1;
+
+  // eliminate the forest from the leaves towards the roots
+  pivot_.resize(num_rows);
+  factor_.assign(num_rows, 0.0);
+  for (const int row : order_) pivot_[row] = value_at(values_, diag_pos_[row]);
+
+  for (auto it = order_.rbegin(); it != order_.rend(); ++it)
+  {
+    const int row = *it;
+
+    double row_scale = 0.0;
+    for (int k = row_ptr_[row]; k < row_ptr_[row + 1]; ++k)
+      row_scale = std::max(row_scale, std::abs(values_[k]));
+    if (std::abs(pivot_[row]) <= pivot_tolerance * row_scale or pivot_[row] == 0.0) return false;
+
+    const int parent = parent_[row];
+    if (parent < 0) continue;
+
+    factor_[row] = value_at(values_, from_parent_pos_[row]) / pivot_[row];
+    pivot_[parent] -= factor_[row] * value_at(values_, to_parent_pos_[row]);
+  }
+
+  // Schur complement of the separators
+  const int num_sep = num_separators();
+  separator_columns_.assign(static_cast<std::size_t>(num_sep) * num_rows, 0.0);
+  schur_.assign(static_cast<std::size_t>(num_sep) * num_sep, 0.0);
+  schur_perm_.resize(num_sep);
+  if (num_sep == 0) return true;
+
+  for (const int row : order_)
+  {
+    for (int k = row_ptr_[row]; k < row_ptr_[row + 1]; ++k)
+    {
+      const int sep = separator_id_[cols_[k]];
+      if (sep >= 0) separator_columns_[static_cast<std::size_t>(sep) * num_rows + row] = values_[k];
+    }
+  }
+
+  std::vector<double> column(num_rows);
+  for (int sep = 0; sep < num_sep; ++sep)
+  {
+    auto begin = separator_columns_.begin() + static_cast<std::ptrdiff_t>(sep) * num_rows;
+    std::copy(begin, begin + num_rows, column.begin());
+    solve_forest(column);
+    std::copy(column.begin(), column.end(), begin);
+  }
+
+  for (int i = 0; i < num_sep; ++i)
+  {
+    const int row = separators_[i];
+    for (int k = row_ptr_[row]; k < row_ptr_[row + 1]; ++k)
+    {
+      const int col = cols_[k];
+      if (separator_id_[col] >= 0)
+      {
+        schur_[i * num_sep + separator_id_[col]] += values_[k];
+        continue;
+      }
+      for (int j = 0; j < num_sep; ++j)
+        schur_[i * num_sep + j] -=
+            values_[k] * separator_columns_[static_cast<std::size_t>(j) * num_rows + col];
+    }
+  }
+
+  // LU factorization with partial pivoting
+  for (int i = 0; i < num_sep; ++i) schur_perm_[i] = i;
+  for (int k = 0; k < num_sep; ++k)
+  {
+    int pivot_row = k;
+    for (int i = k + 1; i < num_sep; ++i)
+      if (std::abs(schur_[i * num_sep + k]) > std::abs(schur_[pivot_row * num_sep + k]))
+        pivot_row = i;
+    if (schur_[pivot_row * num_sep + k] == 0.0) return false;
+
+    if (pivot_row != k)
+    {
+      for (int j = 0; j < num_sep; ++j)
+        std::swap(schur_[k * num_sep + j], schur_[pivot_row * num_sep + j]);
+      std::swap(schur_perm_[k], schur_perm_[pivot_row]);
+    }
+
+    for (int i = k + 1; i < num_sep; ++i)
+    {
+      schur_[i * num_sep + k] /= schur_[k * num_sep + k];
+      for (int j = k + 1; j < num_sep; ++j)
+        schur_[i * num_sep + j] -= schur_[i * num_sep + k] * schur_[k * num_sep + j];
+    }
+  }
+
+  return true;
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Airway::TreeSolver::solve(std::vector<double>& rhs) const
+{
+  const int num_rows = static_cast<int>(row_ptr_.size()) - 1;
+  if (static_cast<int>(rhs.size()) != num_rows)
+    FOUR_C_THROW("Right hand side of size %d does not match %d unknowns",
+        static_cast<int>(rhs.size()), num_rows);
+
+  // separator right hand sides have to be saved before the forest solution overwrites rhs
+  const int num_sep = num_separators();
+  std::vector<double> separator_rhs(num_sep);
+  for (int i = 0; i < num_sep; ++i) separator_rhs[i] = rhs[separators_[i]];
+
+  solve_forest(rhs);
+  if (num_sep == 0) return;
+
+  // reduced right hand side of the Schur complement
+  for (int i = 0; i < num_sep; ++i)
+  {
+    const int row = separators_[i];
+    for (int k = row_ptr_[row]; k < row_ptr_[row + 1]; ++k)
+      if (separator_id_[cols_[k]] < 0) separator_rhs[i] -= values_[k] * rhs[cols_[k]];
+  }
+
+  // forward and backward substitution with the LU factors of the Schur complement
+  std::vector<double> separator_solution(num_sep);
+  for (int i = 0; i < num_sep; ++i)
+  {
+    separator_solution[i] = separator_rhs[schur_perm_[i]];
+    for (int j = 0; j < i; ++j)
+      separator_solution[i] -= schur_[i * num_sep + j] * separator_solution[j];
+  }
+  for (int i = num_sep - 1; i >= 0; --i)
+  {
+    for (int j = i + 1; j < num_sep; ++j)
+      separator_solution[i] -= schur_[i * num_sep + j] * separator_solution[j];
+    separator_solution[i] /= schur_[i * num_sep + i];
+  }
+
+  // correct the forest solution by the separator contributions
+  for (int sep = 0; sep < num_sep; ++sep)
+  {
+    const double* column = &separator_columns_[static_cast<std::size_t>(sep) * num_rows];
+    for (const int row : order_) rhs[row] -= column[row] * separator_solution[sep];
+    rhs[separators_[sep]] = separator_solution[sep];
+  }
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Airway::TreeSolver::solve_forest(std::vector<double>& x) const
+{
+  // elimination from the leaves towards the roots
+  for (auto it = order_.rbegin(); it != order_.rend(); ++it)
+    if (parent_[*it] >= 0) x[parent_[*it]] -= factor_[*it] * x[*it];
+
+  // back-substitution from the roots towards the leaves
+  for (const int row : order_)
+  {
+    if (parent_[row] >= 0) x[row] -= value_at(values_, to_parent_pos_[row]) * x[parent_[row]];
+    x[row] /= pivot_[row];
+  }
+}
+
+FOUR_C_NAMESPACE_CLOSE
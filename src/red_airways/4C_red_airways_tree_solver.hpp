@@ -0,0 +1,162 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_RED_AIRWAYS_TREE_SOLVER_HPP
+#define FOUR_C_RED_AIRWAYS_TREE_SOLVER_HPP
+
+#include "4C_config.hpp"
+
+#include <Epetra_Import.h>
+#include <Epetra_Map.h>
+
+#include <memory>
+#include <vector>
+
+class Epetra_CrsMatrix;
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Core::LinAlg
+{
+  class SparseMatrix;
+  template <typename T>
+  class Vector;
+}  // namespace Core::LinAlg
+
+namespace Airway
+{
+  /*--------------------------------------------------------------------*/
+  /*!
+  \brief Direct solver for linear systems whose matrix graph is a tree
+
+  The reduced dimensional airway network is topologically a tree. Its system matrix can therefore
+  be factorized in linear time by eliminating the unknowns from the leaves towards the root and
+  solving by back-substitution from the root towards the leaves, without any fill-in.
+
+  Couplings that close loops in the matrix graph (e.g. inter-acinar dependencies) are handled by
+  a Schur complement: one end of every such coupling becomes a separator unknown, the remaining
+  forest is eliminated as above and the small dense Schur complement of the separators is
+  factorized with partial pivoting.
+
+  The symbolic analysis (elimination order, separators) is computed once and reused as long as
+  the sparsity pattern does not change.
+
+  This is a sequential solver: in parallel, the matrix and the right hand side are gathered on
+  the first rank, the tree is solved there and the solution is distributed again. Memory and
+  communication are hence linear in the global number of unknowns, but the elimination does not
+  scale with the number of ranks. The solver is therefore restricted to systems with at most
+  max_size unknowns.
+
+  The elimination does not pivot within the tree. If a vanishing pivot is encountered, the graph
+  contains more than the admissible number of separators or the system is too large, the solver
+  reports failure and the caller has to fall back to a general linear solver.
+  */
+  class TreeSolver
+  {
+   public:
+    /// constructor
+    explicit TreeSolver(const int max_num_separators = 64, const int max_size = 100000);
+
+    /// solve A x = b, returns false if the system is not suited for a tree solver
+    bool solve(const Core::LinAlg::SparseMatrix& A, Core::LinAlg::Vector<double>& x,
+        const Core::LinAlg::Vector<double>& b);
+
+    //! @name sequential interface on a matrix in compressed row storage (local indices)
+    //@{
+
+    /// symbolic analysis of the sparsity pattern, returns false if there are too many separators
+    bool setup(const std::vector<int>& row_ptr, const std::vector<int>& cols);
+
+    /// numeric factorization, returns false in case of a vanishing pivot
+    bool factorize(const std::vector<double>& values);
+
+    /// solve with the factorized matrix, the right hand side is overwritten by the solution
+    void solve(std::vector<double>& rhs) const;
+
+    //@}
+
+    /// number of separator unknowns of the Schur complement
+    int num_separators() const { return static_cast<int>(separators_.size()); }
+
+    /// true if the symbolic analysis was successful
+    bool is_setup() const { return is_setup_; }
+
+   private:
+    /// eliminate and back-substitute the forest without the separators in place
+    void solve_forest(std::vector<double>& x) const;
+
+    /// extract the matrix in compressed row storage, returns true if the pattern changed
+    bool extract_system(const Epetra_CrsMatrix& A);
+
+    /// maximal number of separators before giving up
+    const int max_num_separators_;
+
+    /// maximal global number of unknowns
+    const int max_size_;
+
+    /// flag whether the symbolic analysis was successful
+    bool is_setup_ = false;
+
+    //! @name sparsity pattern of the system
+    //@{
+    std::vector<int> row_ptr_;
+    std::vector<int> cols_;
+    std::vector<double> values_;
+    //@}
+
+    //! @name symbolic analysis
+    //@{
+
+    /// forest unknowns in breadth-first order (parents before their children)
+    std::vector<int> order_;
+
+    /// parent of each unknown in the forest (-1 for roots and separators)
+    std::vector<int> parent_;
+
+    /// position of the diagonal entry of each row (-1 if structurally zero)
+    std::vector<int> diag_pos_;
+
+    /// positions of the entries (i, parent(i)) and (parent(i), i) (-1 if structurally zero)
+    std::vector<int> to_parent_pos_;
+    std::vector<int> from_parent_pos_;
+
+    /// separator unknowns and the index of each unknown among them (-1 if not a separator)
+    std::vector<int> separators_;
+    std::vector<int> separator_id_;
+
+    //@}
+
+    //! @name numeric factorization
+    //@{
+
+    /// eliminated pivots of the forest
+    std::vector<double> pivot_;
+
+    /// elimination factors a(parent(i), i) / pivot(i)
+    std::vector<double> factor_;
+
+    /// forest solutions for the separator columns, one column after the other
+    std::vector<double> separator_columns_;
+
+    /// LU factorization of the Schur complement (row major) and its row permutation
+    std::vector<double> schur_;
+    std::vector<int> schur_perm_;
+
+    //@}
+
+    //! @name communication for the solution on the first rank in parallel
+    //@{
+    std::shared_ptr<Epetra_Map> root_map_;
+    std::shared_ptr<Epetra_Import> importer_;
+    std::shared_ptr<Epetra_Map> source_map_;
+    //@}
+  };
+}  // namespace Airway
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
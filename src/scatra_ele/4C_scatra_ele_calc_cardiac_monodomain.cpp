@@ -136,13 +136,22 @@ void Discret::Elements::ScaTraEleCalcCardiacMonodomain<distype, probdim>::mat_my
   }
   else
   {
-    // get membrane potential at n+1 or n+alpha_F at integration point
-    const double phinp = my::scatravarmanager_->phinp(k);
-    // get reaction coefficient
-    advreamanager->add_to_rea_body_force(
-        -actmat->rea_coeff(phinp, my::scatraparatimint_->dt(), iquad), k);
-    advreamanager->add_to_rea_body_force_deriv_matrix(
-        -actmat->rea_coeff_deriv(phinp, my::scatraparatimint_->dt(), iquad), k, k);
+    if (iquad >= 0 and iquad < static_cast<int>(batch_rea_coeff_.size()))
+    {
+      // reaction coefficient has already been evaluated for all integration points at once
+      advreamanager->add_to_rea_body_force(-batch_rea_coeff_[iquad], k);
+      advreamanager->add_to_rea_body_force_deriv_matrix(-batch_rea_coeff_deriv_[iquad], k, k);
+    }
+    else
+    {
+      // get membrane potential at n+1 or n+alpha_F at integration point
+      const double phinp = my::scatravarmanager_->phinp(k);
+      // get reaction coefficient
+      advreamanager->add_to_rea_body_force(
+          -actmat->rea_coeff(phinp, my::scatraparatimint_->dt(), iquad), k);
+      advreamanager->add_to_rea_body_force_deriv_matrix(
+          -actmat->rea_coeff_deriv(phinp, my::scatraparatimint_->dt(), iquad), k, k);
+    }
   }
 
   return;
@@ -189,10 +198,15 @@ void Discret::Elements::ScaTraEleCalcCardiacMonodomain<distype, probdim>::sysmat
     const Core::FE::IntPointsAndWeights<nsd_ele_> intpoints(
         ScaTra::DisTypeToMatGaussRule<distype>::get_gauss_rule(deg));
 
+    // evaluate the ionic model for all integration points in one pass
+    const bool batched = evaluate_rea_coeff_batch(ele, intpoints);
+
     // loop over integration points
     for (int iquad = 0; iquad < intpoints.ip().nquad; ++iquad)
     {
-      const double fac = my::eval_shape_func_and_derivs_at_int_point(intpoints, iquad);
+      // the batched evaluation already computed the shape functions at all integration points
+      const double fac = batched ? restore_shape_func_at_gp(intpoints, iquad)
+                                 : my::eval_shape_func_and_derivs_at_int_point(intpoints, iquad);
 
       // set gauss point variables needed for evaluation of mat and rhs
       my::set_internal_variables_for_mat_and_rhs();
@@ -219,6 +233,9 @@ void Discret::Elements::ScaTraEleCalcCardiacMonodomain<distype, probdim>::sysmat
         advreac::calc_mat_react(emat, k, timefacfac, 0., 0., densnp[k], dummy, dummy);
       }
     }
+
+    batch_rea_coeff_.clear();
+    batch_rea_coeff_deriv_.clear();
   }
 
   //----------------------------------------------------------------------
@@ -302,6 +319,67 @@ void Discret::Elements::ScaTraEleCalcCardiacMonodomain<distype, probdim>::sysmat
 }
 
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+template <Core::FE::CellType distype, int probdim>
+bool Discret::Elements::ScaTraEleCalcCardiacMonodomain<distype, probdim>::evaluate_rea_coeff_batch(
+    Core::Elements::Element* ele, const Core::FE::IntPointsAndWeights<nsd_ele_>& intpoints)
+{
+  batch_rea_coeff_.clear();
+  batch_rea_coeff_deriv_.clear();
+
+  // the semi-implicit scheme evaluates the model at two different time levels per point
+  if (my::scatrapara_->semi_implicit() or my::numscal_ != 1) return false;
+
+  std::shared_ptr<Mat::Myocard> actmat = std::dynamic_pointer_cast<Mat::Myocard>(ele->material());
+  if (actmat == nullptr or actmat->get_number_of_gp() != intpoints.ip().nquad) return false;
+
+  // membrane potential at all integration points, the shape functions are kept for the
+  // subsequent integration loop
+  const int nquad = intpoints.ip().nquad;
+  batch_phinp_.resize(nquad);
+  batch_fac_.resize(nquad);
+  batch_funct_.resize(nquad);
+  batch_derxy_.resize(nquad);
+  if (my::use2ndderiv_) batch_derxy2_.resize(nquad);
+  for (int iquad = 0; iquad < nquad; ++iquad)
+  {
+    batch_fac_[iquad] = my::eval_shape_func_and_derivs_at_int_point(intpoints, iquad);
+    batch_funct_[iquad] = my::funct_;
+    batch_derxy_[iquad] = my::derxy_;
+    if (my::use2ndderiv_) batch_derxy2_[iquad] = my::derxy2_;
+
+    batch_phinp_[iquad] = my::funct_.dot(my::ephinp_[0]);
+  }
+
+  actmat->rea_coeff_batch(
+      batch_phinp_, my::scatraparatimint_->dt(), batch_rea_coeff_, batch_rea_coeff_deriv_);
+
+  return true;
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+template <Core::FE::CellType distype, int probdim>
+double
+Discret::Elements::ScaTraEleCalcCardiacMonodomain<distype, probdim>::restore_shape_func_at_gp(
+    const Core::FE::IntPointsAndWeights<nsd_ele_>& intpoints, const int iquad)
+{
+  const double* gpcoord = (intpoints.ip().qxg)[iquad];
+  for (unsigned idim = 0; idim < nsd_ele_; idim++) my::xsi_(idim) = gpcoord[idim];
+
+  my::funct_ = batch_funct_[iquad];
+  my::derxy_ = batch_derxy_[iquad];
+  if (my::use2ndderiv_)
+    my::derxy2_ = batch_derxy2_[iquad];
+  else
+    my::derxy2_.clear();
+
+  return batch_fac_[iquad];
+}
+
+
 /*----------------------------------------------------------------------*
  | extract element based or nodal values                 hoermann 06/16 |
  *----------------------------------------------------------------------*/
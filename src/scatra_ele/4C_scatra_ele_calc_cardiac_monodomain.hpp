@@ -91,6 +91,33 @@ namespace Discret
           Core::LinAlg::SerialDenseVector& erhs,      ///< element rhs to calculate
           Core::LinAlg::SerialDenseVector& subgrdiff  ///< subgrid-diff.-scaling vector
           ) override;
+
+      //! evaluate the ionic model at all material integration points of the element in one pass,
+      //! returns false if the material has to be evaluated point by point
+      bool evaluate_rea_coeff_batch(
+          Core::Elements::Element* ele, const Core::FE::IntPointsAndWeights<nsd_ele_>& intpoints);
+
+      //! set the shape functions and their derivatives at integration point iquad from the
+      //! values stored during the batched evaluation and return the integration factor
+      double restore_shape_func_at_gp(
+          const Core::FE::IntPointsAndWeights<nsd_ele_>& intpoints, const int iquad);
+
+      //! membrane potential at the material integration points
+      std::vector<double> batch_phinp_;
+
+      //! integration factors at the material integration points
+      std::vector<double> batch_fac_;
+
+      //! shape functions and their derivatives at the material integration points
+      std::vector<Core::LinAlg::Matrix<nen_, 1>> batch_funct_;
+      std::vector<Core::LinAlg::Matrix<nsd_, nen_>> batch_derxy_;
+      std::vector<Core::LinAlg::Matrix<my::numderiv2_, nen_>> batch_derxy2_;
+
+      //! reaction coefficients at the material integration points evaluated in one pass
+      std::vector<double> batch_rea_coeff_;
+
+      //! reaction coefficient derivatives at the material integration points
+      std::vector<double> batch_rea_coeff_deriv_;
     };
 
   }  // namespace Elements
@@ -87,6 +87,7 @@ void Discret::Elements::Shell7pType::setup_element_definition(
                              .add_named_string_vector("EAS", 5)
                              .add_named_double("SDC")
                              .add_optional_tag("ANS")
+                             .add_optional_tag("CACHE_GEOMETRY")
                              .add_optional_named_double_vector("RAD", 3)
                              .add_optional_named_double_vector("AXI", 3)
                              .add_optional_named_double_vector("CIR", 3)
@@ -102,6 +103,7 @@ void Discret::Elements::Shell7pType::setup_element_definition(
                              .add_named_string_vector("EAS", 5)
                              .add_named_double("SDC")
                              .add_optional_tag("ANS")
+                             .add_optional_tag("CACHE_GEOMETRY")
                              .add_optional_named_double_vector("RAD", 3)
                              .add_optional_named_double_vector("AXI", 3)
                              .add_optional_named_double_vector("CIR", 3)
@@ -117,6 +119,7 @@ void Discret::Elements::Shell7pType::setup_element_definition(
                              .add_named_string_vector("EAS", 5)
                              .add_named_double("SDC")
                              .add_optional_tag("ANS")
+                             .add_optional_tag("CACHE_GEOMETRY")
                              .add_optional_named_double_vector("RAD", 3)
                              .add_optional_named_double_vector("AXI", 3)
                              .add_optional_named_double_vector("CIR", 3)
@@ -130,6 +133,7 @@ void Discret::Elements::Shell7pType::setup_element_definition(
                             .add_named_int("MAT")
                             .add_named_double("THICK")
                             .add_named_double("SDC")
+                            .add_optional_tag("CACHE_GEOMETRY")
                             .add_optional_named_double_vector("RAD", 3)
                             .add_optional_named_double_vector("AXI", 3)
                             .add_optional_named_double_vector("CIR", 3)
@@ -143,6 +147,7 @@ void Discret::Elements::Shell7pType::setup_element_definition(
                             .add_named_int("MAT")
                             .add_named_double("THICK")
                             .add_named_double("SDC")
+                            .add_optional_tag("CACHE_GEOMETRY")
                             .add_optional_named_double_vector("RAD", 3)
                             .add_optional_named_double_vector("AXI", 3)
                             .add_optional_named_double_vector("CIR", 3)
@@ -349,6 +354,9 @@ bool Discret::Elements::Shell7p::read_element(const std::string& eletype,
   // read SDC
   shell_data.sdc = container.get<double>("SDC");
 
+  // store the reference geometry at the integration points
+  shell_data.cache_reference_geometry = container.get<bool>("CACHE_GEOMETRY");
+
   // read and set number of material model
   set_material(
       0, Mat::factory(Solid::Utils::Shell::ReadElement::read_and_set_element_material(container)));
@@ -54,6 +54,7 @@ void Discret::Elements::Shell7pEleCalc<distype>::pack(Core::Communication::PackB
   add_to_pack(data, shell_data_.sdc);
   add_to_pack(data, shell_data_.thickness);
   add_to_pack(data, shell_data_.num_ans);
+  add_to_pack(data, shell_data_.cache_reference_geometry);
   add_to_pack(data, cur_thickness_);
 }
 
@@ -63,7 +64,11 @@ void Discret::Elements::Shell7pEleCalc<distype>::unpack(Core::Communication::Unp
   extract_from_pack(buffer, shell_data_.sdc);
   extract_from_pack(buffer, shell_data_.thickness);
   extract_from_pack(buffer, shell_data_.num_ans);
+  extract_from_pack(buffer, shell_data_.cache_reference_geometry);
   extract_from_pack(buffer, cur_thickness_);
+
+  // the reference geometry is not communicated but evaluated again on first access
+  reference_geometry_.reset();
 }
 
 
@@ -330,23 +335,25 @@ void Discret::Elements::Shell7pEleCalc<distype>::evaluate_nonlinear_force_stiffn
   Shell::NodalCoordinates<distype> nodal_coordinates = Shell::evaluate_nodal_coordinates<distype>(
       ele.nodes(), displacement, shell_data_.thickness, nodal_directors, condfac);
 
+  // reference geometry at the integration points, which is kept between evaluations only if
+  // requested for the element
+  const Shell::ReferenceGeometry<distype>& reference_geometry =
+      get_reference_geometry(nodal_coordinates);
+
   // Assumed Natural Strains (ANS) Technology to remedy transverse shear strain locking
   // for a_13 and a_23 each
   const int total_ansq = 2 * shell_data_.num_ans;
-  std::vector<Shell::ShapefunctionsAndDerivatives<distype>> shapefunctions_collocation(total_ansq);
-  std::vector<Shell::BasisVectorsAndMetrics<distype>> metrics_collocation_reference(total_ansq);
+  const std::vector<Shell::ShapefunctionsAndDerivatives<distype>>& shapefunctions_collocation =
+      reference_geometry.shapefunctions_collocation_;
+  const std::vector<Shell::BasisVectorsAndMetrics<distype>>& metrics_collocation_reference =
+      reference_geometry.metrics_collocation_reference_;
   std::vector<Shell::BasisVectorsAndMetrics<distype>> metrics_collocation_current(total_ansq);
-
-  if (shell_data_.num_ans > 0)
+  for (int qp = 0; qp < total_ansq; ++qp)
   {
-    Shell::setup_ans(shapefunctions_collocation, metrics_collocation_reference,
-        metrics_collocation_current, nodal_coordinates, total_ansq);
+    Shell::evaluate_current_metrics(
+        shapefunctions_collocation[qp], metrics_collocation_current[qp], nodal_coordinates, 0.0);
   }
 
-  // init metric tensor and basis vectors of element mid-surface
-  Shell::BasisVectorsAndMetrics<distype> a_reference;
-  Shell::BasisVectorsAndMetrics<distype> a_current;
-
   // init metric tensor and basis vectors of element shell body
   Shell::BasisVectorsAndMetrics<distype> g_reference;
   Shell::BasisVectorsAndMetrics<distype> g_current;
@@ -357,11 +364,15 @@ void Discret::Elements::Shell7pEleCalc<distype>::evaluate_nonlinear_force_stiffn
   Shell::StressEnhanced stress_enh;
 
   Shell::for_each_gauss_point<distype>(nodal_coordinates, intpoints_midsurface_,
-      [&](const std::array<double, 2>& xi_gp,
-          const Shell::ShapefunctionsAndDerivatives<distype>& shape_functions,
-          Shell::BasisVectorsAndMetrics<distype>& a_current,
-          Shell::BasisVectorsAndMetrics<distype>& a_reference, double gpweight, double da, int gp)
+      intpoints_thickness_, condfac, shell_data_.num_ans, reference_geometry,
+      [&](const Shell::ReferenceGeometryAtGaussPoint<distype>& reference_gp,
+          Shell::BasisVectorsAndMetrics<distype>& a_current, double gpweight, int gp)
       {
+        const Shell::ShapefunctionsAndDerivatives<distype>& shape_functions =
+            reference_gp.shape_functions_;
+        const std::vector<double>& shape_functions_ans = reference_gp.shape_functions_ans_;
+        const Shell::BasisVectorsAndMetrics<distype>& a_reference = reference_gp.a_reference_;
+        const double da = reference_gp.da_;
         double integration_factor = gpweight * da;
 
         // update current thickness at gauss point
@@ -379,9 +390,6 @@ void Discret::Elements::Shell7pEleCalc<distype>::evaluate_nonlinear_force_stiffn
         Core::LinAlg::SerialDenseMatrix Bop = Shell::calc_b_operator<distype>(
             a_current.kovariant_, a_current.partial_derivative_, shape_functions);
 
-        const std::vector<double> shape_functions_ans =
-            Shell::get_shapefunctions_for_ans<distype>(xi_gp, shell_data_.num_ans);
-
         // modifications due to ANS with B-bar method (Hughes (1980))
         std::invoke(
             [&]()
@@ -400,7 +408,8 @@ void Discret::Elements::Shell7pEleCalc<distype>::evaluate_nonlinear_force_stiffn
           zeta = intpoints_thickness_.qxg[gpt][0] / condfac;
           double factor = intpoints_thickness_.qwgt[gpt];
 
-          Shell::evaluate_metrics(shape_functions, g_reference, g_current, nodal_coordinates, zeta);
+          g_reference = reference_gp.g_reference_[gpt];
+          Shell::evaluate_current_metrics(shape_functions, g_current, nodal_coordinates, zeta);
 
           // modify the current kovariant metric tensor to neglect the quadratic terms in thickness
           // directions
@@ -480,9 +489,25 @@ void Discret::Elements::Shell7pEleCalc<distype>::evaluate_nonlinear_force_stiffn
               shape_functions, mass_matrix_variables, shell_data_.thickness, *mass_matrix);
         }
       });
+
+  if (!shell_data_.cache_reference_geometry) reference_geometry_.reset();
 }
 
 
+template <Core::FE::CellType distype>
+const Discret::Elements::Shell::ReferenceGeometry<distype>&
+Discret::Elements::Shell7pEleCalc<distype>::get_reference_geometry(
+    const Shell::NodalCoordinates<distype>& nodal_coordinates)
+{
+  if (!reference_geometry_)
+  {
+    reference_geometry_ = Shell::evaluate_reference_geometry<distype>(nodal_coordinates,
+        intpoints_midsurface_, intpoints_thickness_, shell_data_.sdc, shell_data_.num_ans,
+        shell_data_.cache_reference_geometry);
+  }
+  return *reference_geometry_;
+}
+
 template <Core::FE::CellType distype>
 void Discret::Elements::Shell7pEleCalc<distype>::recover(Core::Elements::Element& ele,
     const Core::FE::Discretization& discretization, const std::vector<int>& dof_index_array,
@@ -19,6 +19,7 @@
 #include "4C_shell7p_ele_interface_serializable.hpp"
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 
@@ -86,6 +87,19 @@ namespace Discret
       void vis_data(const std::string& name, std::vector<double>& data) override;
 
      private:
+      /*!
+       * @brief Returns the reference geometry at the integration points
+       *
+       * The reference geometry is evaluated on first access. Unless
+       * ShellData::cache_reference_geometry is set, only the ANS collocation points are evaluated,
+       * the integration points are evaluated in place during the evaluation and the reference
+       * geometry is dropped afterwards.
+       *
+       * @param nodal_coordinates (in) : Nodal coordinates in reference and current frame
+       */
+      const Shell::ReferenceGeometry<distype>& get_reference_geometry(
+          const Shell::NodalCoordinates<distype>& nodal_coordinates);
+
       //! number of integration points in thickness direction (note: currently they are fixed to 2,
       //! otherwise the element would suffer from nonlinear poisson stiffening)
       const Core::FE::IntegrationPoints1D intpoints_thickness_ =
@@ -100,6 +114,10 @@ namespace Discret
       //! shell thickness at gauss point in spatial frame
       std::vector<double> cur_thickness_;
 
+      //! reference geometry at the integration points (kept between evaluations only if
+      //! ShellData::cache_reference_geometry is set)
+      std::optional<Shell::ReferenceGeometry<distype>> reference_geometry_;
+
     };  // class Shell7pEleCalc
   }  // namespace Elements
 }  // namespace Discret
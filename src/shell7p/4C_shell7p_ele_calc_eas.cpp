@@ -134,6 +134,7 @@ void Discret::Elements::Shell7pEleCalcEas<distype>::pack(
   add_to_pack(data, shell_data_.sdc);
   add_to_pack(data, shell_data_.thickness);
   add_to_pack(data, shell_data_.num_ans);
+  add_to_pack(data, shell_data_.cache_reference_geometry);
 
   add_to_pack(data, eas_iteration_data_.alpha_);
   add_to_pack(data, eas_iteration_data_.RTilde_);
@@ -159,6 +160,7 @@ void Discret::Elements::Shell7pEleCalcEas<distype>::unpack(
   extract_from_pack(buffer, shell_data_.sdc);
   extract_from_pack(buffer, shell_data_.thickness);
   extract_from_pack(buffer, shell_data_.num_ans);
+  extract_from_pack(buffer, shell_data_.cache_reference_geometry);
 
   extract_from_pack(buffer, eas_iteration_data_.alpha_);
   extract_from_pack(buffer, eas_iteration_data_.RTilde_);
@@ -174,6 +176,10 @@ void Discret::Elements::Shell7pEleCalcEas<distype>::unpack(
 
   extract_from_pack(buffer, old_step_length_);
   extract_from_pack(buffer, cur_thickness_);
+
+  // the reference geometry is not communicated but evaluated again on first access
+  reference_geometry_.reset();
+  eas_shape_functions_.clear();
 }
 
 template <Core::FE::CellType distype>
@@ -513,33 +519,25 @@ void Discret::Elements::Shell7pEleCalcEas<distype>::evaluate_nonlinear_force_sti
   eas_iteration_data_.transL_.shape(
       locking_types_.total, Shell::Internal::numdofperelement<distype>);
 
+  // reference geometry at the integration points, which is kept between evaluations only if
+  // requested for the element
+  const Shell::ReferenceGeometry<distype>& reference_geometry =
+      get_reference_geometry(nodal_coordinates);
+
   // Assumed Natural Strains (ANS) Technology to remedy transverse shear strain locking
   // for a_13 and a_23 each
   const int total_ansq = 2 * shell_data_.num_ans;
-  std::vector<Shell::ShapefunctionsAndDerivatives<distype>> shapefunctions_collocation(total_ansq);
-  std::vector<Shell::BasisVectorsAndMetrics<distype>> metrics_collocation_reference(total_ansq);
+  const std::vector<Shell::ShapefunctionsAndDerivatives<distype>>& shapefunctions_collocation =
+      reference_geometry.shapefunctions_collocation_;
+  const std::vector<Shell::BasisVectorsAndMetrics<distype>>& metrics_collocation_reference =
+      reference_geometry.metrics_collocation_reference_;
   std::vector<Shell::BasisVectorsAndMetrics<distype>> metrics_collocation_current(total_ansq);
-
-  if (shell_data_.num_ans > 0)
+  for (int qp = 0; qp < total_ansq; ++qp)
   {
-    Shell::setup_ans(shapefunctions_collocation, metrics_collocation_reference,
-        metrics_collocation_current, nodal_coordinates, total_ansq);
+    Shell::evaluate_current_metrics(
+        shapefunctions_collocation[qp], metrics_collocation_current[qp], nodal_coordinates, 0.0);
   }
 
-  // metric of element at centroid point (for EAS)
-  const std::array<double, 2> centroid_point = {0.0, 0.0};
-  Shell::ShapefunctionsAndDerivatives<distype> shapefunctions_centroid =
-      Shell::evaluate_shapefunctions_and_derivs<distype>(centroid_point);
-  Shell::BasisVectorsAndMetrics<distype> metrics_centroid_reference;
-  Shell::BasisVectorsAndMetrics<distype> metrics_centroid_current;
-
-  Shell::evaluate_metrics(shapefunctions_centroid, metrics_centroid_reference,
-      metrics_centroid_current, nodal_coordinates, 0.0);
-
-  // init metric tensor and basis vectors of element mid-surface
-  Shell::BasisVectorsAndMetrics<distype> a_reference;
-  Shell::BasisVectorsAndMetrics<distype> a_current;
-
   // init metric tensor and basis vectors of element shell body
   Shell::BasisVectorsAndMetrics<distype> g_reference;
   Shell::BasisVectorsAndMetrics<distype> g_current;
@@ -549,15 +547,19 @@ void Discret::Elements::Shell7pEleCalcEas<distype>::evaluate_nonlinear_force_sti
   Core::LinAlg::SerialDenseVector strain_enh(num_internal_variables);
   Shell::StressEnhanced stress_enh;
 
-  // init EAS shape function matrix
-  Core::LinAlg::SerialDenseMatrix M(num_internal_variables, locking_types_.total);
+  // EAS shape function matrix at the current integration point if they are not stored
+  Core::LinAlg::SerialDenseMatrix M_gp(num_internal_variables, locking_types_.total);
 
   Shell::for_each_gauss_point<distype>(nodal_coordinates, intpoints_midsurface_,
-      [&](const std::array<double, 2>& xi_gp,
-          const Shell::ShapefunctionsAndDerivatives<distype>& shape_functions,
-          Shell::BasisVectorsAndMetrics<distype>& a_current,
-          Shell::BasisVectorsAndMetrics<distype>& a_reference, double gpweight, double da, int gp)
+      intpoints_thickness_, condfac, shell_data_.num_ans, reference_geometry,
+      [&](const Shell::ReferenceGeometryAtGaussPoint<distype>& reference_gp,
+          Shell::BasisVectorsAndMetrics<distype>& a_current, double gpweight, int gp)
       {
+        const Shell::ShapefunctionsAndDerivatives<distype>& shape_functions =
+            reference_gp.shape_functions_;
+        const std::vector<double>& shape_functions_ans = reference_gp.shape_functions_ans_;
+        const Shell::BasisVectorsAndMetrics<distype>& a_reference = reference_gp.a_reference_;
+        const double da = reference_gp.da_;
         double integration_factor = gpweight * da;
 
         // update current thickness at gauss point
@@ -571,18 +573,20 @@ void Discret::Elements::Shell7pEleCalcEas<distype>::evaluate_nonlinear_force_sti
         // init mass matrix variables
         Shell::MassMatrixVariables mass_matrix_variables;
 
-        //  evaluate shape functions for incompatible strains
-        M = Shell::EAS::evaluate_eas_shape_functions(
-            xi_gp, locking_types_, a_reference, metrics_centroid_reference);
+        // shape functions for incompatible strains
+        if (eas_shape_functions_.empty())
+        {
+          M_gp = Shell::EAS::evaluate_eas_shape_functions(
+              reference_gp.xi_, locking_types_, a_reference, metrics_centroid_reference_);
+        }
+        const Core::LinAlg::SerialDenseMatrix& M =
+            eas_shape_functions_.empty() ? M_gp : eas_shape_functions_[gp];
         Shell::EAS::evaluate_eas_strains(strain_enh, eas_iteration_data_.alpha_, M);
 
         // calculate B-operator for compatible strains (displacement)
         Core::LinAlg::SerialDenseMatrix Bop = Shell::calc_b_operator<distype>(
             a_current.kovariant_, a_current.partial_derivative_, shape_functions);
 
-        const std::vector<double> shape_functions_ans =
-            Shell::get_shapefunctions_for_ans<distype>(xi_gp, shell_data_.num_ans);
-
         std::invoke(
             [&]()
             {
@@ -601,7 +605,8 @@ void Discret::Elements::Shell7pEleCalcEas<distype>::evaluate_nonlinear_force_sti
           double factor = intpoints_thickness_.qwgt[gpt];
 
           // evaluate metric tensor at gp in shell body
-          Shell::evaluate_metrics(shape_functions, g_reference, g_current, nodal_coordinates, zeta);
+          g_reference = reference_gp.g_reference_[gpt];
+          Shell::evaluate_current_metrics(shape_functions, g_current, nodal_coordinates, zeta);
 
           Shell::modify_kovariant_metrics(g_reference, g_current, a_reference, a_current, zeta,
               shape_functions_ans, metrics_collocation_reference, metrics_collocation_current,
@@ -677,6 +682,12 @@ void Discret::Elements::Shell7pEleCalcEas<distype>::evaluate_nonlinear_force_sti
         }
       });
 
+  if (!shell_data_.cache_reference_geometry)
+  {
+    reference_geometry_.reset();
+    eas_shape_functions_.clear();
+  }
+
   // compute inverse of DTilde = invDTilde
   Core::LinAlg::symmetric_inverse(eas_iteration_data_.invDTilde_, locking_types_.total);
 
@@ -713,6 +724,37 @@ void Discret::Elements::Shell7pEleCalcEas<distype>::evaluate_nonlinear_force_sti
 
 
 
+template <Core::FE::CellType distype>
+const Discret::Elements::Shell::ReferenceGeometry<distype>&
+Discret::Elements::Shell7pEleCalcEas<distype>::get_reference_geometry(
+    const Shell::NodalCoordinates<distype>& nodal_coordinates)
+{
+  if (!reference_geometry_)
+  {
+    reference_geometry_ = Shell::evaluate_reference_geometry<distype>(nodal_coordinates,
+        intpoints_midsurface_, intpoints_thickness_, shell_data_.sdc, shell_data_.num_ans,
+        shell_data_.cache_reference_geometry);
+
+    // metric of element at centroid point (for EAS)
+    const std::array<double, 2> centroid_point = {0.0, 0.0};
+    Shell::ShapefunctionsAndDerivatives<distype> shapefunctions_centroid =
+        Shell::evaluate_shapefunctions_and_derivs<distype>(centroid_point);
+    Shell::evaluate_kovariant_vectors_and_metrics(shapefunctions_centroid,
+        metrics_centroid_reference_, nodal_coordinates.x_refe_, nodal_coordinates.a3_refe_, 0.0);
+    Shell::evaluate_kontravariant_vectors_and_metrics(metrics_centroid_reference_);
+
+    // the shape functions for incompatible strains only depend on the reference geometry
+    eas_shape_functions_.clear();
+    eas_shape_functions_.reserve(reference_geometry_->gauss_points_.size());
+    for (const auto& reference_gp : reference_geometry_->gauss_points_)
+    {
+      eas_shape_functions_.emplace_back(Shell::EAS::evaluate_eas_shape_functions(reference_gp.xi_,
+          locking_types_, reference_gp.a_reference_, metrics_centroid_reference_));
+    }
+  }
+  return *reference_geometry_;
+}
+
 template <Core::FE::CellType distype>
 void Discret::Elements::Shell7pEleCalcEas<distype>::recover(Core::Elements::Element& ele,
     const Core::FE::Discretization& discretization, const std::vector<int>& dof_index_array,
@@ -19,6 +19,7 @@
 #include "4C_shell7p_ele_interface_serializable.hpp"
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 
@@ -103,6 +104,19 @@ namespace Discret
       void vis_data(const std::string& name, std::vector<double>& data) override;
 
      private:
+      /*!
+       * @brief Returns the reference geometry and the EAS shape functions at the integration points
+       *
+       * The reference geometry is evaluated on first access. Unless
+       * ShellData::cache_reference_geometry is set, only the ANS collocation points are evaluated,
+       * the integration points are evaluated in place during the evaluation and the reference
+       * geometry is dropped afterwards.
+       *
+       * @param nodal_coordinates (in) : Nodal coordinates in reference and current frame
+       */
+      const Shell::ReferenceGeometry<distype>& get_reference_geometry(
+          const Shell::NodalCoordinates<distype>& nodal_coordinates);
+
       //! EAS matrices and vectors to be stored between iterations
       Discret::Elements::ShellEASIterationData eas_iteration_data_ = {};
 
@@ -126,6 +140,18 @@ namespace Discret
       //! shell thickness at gauss point in spatial frame
       std::vector<double> cur_thickness_;
 
+      //! reference geometry at the integration points (kept between evaluations only if
+      //! ShellData::cache_reference_geometry is set)
+      std::optional<Shell::ReferenceGeometry<distype>> reference_geometry_;
+
+      //! basis vectors and metric tensors of the mid-surface at the centroid in reference
+      //! configuration (evaluated along with the reference geometry)
+      Shell::BasisVectorsAndMetrics<distype> metrics_centroid_reference_;
+
+      //! EAS shape functions at the integration points (stored along with the reference geometry
+      //! at the integration points, empty otherwise)
+      std::vector<Core::LinAlg::SerialDenseMatrix> eas_shape_functions_;
+
     };  // class Shell7pEleCalcEas
   }  // namespace Elements
 }  // namespace Discret
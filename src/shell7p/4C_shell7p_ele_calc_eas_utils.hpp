@@ -695,7 +695,7 @@ namespace Discret::Elements::Shell::EAS
 
   // Evaluate enhanced EAS strains
   void evaluate_eas_strains(Core::LinAlg::SerialDenseVector& strain_enh,
-      const Core::LinAlg::SerialDenseMatrix& alpha, Core::LinAlg::SerialDenseMatrix& M)
+      const Core::LinAlg::SerialDenseMatrix& alpha, const Core::LinAlg::SerialDenseMatrix& M)
   {
     // evaluate enhanced strains = M * alpha to "unlock" element
     strain_enh.multiply(Teuchos::NO_TRANS, Teuchos::NO_TRANS, 1.0, M, alpha, 0.0);
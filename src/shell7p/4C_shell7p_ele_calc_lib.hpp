@@ -19,6 +19,7 @@
 #include "4C_shell7p_ele.hpp"
 #include "4C_utils_parameter_list.fwd.hpp"
 
+#include <array>
 #include <numeric>
 
 FOUR_C_NAMESPACE_OPEN
@@ -304,6 +305,60 @@ namespace Discret::Elements::Shell
     double detJ_;
   };
 
+  /*!
+   * @brief An object holding the geometry of the shell in reference configuration at one gaussian
+   * point of the mid-surface
+   *
+   * All quantities only depend on the reference configuration and the integration rule. Hence,
+   * they can be evaluated once and reused for all evaluations of the element.
+   *
+   * @tparam distype :  The discretization type known at compile time
+   */
+  template <Core::FE::CellType distype>
+  struct ReferenceGeometryAtGaussPoint
+  {
+    //! coordinate of the integration point in the parameter space
+    std::array<double, 2> xi_;
+
+    //! shape functions and derivatives at the integration point
+    ShapefunctionsAndDerivatives<distype> shape_functions_;
+
+    //! shape functions for ANS (empty without ANS)
+    std::vector<double> shape_functions_ans_;
+
+    //! basis vectors and metric tensors of the mid-surface
+    BasisVectorsAndMetrics<distype> a_reference_;
+
+    //! area of the mid-surface
+    double da_;
+
+    //! basis vectors and metric tensors of the shell body at each integration point in thickness
+    //! direction
+    std::array<BasisVectorsAndMetrics<distype>, Internal::num_thickness_points> g_reference_;
+  };
+
+  /*!
+   * @brief An object holding the geometry of the shell in reference configuration at all
+   * integration points and ANS collocation points of the element
+   *
+   * The integration points may be left empty. They are then evaluated in place while looping over
+   * the integration points, see for_each_gauss_point().
+   *
+   * @tparam distype :  The discretization type known at compile time
+   */
+  template <Core::FE::CellType distype>
+  struct ReferenceGeometry
+  {
+    //! shape functions and derivatives at the ANS collocation points
+    std::vector<ShapefunctionsAndDerivatives<distype>> shapefunctions_collocation_;
+
+    //! basis vectors and metric tensors of the mid-surface at the ANS collocation points
+    std::vector<BasisVectorsAndMetrics<distype>> metrics_collocation_reference_;
+
+    //! reference geometry at the integration points of the mid-surface (empty if not stored)
+    std::vector<ReferenceGeometryAtGaussPoint<distype>> gauss_points_;
+  };
+
   /*!
    * @brief Evaluates the strain gradient (B-Operator) of the specified element
    *
@@ -556,6 +611,30 @@ namespace Discret::Elements::Shell
     evaluate_kontravariant_vectors_and_metrics(basis_and_metrics_current);
   }
 
+  /*!
+   * @brief Evaluates the basis vectors and metric tensors of the element in current configuration
+   * only
+   *
+   * @tparam distype :  The discretization type known at compile time
+   * @param shape_functions(in) : Shape functions and derivatives evaluated at the respective point
+   * in the parameter space
+   * @param basis_and_metrics_current (in/out) : An object holding the basis vectors and metric
+   * tensors of the element in current configuration
+   * @param nodal_coordinates (in) : Coordinates of the nodes of the element
+   * @param zeta (in) : Thickness coordinate of gaussian point (scaled via SDC)
+   */
+  template <Core::FE::CellType distype>
+  void evaluate_current_metrics(
+      const Discret::Elements::Shell::ShapefunctionsAndDerivatives<distype>& shape_functions,
+      Discret::Elements::Shell::BasisVectorsAndMetrics<distype>& basis_and_metrics_current,
+      const Discret::Elements::Shell::NodalCoordinates<distype>& nodal_coordinates,
+      const double zeta)
+  {
+    evaluate_kovariant_vectors_and_metrics(shape_functions, basis_and_metrics_current,
+        nodal_coordinates.x_curr_, nodal_coordinates.a3_curr_, zeta);
+    evaluate_kontravariant_vectors_and_metrics(basis_and_metrics_current);
+  }
+
   /*!
    * @brief Evaluates the kovariant basis vectors and metric tensors of the element
    *
@@ -1002,12 +1081,12 @@ namespace Discret::Elements::Shell
    *
    * @tparam distype : The discretization type known at compile time
    * @params xi_gp (in) : Coordinate of the integration point in the parameter space
-   * @return shapefunctions for ANS
+   * @params shapefunctions (out) : shapefunctions for ANS
    */
   template <Core::FE::CellType distype>
-  static std::vector<double> set_shapefunctions_for_ans(const std::array<double, 2>& xi_gp)
+  static void set_shapefunctions_for_ans(
+      const std::array<double, 2>& xi_gp, std::vector<double>& shapefunctions)
   {
-    std::vector<double> shapefunctions;
     double r = xi_gp[0];
     double s = xi_gp[1];
 
@@ -1056,6 +1135,21 @@ namespace Discret::Elements::Shell
       shapefunctions[10] = ps[1] * qs[1];
       shapefunctions[11] = ps[2] * qs[1];
     }
+  }
+
+  /*!
+   * @brief Get the shapefunctions evaluated at the gaussian points to remedy transverse shear
+   * strains within the ANS method
+   *
+   * @tparam distype : The discretization type known at compile time
+   * @params xi_gp (in) : Coordinate of the integration point in the parameter space
+   * @return shapefunctions for ANS
+   */
+  template <Core::FE::CellType distype>
+  static std::vector<double> set_shapefunctions_for_ans(const std::array<double, 2>& xi_gp)
+  {
+    std::vector<double> shapefunctions;
+    set_shapefunctions_for_ans<distype>(xi_gp, shapefunctions);
     return shapefunctions;
   }
 
@@ -1584,6 +1678,31 @@ namespace Discret::Elements::Shell
     }
   }
 
+  /*!
+   * @brief Evaluates the area of the mid-surface as the length of the cross product of the
+   * kovariant basis vectors a1 and a2 in reference configuration
+   *
+   * @tparam distype  : The discretization type known at compile time
+   * @param a_reference (in) : An object holding the reference basis vectors and metric
+   * tensors of the midsurface
+   * @return double : area da on shell mid-surface
+   */
+  template <Core::FE::CellType distype>
+  double evaluate_mid_surface_area(
+      const Discret::Elements::Shell::BasisVectorsAndMetrics<distype>& a_reference)
+  {
+    // make h as cross product in ref configuration to get area da on shell mid-surface
+    Core::LinAlg::Matrix<Internal::num_dim, 1> h(true);
+    const Core::LinAlg::Matrix<Internal::num_dim, Internal::num_dim>& akovrefe =
+        a_reference.kovariant_;
+    h(0) = akovrefe(0, 1) * akovrefe(1, 2) - akovrefe(0, 2) * akovrefe(1, 1);
+    h(1) = akovrefe(0, 2) * akovrefe(1, 0) - akovrefe(0, 0) * akovrefe(1, 2);
+    h(2) = akovrefe(0, 0) * akovrefe(1, 1) - akovrefe(0, 1) * akovrefe(1, 0);
+
+    // make director unit length and get mid-surface area da from it
+    return h.norm2();
+  }
+
   /*!
    * @brief Calls the @p gp_evaluator to evaluate the jacobian mapping at each integration point of
    * @p intpoints_ of the mid-surface of the shell.
@@ -1622,19 +1741,170 @@ namespace Discret::Elements::Shell
 
       evaluate_metrics(shapefunctions, a_reference, a_current, nodal_coordinates, 0.0);
 
-      // make h as cross product in ref configuration to get area da on shell mid-surface
-      Core::LinAlg::Matrix<Internal::num_dim, 1> h(true);
+      double da = evaluate_mid_surface_area(a_reference);
+
+      gp_evaluator(xi_gp, shapefunctions, a_current, a_reference, gpweight, da, gp);
+    }
+  }
+
+  /*!
+   * @brief Evaluates the reference geometry of the element at one integration point of the
+   * mid-surface and at all integration points in thickness direction
+   *
+   * The result is written into @p reference_gp, such that an existing object can be reused
+   * without allocating memory.
+   *
+   * @tparam distype  : The discretization type known at compile time
+   * @param nodal_coordinates (in) : The nodal coordinates of the element
+   * @param xi (in) : Coordinate of the integration point in the parameter space
+   * @param intpoints_thickness (in) : Integration points in thickness direction
+   * @param condfac (in) : Scale factor for scaled director approach (SDC)
+   * @param num_ans (in) : Number of ANS collocation points
+   * @param reference_gp (out) : The reference geometry at the integration point
+   */
+  template <Core::FE::CellType distype>
+  void evaluate_reference_geometry_at_gauss_point(
+      const Discret::Elements::Shell::NodalCoordinates<distype>& nodal_coordinates,
+      const std::array<double, 2>& xi, const Core::FE::IntegrationPoints1D& intpoints_thickness,
+      const double condfac, const int num_ans, ReferenceGeometryAtGaussPoint<distype>& reference_gp)
+  {
+    FOUR_C_ASSERT(intpoints_thickness.num_points() == Internal::num_thickness_points,
+        "Expected %d integration points in thickness direction, got %d.",
+        Internal::num_thickness_points, intpoints_thickness.num_points());
+
+    reference_gp.xi_ = xi;
+    reference_gp.shape_functions_ = evaluate_shapefunctions_and_derivs<distype>(reference_gp.xi_);
+    if (num_ans > 0)
+      set_shapefunctions_for_ans<distype>(reference_gp.xi_, reference_gp.shape_functions_ans_);
+    else
+      reference_gp.shape_functions_ans_.clear();
+
+    evaluate_kovariant_vectors_and_metrics(reference_gp.shape_functions_, reference_gp.a_reference_,
+        nodal_coordinates.x_refe_, nodal_coordinates.a3_refe_, 0.0);
+    evaluate_kontravariant_vectors_and_metrics(reference_gp.a_reference_);
+    reference_gp.da_ = evaluate_mid_surface_area(reference_gp.a_reference_);
+
+    for (int gpt = 0; gpt < Internal::num_thickness_points; ++gpt)
+    {
+      const double zeta = intpoints_thickness.qxg[gpt][0] / condfac;
+      BasisVectorsAndMetrics<distype>& g_reference = reference_gp.g_reference_[gpt];
+      evaluate_kovariant_vectors_and_metrics(reference_gp.shape_functions_, g_reference,
+          nodal_coordinates.x_refe_, nodal_coordinates.a3_refe_, zeta);
+      evaluate_kontravariant_vectors_and_metrics(g_reference);
+
+      // jacobian determinant from the metric tensor as in modify_kovariant_metrics()
+      g_reference.detJ_ = std::sqrt(g_reference.metric_kovariant_.determinant());
+    }
+  }
+
+  /*!
+   * @brief Evaluates the reference geometry of the element at the ANS collocation points and, if
+   * requested, at all integration points of the mid-surface and in thickness direction
+   *
+   * @tparam distype  : The discretization type known at compile time
+   * @param nodal_coordinates (in) : The nodal coordinates of the element
+   * @param intpoints_midsurface (in) : Integration points of the mid-surface
+   * @param intpoints_thickness (in) : Integration points in thickness direction
+   * @param condfac (in) : Scale factor for scaled director approach (SDC)
+   * @param num_ans (in) : Number of ANS collocation points
+   * @param store_gauss_points (in) : Flag whether the integration points are evaluated and stored.
+   * Otherwise, for_each_gauss_point() evaluates them in place.
+   * @return ReferenceGeometry<distype> : The reference geometry of the element
+   */
+  template <Core::FE::CellType distype>
+  ReferenceGeometry<distype> evaluate_reference_geometry(
+      const Discret::Elements::Shell::NodalCoordinates<distype>& nodal_coordinates,
+      const Core::FE::IntegrationPoints2D& intpoints_midsurface,
+      const Core::FE::IntegrationPoints1D& intpoints_thickness, const double condfac,
+      const int num_ans, const bool store_gauss_points)
+  {
+    ReferenceGeometry<distype> reference_geometry;
+
+    // ANS collocation points for a_13 and a_23 each
+    const int total_ansq = 2 * num_ans;
+    reference_geometry.shapefunctions_collocation_.resize(total_ansq);
+    reference_geometry.metrics_collocation_reference_.resize(total_ansq);
+    if (num_ans > 0)
+    {
+      std::vector<std::array<double, 2>> collocation_points;
+      get_coordinates_of_ans_collocation_points<distype>(collocation_points);
+      for (int qp = 0; qp < total_ansq; ++qp)
       {
-        Core::LinAlg::Matrix<Internal::num_dim, Internal::num_dim> akovrefe =
-            a_reference.kovariant_;
-        h(0) = akovrefe(0, 1) * akovrefe(1, 2) - akovrefe(0, 2) * akovrefe(1, 1);
-        h(1) = akovrefe(0, 2) * akovrefe(1, 0) - akovrefe(0, 0) * akovrefe(1, 2);
-        h(2) = akovrefe(0, 0) * akovrefe(1, 1) - akovrefe(0, 1) * akovrefe(1, 0);
+        reference_geometry.shapefunctions_collocation_[qp] =
+            evaluate_shapefunctions_and_derivs<distype>(collocation_points[qp]);
+        evaluate_kovariant_vectors_and_metrics(reference_geometry.shapefunctions_collocation_[qp],
+            reference_geometry.metrics_collocation_reference_[qp], nodal_coordinates.x_refe_,
+            nodal_coordinates.a3_refe_, 0.0);
+        evaluate_kontravariant_vectors_and_metrics(
+            reference_geometry.metrics_collocation_reference_[qp]);
       }
-      // make director unit length and get mid-surface area da from it
-      double da = h.norm2();
+    }
 
-      gp_evaluator(xi_gp, shapefunctions, a_current, a_reference, gpweight, da, gp);
+    if (!store_gauss_points) return reference_geometry;
+
+    reference_geometry.gauss_points_.resize(intpoints_midsurface.num_points());
+    for (int gp = 0; gp < intpoints_midsurface.num_points(); ++gp)
+    {
+      evaluate_reference_geometry_at_gauss_point(nodal_coordinates,
+          {intpoints_midsurface.qxg[gp][0], intpoints_midsurface.qxg[gp][1]}, intpoints_thickness,
+          condfac, num_ans, reference_geometry.gauss_points_[gp]);
+    }
+
+    return reference_geometry;
+  }
+
+  /*!
+   * @brief Calls the @p gp_evaluator at each integration point of @p intpoints_ of the mid-surface
+   * of the shell using the reference geometry. Only the metrics of the current configuration are
+   * evaluated if the reference geometry is stored at the integration points. Otherwise, it is
+   * evaluated in place into one object that is reused for all integration points.
+   *
+   * @tparam distype  : The discretization type known at compile time
+   * @param nodal_coordinates (in) : The nodal coordinates of the element
+   * @param intpoints_ (in) : Integration points of the mid-surface
+   * @param intpoints_thickness (in) : Integration points in thickness direction
+   * @param condfac (in) : Scale factor for scaled director approach (SDC)
+   * @param num_ans (in) : Number of ANS collocation points
+   * @param reference_geometry (in) : Reference geometry of the element, with or without stored
+   * integration points of @p intpoints_
+   * @param gp_evaluator (in) : A callable object (e.g. lambda-function) with signature void(const
+   * Shell::ReferenceGeometryAtGaussPoint<distype>& reference_gp,
+   * Shell::BasisVectorsAndMetrics<distype>& a_current, double gpweight, int gp) that will be called
+   * for each integration point.
+   */
+  template <Core::FE::CellType distype, typename GaussPointEvaluator>
+  inline void for_each_gauss_point(
+      const Discret::Elements::Shell::NodalCoordinates<distype>& nodal_coordinates,
+      const Core::FE::IntegrationPoints2D& intpoints_,
+      const Core::FE::IntegrationPoints1D& intpoints_thickness, const double condfac,
+      const int num_ans, const ReferenceGeometry<distype>& reference_geometry,
+      GaussPointEvaluator gp_evaluator)
+  {
+    const bool stored_gauss_points = !reference_geometry.gauss_points_.empty();
+    FOUR_C_ASSERT(
+        !stored_gauss_points or
+            static_cast<int>(reference_geometry.gauss_points_.size()) == intpoints_.num_points(),
+        "Reference geometry does not match the integration rule.");
+
+    // reference geometry at the current integration point if it is not stored
+    ReferenceGeometryAtGaussPoint<distype> evaluated_gp;
+
+    for (int gp = 0; gp < intpoints_.num_points(); ++gp)
+    {
+      if (!stored_gauss_points)
+      {
+        evaluate_reference_geometry_at_gauss_point(nodal_coordinates,
+            {intpoints_.qxg[gp][0], intpoints_.qxg[gp][1]}, intpoints_thickness, condfac, num_ans,
+            evaluated_gp);
+      }
+      const ReferenceGeometryAtGaussPoint<distype>& reference_gp =
+          stored_gauss_points ? reference_geometry.gauss_points_[gp] : evaluated_gp;
+
+      // basis vectors and metric on mid-surface in current configuration
+      BasisVectorsAndMetrics<distype> a_current;
+      evaluate_current_metrics(reference_gp.shape_functions_, a_current, nodal_coordinates, 0.0);
+
+      gp_evaluator(reference_gp, a_current, intpoints_.qwgt[gp], gp);
     }
   }
 
@@ -83,6 +83,7 @@ void Discret::Elements::Shell7pScatraType::setup_element_definition(
                              .add_named_string_vector("EAS", 5)
                              .add_named_double("SDC")
                              .add_optional_tag("ANS")
+                             .add_optional_tag("CACHE_GEOMETRY")
                              .add_optional_named_double_vector("RAD", 3)
                              .add_optional_named_double_vector("AXI", 3)
                              .add_optional_named_double_vector("CIR", 3)
@@ -99,6 +100,7 @@ void Discret::Elements::Shell7pScatraType::setup_element_definition(
                              .add_named_string_vector("EAS", 5)
                              .add_named_double("SDC")
                              .add_optional_tag("ANS")
+                             .add_optional_tag("CACHE_GEOMETRY")
                              .add_optional_named_double_vector("RAD", 3)
                              .add_optional_named_double_vector("AXI", 3)
                              .add_optional_named_double_vector("CIR", 3)
@@ -115,6 +117,7 @@ void Discret::Elements::Shell7pScatraType::setup_element_definition(
                              .add_named_string_vector("EAS", 5)
                              .add_named_double("SDC")
                              .add_optional_tag("ANS")
+                             .add_optional_tag("CACHE_GEOMETRY")
                              .add_optional_named_double_vector("RAD", 3)
                              .add_optional_named_double_vector("AXI", 3)
                              .add_optional_named_double_vector("CIR", 3)
@@ -129,6 +132,7 @@ void Discret::Elements::Shell7pScatraType::setup_element_definition(
                             .add_named_int("MAT")
                             .add_named_double("THICK")
                             .add_named_double("SDC")
+                            .add_optional_tag("CACHE_GEOMETRY")
                             .add_optional_named_double_vector("RAD", 3)
                             .add_optional_named_double_vector("AXI", 3)
                             .add_optional_named_double_vector("CIR", 3)
@@ -143,6 +147,7 @@ void Discret::Elements::Shell7pScatraType::setup_element_definition(
                             .add_named_int("MAT")
                             .add_named_double("THICK")
                             .add_named_double("SDC")
+                            .add_optional_tag("CACHE_GEOMETRY")
                             .add_optional_named_double_vector("RAD", 3)
                             .add_optional_named_double_vector("AXI", 3)
                             .add_optional_named_double_vector("CIR", 3)
@@ -379,6 +384,9 @@ bool Discret::Elements::Shell7pScatra::read_element(const std::string& eletype,
   // read SDC
   shell_data.sdc = container.get<double>("SDC");
 
+  // store the reference geometry at the integration points
+  shell_data.cache_reference_geometry = container.get<bool>("CACHE_GEOMETRY");
+
   // read and set number of material model
   set_material(
       0, Mat::factory(Solid::Utils::Shell::ReadElement::read_and_set_element_material(container)));
@@ -43,14 +43,15 @@ namespace Solid::Elements
   };
 
   /*!
-   * @brief A struct holding the thickness, SDC scaling factor and number of collocation points
-   * within the ANS method
+   * @brief A struct holding the thickness, SDC scaling factor, number of collocation points
+   * within the ANS method and whether the reference geometry is stored at the integration points
    */
   struct ShellData
   {
     double sdc;
     double thickness;
     int num_ans;
+    bool cache_reference_geometry;
   };
 }  // namespace Solid::Elements
 
@@ -61,6 +62,7 @@ namespace Discret::Elements::Shell::Internal
   inline static constexpr int num_dim = 3;
   inline static constexpr int node_dof = 6;
   inline static constexpr int num_internal_variables = 12;
+  inline static constexpr int num_thickness_points = 2;
 
   template <Core::FE::CellType distype>
   inline static constexpr int numdofperelement = num_node<distype> * node_dof;
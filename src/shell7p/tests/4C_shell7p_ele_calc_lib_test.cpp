@@ -0,0 +1,180 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_shell7p_ele_calc_lib.hpp"
+
+#include "4C_fem_general_utils_local_connectivity_matrices.hpp"
+#include "4C_unittest_utils_assertions_test.hpp"
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+  using namespace Discret::Elements;
+
+  constexpr double tol = 1e-14;
+
+  // curved shell with varying director in reference configuration and a deformed current
+  // configuration
+  template <Core::FE::CellType distype>
+  Shell::NodalCoordinates<distype> curved_shell_coordinates()
+  {
+    Shell::NodalCoordinates<distype> nodal_coordinates;
+    for (int inode = 0; inode < Shell::Internal::num_node<distype>; ++inode)
+    {
+      const double xi = Core::FE::eleNodeNumbering_quad9_nodes_reference[inode][0];
+      const double eta = Core::FE::eleNodeNumbering_quad9_nodes_reference[inode][1];
+
+      nodal_coordinates.x_refe_(inode, 0) = 2.0 * xi + 0.1 * eta;
+      nodal_coordinates.x_refe_(inode, 1) = eta;
+      nodal_coordinates.x_refe_(inode, 2) = 0.2 * xi * xi + 0.05 * eta;
+      nodal_coordinates.a3_refe_(inode, 0) = -0.02 * xi;
+      nodal_coordinates.a3_refe_(inode, 1) = 0.01 * eta;
+      nodal_coordinates.a3_refe_(inode, 2) = 0.05;
+
+      for (int idim = 0; idim < Shell::Internal::num_dim; ++idim)
+      {
+        nodal_coordinates.x_curr_(inode, idim) =
+            nodal_coordinates.x_refe_(inode, idim) + 0.01 * (idim + 1) * xi * eta;
+        nodal_coordinates.a3_curr_(inode, idim) =
+            nodal_coordinates.a3_refe_(inode, idim) + 0.001 * (idim + 1) * xi;
+      }
+    }
+    return nodal_coordinates;
+  }
+
+  template <Core::FE::CellType distype>
+  void expect_near(const Shell::BasisVectorsAndMetrics<distype>& actual,
+      const Shell::BasisVectorsAndMetrics<distype>& expected)
+  {
+    FOUR_C_EXPECT_NEAR(actual.kovariant_, expected.kovariant_, tol);
+    FOUR_C_EXPECT_NEAR(actual.kontravariant_, expected.kontravariant_, tol);
+    FOUR_C_EXPECT_NEAR(actual.metric_kovariant_, expected.metric_kovariant_, tol);
+    FOUR_C_EXPECT_NEAR(actual.metric_kontravariant_, expected.metric_kontravariant_, tol);
+    FOUR_C_EXPECT_NEAR(actual.partial_derivative_, expected.partial_derivative_, tol);
+  }
+
+  template <Core::FE::CellType distype>
+  void expect_cached_and_uncached_geometry_agree(const int num_ans)
+  {
+    Shell::NodalCoordinates<distype> nodal_coordinates = curved_shell_coordinates<distype>();
+    const Core::FE::IntegrationPoints2D intpoints =
+        Shell::create_gauss_integration_points<distype>(Shell::get_gauss_rule<distype>());
+    const Core::FE::IntegrationPoints1D intpoints_thickness(Core::FE::GaussRule1D::line_2point);
+    const double condfac = 1.5;
+
+    const Shell::ReferenceGeometry<distype> cached = Shell::evaluate_reference_geometry<distype>(
+        nodal_coordinates, intpoints, intpoints_thickness, condfac, num_ans, true);
+    const Shell::ReferenceGeometry<distype> uncached = Shell::evaluate_reference_geometry<distype>(
+        nodal_coordinates, intpoints, intpoints_thickness, condfac, num_ans, false);
+
+    ASSERT_EQ(static_cast<int>(cached.gauss_points_.size()), intpoints.num_points());
+    EXPECT_TRUE(uncached.gauss_points_.empty());
+
+    // the ANS collocation points are evaluated in both cases
+    ASSERT_EQ(static_cast<int>(cached.metrics_collocation_reference_.size()), 2 * num_ans);
+    ASSERT_EQ(static_cast<int>(uncached.metrics_collocation_reference_.size()), 2 * num_ans);
+    for (int qp = 0; qp < 2 * num_ans; ++qp)
+    {
+      FOUR_C_EXPECT_NEAR(uncached.shapefunctions_collocation_[qp].derivatives_,
+          cached.shapefunctions_collocation_[qp].derivatives_, tol);
+      expect_near(
+          uncached.metrics_collocation_reference_[qp], cached.metrics_collocation_reference_[qp]);
+    }
+
+    std::vector<Shell::ReferenceGeometryAtGaussPoint<distype>> cached_gps;
+    std::vector<Shell::BasisVectorsAndMetrics<distype>> cached_a_current;
+    Shell::for_each_gauss_point<distype>(nodal_coordinates, intpoints, intpoints_thickness,
+        condfac, num_ans, cached,
+        [&](const Shell::ReferenceGeometryAtGaussPoint<distype>& reference_gp,
+            Shell::BasisVectorsAndMetrics<distype>& a_current, double gpweight, int gp)
+        {
+          EXPECT_EQ(gpweight, intpoints.qwgt[gp]);
+          cached_gps.push_back(reference_gp);
+          cached_a_current.push_back(a_current);
+        });
+
+    std::vector<Shell::ReferenceGeometryAtGaussPoint<distype>> uncached_gps;
+    std::vector<Shell::BasisVectorsAndMetrics<distype>> uncached_a_current;
+    Shell::for_each_gauss_point<distype>(nodal_coordinates, intpoints, intpoints_thickness,
+        condfac, num_ans, uncached,
+        [&](const Shell::ReferenceGeometryAtGaussPoint<distype>& reference_gp,
+            Shell::BasisVectorsAndMetrics<distype>& a_current, double gpweight, int gp)
+        {
+          EXPECT_EQ(gpweight, intpoints.qwgt[gp]);
+          uncached_gps.push_back(reference_gp);
+          uncached_a_current.push_back(a_current);
+        });
+
+    // evaluation of the geometry at each integration point without any stored data
+    std::vector<Shell::ShapefunctionsAndDerivatives<distype>> direct_shape_functions;
+    std::vector<Shell::BasisVectorsAndMetrics<distype>> direct_a_reference;
+    std::vector<Shell::BasisVectorsAndMetrics<distype>> direct_a_current;
+    std::vector<double> direct_da;
+    Shell::for_each_gauss_point<distype>(nodal_coordinates, intpoints,
+        [&](const std::array<double, 2>&,
+            const Shell::ShapefunctionsAndDerivatives<distype>& shape_functions,
+            Shell::BasisVectorsAndMetrics<distype>& a_current,
+            Shell::BasisVectorsAndMetrics<distype>& a_reference, double, double da, int)
+        {
+          direct_shape_functions.push_back(shape_functions);
+          direct_a_reference.push_back(a_reference);
+          direct_a_current.push_back(a_current);
+          direct_da.push_back(da);
+        });
+
+    ASSERT_EQ(static_cast<int>(cached_gps.size()), intpoints.num_points());
+    ASSERT_EQ(static_cast<int>(uncached_gps.size()), intpoints.num_points());
+    ASSERT_EQ(static_cast<int>(direct_da.size()), intpoints.num_points());
+    for (int gp = 0; gp < intpoints.num_points(); ++gp)
+    {
+      const std::array<double, 2> xi_gp = {intpoints.qxg[gp][0], intpoints.qxg[gp][1]};
+      for (const auto* reference_gp : {&cached_gps[gp], &uncached_gps[gp]})
+      {
+        EXPECT_EQ(reference_gp->xi_, xi_gp);
+        FOUR_C_EXPECT_NEAR(reference_gp->shape_functions_.shapefunctions_,
+            direct_shape_functions[gp].shapefunctions_, tol);
+        FOUR_C_EXPECT_NEAR(reference_gp->shape_functions_.derivatives_,
+            direct_shape_functions[gp].derivatives_, tol);
+        FOUR_C_EXPECT_NEAR(reference_gp->shape_functions_ans_,
+            Shell::get_shapefunctions_for_ans<distype>(xi_gp, num_ans), tol);
+        expect_near(reference_gp->a_reference_, direct_a_reference[gp]);
+        EXPECT_NEAR(reference_gp->da_, direct_da[gp], tol);
+
+        for (int gpt = 0; gpt < intpoints_thickness.num_points(); ++gpt)
+        {
+          const double zeta = intpoints_thickness.qxg[gpt][0] / condfac;
+          Shell::BasisVectorsAndMetrics<distype> g_reference;
+          Shell::BasisVectorsAndMetrics<distype> g_current;
+          Shell::evaluate_metrics(
+              direct_shape_functions[gp], g_reference, g_current, nodal_coordinates, zeta);
+          expect_near(reference_gp->g_reference_[gpt], g_reference);
+          EXPECT_NEAR(reference_gp->g_reference_[gpt].detJ_, std::abs(g_reference.detJ_), 1e-12);
+        }
+      }
+
+      expect_near(cached_a_current[gp], direct_a_current[gp]);
+      expect_near(uncached_a_current[gp], direct_a_current[gp]);
+    }
+  }
+
+  TEST(Shell7pEleCalcLibTest, CachedAndUncachedReferenceGeometryAgreeQuad4)
+  {
+    expect_cached_and_uncached_geometry_agree<Core::FE::CellType::quad4>(0);
+    expect_cached_and_uncached_geometry_agree<Core::FE::CellType::quad4>(2);
+  }
+
+  TEST(Shell7pEleCalcLibTest, CachedAndUncachedReferenceGeometryAgreeQuad9)
+  {
+    expect_cached_and_uncached_geometry_agree<Core::FE::CellType::quad9>(0);
+    expect_cached_and_uncached_geometry_agree<Core::FE::CellType::quad9>(6);
+  }
+}  // namespace
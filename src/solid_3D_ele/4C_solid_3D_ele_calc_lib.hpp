@@ -19,6 +19,7 @@
 #include "4C_fem_general_fiber_node_utils.hpp"
 #include "4C_fem_general_utils_gauss_point_postprocess.hpp"
 #include "4C_fem_general_utils_gausspoints.hpp"
+#include "4C_fem_general_utils_nurbs_bezier_extraction.hpp"
 #include "4C_fem_general_utils_nurbs_shapefunctions.hpp"
 #include "4C_fem_nurbs_discretization_utils.hpp"
 #include "4C_global_data.hpp"
@@ -137,6 +138,11 @@ namespace Discret::Elements
      * @brief Weights of control points
      */
     Core::LinAlg::Matrix<Internal::num_nodes<celltype>, 1, double> weights;
+
+    /*!
+     * @brief Bezier extraction operators of a NURBS element (nullptr if not available)
+     */
+    const Core::FE::Nurbs::BezierExtraction* bezier_extraction = nullptr;
   };
 
   /*!
@@ -192,6 +198,10 @@ namespace Discret::Elements
           discretization, &ele, element_nodes.knots, element_nodes.weights);
       if (zero_size)
         FOUR_C_THROW("get_my_nurbs_knots_and_weights has to return a non zero size NURBS element.");
+
+      element_nodes.bezier_extraction =
+          static_cast<const Core::FE::Nurbs::NurbsDiscretization&>(discretization)
+              .get_bezier_extraction(ele.id());
     }
 
     return element_nodes;
@@ -390,8 +400,17 @@ namespace Discret::Elements
       const ElementNodes<celltype>& nodal_coordinates)
   {
     ShapeFunctionsAndDerivatives<celltype> shapefcns;
-    Core::FE::Nurbs::nurbs_get_funct_deriv(shapefcns.shapefunctions_, shapefcns.derivatives_, xi,
-        nodal_coordinates.knots, nodal_coordinates.weights, celltype);
+    if (nodal_coordinates.bezier_extraction != nullptr)
+    {
+      Core::FE::Nurbs::nurbs_get_funct_deriv<celltype>(shapefcns.shapefunctions_,
+          shapefcns.derivatives_, xi, *nodal_coordinates.bezier_extraction,
+          nodal_coordinates.weights);
+    }
+    else
+    {
+      Core::FE::Nurbs::nurbs_get_funct_deriv(shapefcns.shapefunctions_, shapefcns.derivatives_,
+          xi, nodal_coordinates.knots, nodal_coordinates.weights, celltype);
+    }
 
     return shapefcns;
   }
@@ -0,0 +1,115 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_SOLID_PORO_3D_ELE_CALC_OD_CACHE_HPP
+#define FOUR_C_SOLID_PORO_3D_ELE_CALC_OD_CACHE_HPP
+
+#include "4C_config.hpp"
+
+#include <memory>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Discret::Elements
+{
+  /*!
+   * @brief Storage of an off-diagonal element matrix that is evaluated ahead of its request
+   *
+   * The storage is allocated when the matrix is requested for the first time. From then on, every
+   * evaluation of the diagonal block also evaluates the off-diagonal matrix, and a following
+   * request at the same state takes it. If an evaluation of the diagonal block finds that the
+   * previous matrix has not been requested, the storage is released until the next request.
+   * Copies start without storage.
+   *
+   * @tparam MatrixType fixed-size matrix providing clear()
+   * @tparam StateType  state the matrix depends on, comparable with ==
+   */
+  template <typename MatrixType, typename StateType>
+  class OffDiagonalMatrixCache
+  {
+   public:
+    OffDiagonalMatrixCache() = default;
+
+    OffDiagonalMatrixCache(const OffDiagonalMatrixCache& other) {}
+
+    OffDiagonalMatrixCache& operator=(const OffDiagonalMatrixCache& other)
+    {
+      storage_ = nullptr;
+      return *this;
+    }
+
+    OffDiagonalMatrixCache(OffDiagonalMatrixCache&&) = default;
+
+    OffDiagonalMatrixCache& operator=(OffDiagonalMatrixCache&&) = default;
+
+    ~OffDiagonalMatrixCache() = default;
+
+    /*!
+     * @brief Start an evaluation of the diagonal block at the given state
+     *
+     * @return zeroed matrix to be evaluated alongside the diagonal block, nullptr if the
+     * off-diagonal matrix is currently not requested
+     */
+    MatrixType* begin_evaluation(const StateType& state)
+    {
+      if (storage_ == nullptr) return nullptr;
+
+      if (storage_->evaluated)
+      {
+        // the matrix of the previous evaluation has not been requested
+        storage_ = nullptr;
+        return nullptr;
+      }
+
+      storage_->evaluated = true;
+      storage_->matrix.clear();
+      storage_->state = state;
+      return &storage_->matrix;
+    }
+
+    /*!
+     * @brief Request the off-diagonal matrix at the given state
+     *
+     * @return matrix evaluated alongside the diagonal block at this state, nullptr if the caller
+     * has to evaluate it. In the latter case, the next evaluation of the diagonal block evaluates
+     * the matrix alongside.
+     */
+    const MatrixType* request(const StateType& state)
+    {
+      if (storage_ != nullptr and storage_->evaluated and storage_->state == state)
+      {
+        storage_->evaluated = false;
+        return &storage_->matrix;
+      }
+
+      if (storage_ == nullptr) storage_ = std::make_unique<Storage>();
+      storage_->evaluated = false;
+      return nullptr;
+    }
+
+    //! flag whether the storage is currently allocated
+    [[nodiscard]] bool is_allocated() const { return storage_ != nullptr; }
+
+   private:
+    struct Storage
+    {
+      //! flag whether the matrix has been evaluated and not been requested yet
+      bool evaluated = false;
+
+      MatrixType matrix;
+
+      //! state the matrix was evaluated at
+      StateType state;
+    };
+
+    std::unique_ptr<Storage> storage_;
+  };
+}  // namespace Discret::Elements
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
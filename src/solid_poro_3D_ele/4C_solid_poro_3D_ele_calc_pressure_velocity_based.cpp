@@ -125,6 +125,112 @@ namespace
     }
     return dInverseDeformationGradient_dDisp_Gradp;
   }
+
+  /*!
+   * @brief Add the Gauss point contribution of the off-diagonal structure-fluid matrix
+   *
+   * All kinematic quantities are passed in such that the contribution can be evaluated within
+   * the Gauss point loop of the structural stiffness matrix without recomputing them.
+   */
+  template <Core::FE::CellType celltype>
+  void update_stiffness_matrix_od_at_gauss_point(Mat::StructPoro& porostructmat,
+      Mat::FluidPoro& porofluidmat,
+      const Discret::Elements::AnisotropyProperties& anisotropy_properties,
+      Teuchos::ParameterList& params, const int gp, const double integration_factor,
+      const Discret::Elements::ShapeFunctionsAndDerivatives<celltype>& shape_functions,
+      const Discret::Elements::JacobianMapping<celltype>& jacobian_mapping,
+      const Discret::Elements::SpatialMaterialMapping<celltype>& spatial_material_mapping,
+      const Discret::Elements::CauchyGreenAndInverse<celltype>& cauchygreen,
+      const Core::LinAlg::Matrix<Discret::Elements::Internal::num_str<celltype>,
+          Discret::Elements::Internal::num_dof_per_ele<celltype>>& Bop,
+      const Core::LinAlg::Matrix<Discret::Elements::Internal::num_dof_per_ele<celltype>, 1>&
+          BopCinv,
+      const double volchange, const double fluid_press,
+      const Core::LinAlg::Matrix<Discret::Elements::Internal::num_dim<celltype>, 1>& disp_velocity,
+      const Core::LinAlg::Matrix<Discret::Elements::Internal::num_dim<celltype>, 1>&
+          fluid_velocity,
+      const Core::LinAlg::Matrix<Discret::Elements::Internal::num_dim<celltype>,
+          Discret::Elements::Internal::num_dim<celltype>>& fluid_velocity_gradient,
+      const Core::LinAlg::Matrix<Discret::Elements::Internal::num_dim<celltype>, 1>& Finvgradp,
+      Core::LinAlg::Matrix<Discret::Elements::Internal::num_dof_per_ele<celltype>,
+          (Discret::Elements::Internal::num_dim<celltype> + 1) *
+              Discret::Elements::Internal::num_nodes<celltype>>& stiff)
+  {
+    constexpr int num_dim = Discret::Elements::Internal::num_dim<celltype>;
+    constexpr int num_nodes = Discret::Elements::Internal::num_nodes<celltype>;
+
+    const Discret::Elements::PorosityAndLinearizationOD porosity_and_linearization_od =
+        Discret::Elements::compute_porosity_and_linearization_od<celltype>(
+            porostructmat, params, fluid_press, volchange, gp);
+
+    // F^-T * N_XYZ
+    Core::LinAlg::Matrix<num_dim, num_nodes> FinvNXYZ;
+    FinvNXYZ.multiply_tn(
+        spatial_material_mapping.inverse_deformation_gradient_, jacobian_mapping.N_XYZ_);
+
+    Core::LinAlg::Matrix<num_dim, num_dim> reatensor(true);
+    Core::LinAlg::Matrix<num_dim, num_dim> linreac_dporosity(
+        true);  // Derivative of the material reaction tensor w.r.t. the porosity
+    Core::LinAlg::Matrix<num_dim, 1> rea_fluid_vel(true);
+    Core::LinAlg::Matrix<num_dim, 1> rea_disp_vel(true);
+
+    Discret::Elements::compute_linearization_of_reaction_tensor_od<celltype>(porofluidmat,
+        shape_functions.shapefunctions_, spatial_material_mapping,
+        porosity_and_linearization_od.porosity, disp_velocity, fluid_velocity,
+        anisotropy_properties, reatensor, linreac_dporosity, rea_fluid_vel, rea_disp_vel);
+
+    Discret::Elements::update_stiffness_matrix_od<celltype>(integration_factor,
+        shape_functions.shapefunctions_, spatial_material_mapping,
+        porosity_and_linearization_od.porosity,
+        porosity_and_linearization_od.d_porosity_d_pressure, BopCinv, Finvgradp, FinvNXYZ,
+        porofluidmat, disp_velocity, fluid_velocity, reatensor, linreac_dporosity, rea_fluid_vel,
+        rea_disp_vel, stiff);
+
+    if (porofluidmat.type() == Mat::PAR::darcy_brinkman)
+    {
+      Discret::Elements::update_stiffness_brinkman_flow_od<celltype>(integration_factor,
+          porofluidmat.viscosity(), porosity_and_linearization_od.porosity,
+          porosity_and_linearization_od.d_porosity_d_pressure, shape_functions.shapefunctions_,
+          jacobian_mapping, spatial_material_mapping, cauchygreen.inverse_right_cauchy_green_,
+          fluid_velocity_gradient, Bop, stiff);
+    }
+  }
+
+  /*!
+   * @brief Total time as read by the porosity laws (-1 if not given)
+   */
+  double get_total_time(const Teuchos::ParameterList& params)
+  {
+    return params.isParameter("total time") ? params.get<double>("total time") : -1.0;
+  }
+
+  /*!
+   * @brief Scalar values as read by the porosity laws (empty if not given)
+   */
+  std::vector<double> get_scalar(const Teuchos::ParameterList& params)
+  {
+    if (not params.isParameter("scalar")) return {};
+    return *params.get<std::shared_ptr<std::vector<double>>>("scalar");
+  }
+
+  /*!
+   * @brief State the off-diagonal structure-fluid matrix is evaluated at
+   */
+  template <typename StateType, Core::FE::CellType celltype>
+  StateType get_off_diagonal_state(
+      const Discret::Elements::FluidVariables<celltype>& fluid_variables,
+      const Discret::Elements::SolidVariables<celltype>& solid_variables,
+      const Teuchos::ParameterList& params)
+  {
+    StateType state;
+    state.fluidpress_nodal = fluid_variables.fluidpress_nodal;
+    state.fluidvel_nodal = fluid_variables.fluidvel_nodal;
+    state.soliddisp_nodal = solid_variables.soliddisp_nodal;
+    state.solidvel_nodal = solid_variables.solidvel_nodal;
+    state.total_time = get_total_time(params);
+    state.scalar = get_scalar(params);
+    return state;
+  }
 }  // namespace
 
 template <Core::FE::CellType celltype>
@@ -135,6 +241,15 @@ Discret::Elements::SolidPoroPressureVelocityBasedEleCalc<
 {
 }
 
+template <Core::FE::CellType celltype>
+bool Discret::Elements::SolidPoroPressureVelocityBasedEleCalc<celltype>::OffDiagonalState::
+operator==(const OffDiagonalState& other) const
+{
+  return fluidpress_nodal == other.fluidpress_nodal and fluidvel_nodal == other.fluidvel_nodal and
+         soliddisp_nodal == other.soliddisp_nodal and solidvel_nodal == other.solidvel_nodal and
+         total_time == other.total_time and scalar == other.scalar;
+}
+
 template <Core::FE::CellType celltype>
 void Discret::Elements::SolidPoroPressureVelocityBasedEleCalc<celltype>::poro_setup(
     Mat::StructPoro& porostructmat, const Core::IO::InputParameterContainer& container)
@@ -173,6 +288,14 @@ void Discret::Elements::SolidPoroPressureVelocityBasedEleCalc<
   // get primary variables from structure field
   SolidVariables<celltype> solid_variables = get_solid_variables<celltype>(discretization, la);
 
+  // evaluate the off-diagonal structure-fluid matrix in the same Gauss point loop if the
+  // element is part of a monolithic scheme that requests it after the structural stiffness
+  Core::LinAlg::Matrix<num_dof_per_ele_, (num_dim_ + 1) * num_nodes_>* stiff_od = nullptr;
+  if (stiffness_matrix != nullptr)
+  {
+    stiff_od = od_cache_.begin_evaluation(
+        get_off_diagonal_state<OffDiagonalState>(fluid_variables, solid_variables, params));
+  }
 
   // get nodal coordinates current and reference
   const ElementNodes<celltype> nodal_coordinates =
@@ -335,6 +458,14 @@ void Discret::Elements::SolidPoroPressureVelocityBasedEleCalc<
             react->update(1.0, erea_v, 1.0);
           }
         }
+
+        if (stiff_od != nullptr)
+        {
+          update_stiffness_matrix_od_at_gauss_point<celltype>(porostructmat, porofluidmat,
+              anisotropy_properties, params, gp, integration_factor, shape_functions,
+              jacobian_mapping, spatial_material_mapping, cauchygreen, Bop, BopCinv, volchange,
+              fluid_press, disp_velocity, fluid_velocity, fvelder, FinvGradp, *stiff_od);
+        }
       });
 }
 
@@ -360,6 +491,16 @@ void Discret::Elements::SolidPoroPressureVelocityBasedEleCalc<
     // get primary variables from structure field
     SolidVariables<celltype> solid_variables = get_solid_variables<celltype>(discretization, la);
 
+    // the off-diagonal matrix has already been evaluated together with the structural stiffness
+    // matrix at the same state, otherwise it is evaluated together with it from now on
+    const auto* cached_stiff = od_cache_.request(
+        get_off_diagonal_state<OffDiagonalState>(fluid_variables, solid_variables, params));
+    if (cached_stiff != nullptr)
+    {
+      stiff->update(1.0, *cached_stiff, 1.0);
+      return;
+    }
+
     // get nodal coordinates current and reference
     const ElementNodes<celltype> nodal_coordinates =
         evaluate_element_nodes<celltype>(ele, discretization, la[0].lm_);
@@ -405,10 +546,6 @@ void Discret::Elements::SolidPoroPressureVelocityBasedEleCalc<
           Core::LinAlg::Matrix<num_dim_, 1> pressure_gradient(true);
           pressure_gradient.multiply(jacobian_mapping.N_XYZ_, fluid_variables.fluidpress_nodal);
 
-          const PorosityAndLinearizationOD porosity_and_linearization_od =
-              compute_porosity_and_linearization_od<celltype>(
-                  porostructmat, params, fluid_press, volchange, gp);
-
           // inverse Right Cauchy-Green tensor as vector in voigt notation
           Core::LinAlg::Matrix<num_str_, 1> C_inv_vec(false);
           Core::LinAlg::Voigt::Stresses::matrix_to_vector(
@@ -423,36 +560,11 @@ void Discret::Elements::SolidPoroPressureVelocityBasedEleCalc<
           Finvgradp.multiply_tn(
               spatial_material_mapping.inverse_deformation_gradient_, pressure_gradient);
 
-          // F^-T * N_XYZ
-          Core::LinAlg::Matrix<num_dim_, num_nodes_> FinvNXYZ;
-          FinvNXYZ.multiply_tn(
-              spatial_material_mapping.inverse_deformation_gradient_, jacobian_mapping.N_XYZ_);
-
-          Core::LinAlg::Matrix<num_dim_, num_dim_> reatensor(true);
-          Core::LinAlg::Matrix<num_dim_, num_dim_> linreac_dporosity(
-              true);  // Derivative of the material reaction tensor w.r.t. the porosity
-          Core::LinAlg::Matrix<num_dim_, 1> rea_fluid_vel(true);
-          Core::LinAlg::Matrix<num_dim_, 1> rea_disp_vel(true);
-
-          compute_linearization_of_reaction_tensor_od<celltype>(porofluidmat,
-              shape_functions.shapefunctions_, spatial_material_mapping,
-              porosity_and_linearization_od.porosity, disp_velocity, fluid_velocity,
-              anisotropy_properties, reatensor, linreac_dporosity, rea_fluid_vel, rea_disp_vel);
-
-          update_stiffness_matrix_od<celltype>(integration_factor, shape_functions.shapefunctions_,
-              spatial_material_mapping, porosity_and_linearization_od.porosity,
-              porosity_and_linearization_od.d_porosity_d_pressure, BopCinv, Finvgradp, FinvNXYZ,
-              porofluidmat, disp_velocity, fluid_velocity, reatensor, linreac_dporosity,
-              rea_fluid_vel, rea_disp_vel, *stiff);
-
-          if (porofluidmat.type() == Mat::PAR::darcy_brinkman)
-          {
-            update_stiffness_brinkman_flow_od<celltype>(integration_factor,
-                porofluidmat.viscosity(), porosity_and_linearization_od.porosity,
-                porosity_and_linearization_od.d_porosity_d_pressure,
-                shape_functions.shapefunctions_, jacobian_mapping, spatial_material_mapping,
-                cauchygreen.inverse_right_cauchy_green_, fluid_velocity_gradient, Bop, *stiff);
-          }
+          update_stiffness_matrix_od_at_gauss_point<celltype>(porostructmat, porofluidmat,
+              anisotropy_properties, params, gp, integration_factor, shape_functions,
+              jacobian_mapping, spatial_material_mapping, cauchygreen, Bop, BopCinv, volchange,
+              fluid_press, disp_velocity, fluid_velocity, fluid_velocity_gradient, Finvgradp,
+              *stiff);
         });
   }
 }
@@ -13,10 +13,14 @@
 
 #include "4C_fem_general_element.hpp"
 #include "4C_fem_general_utils_gausspoints.hpp"
+#include "4C_linalg_fixedsizematrix.hpp"
 #include "4C_solid_poro_3D_ele_calc_interface.hpp"
 #include "4C_solid_poro_3D_ele_calc_lib_io.hpp"
+#include "4C_solid_poro_3D_ele_calc_od_cache.hpp"
 #include "4C_solid_poro_3D_ele_properties.hpp"
 
+#include <vector>
+
 FOUR_C_NAMESPACE_OPEN
 
 namespace Mat
@@ -48,6 +52,15 @@ namespace Discret
           Core::LinAlg::SerialDenseMatrix* stiffness_matrix,
           Core::LinAlg::SerialDenseMatrix* reactive_matrix);
 
+      /*!
+       * @brief Evaluate the off-diagonal structure-fluid matrix
+       *
+       * Once this matrix is requested, it is additionally evaluated within the Gauss point loop of
+       * evaluate_nonlinear_force_stiffness() and reused here as long as the nodal state of both
+       * fields and the time and scalar parameters did not change in between. If the matrix is not
+       * requested after an evaluation of the structural stiffness, the additional evaluation stops
+       * until it is requested again.
+       */
       void evaluate_nonlinear_force_stiffness_od(const Core::Elements::Element& ele,
           Mat::StructPoro& porostructmat, Mat::FluidPoro& porofluidmat,
           AnisotropyProperties anisotropy_properties, const Inpar::Solid::KinemType& kinematictype,
@@ -74,6 +87,28 @@ namespace Discret
       static constexpr int num_str_ = num_dim_ * (num_dim_ + 1) / 2;
 
       Core::FE::GaussIntegration gauss_integration_;
+
+      /// state the off-diagonal structure-fluid matrix depends on
+      struct OffDiagonalState
+      {
+        /// nodal state of both fields
+        Core::LinAlg::Matrix<num_nodes_, 1> fluidpress_nodal;
+        Core::LinAlg::Matrix<num_dim_, num_nodes_> fluidvel_nodal;
+        Core::LinAlg::Matrix<num_dim_, num_nodes_> soliddisp_nodal;
+        Core::LinAlg::Matrix<num_dim_, num_nodes_> solidvel_nodal;
+
+        /// parameters the porosity law depends on
+        double total_time = 0.0;
+        std::vector<double> scalar;
+
+        bool operator==(const OffDiagonalState& other) const;
+      };
+
+      /// off-diagonal structure-fluid matrix evaluated together with the structural stiffness,
+      /// copies of this object do not take it over
+      OffDiagonalMatrixCache<Core::LinAlg::Matrix<num_dof_per_ele_, (num_dim_ + 1) * num_nodes_>,
+          OffDiagonalState>
+          od_cache_;
     };
   }  // namespace Elements
 }  // namespace Discret
@@ -0,0 +1,122 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_solid_poro_3D_ele_calc_od_cache.hpp"
+
+#include "4C_linalg_fixedsizematrix.hpp"
+
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  using Cache = Discret::Elements::OffDiagonalMatrixCache<Core::LinAlg::Matrix<2, 3>,
+      std::vector<double>>;
+
+  const std::vector<double> state_1 = {1.0, 2.0};
+  const std::vector<double> state_2 = {1.0, 2.5};
+
+  //! evaluate the diagonal block and, if requested, the off-diagonal matrix alongside
+  bool evaluate_diagonal_block(Cache& cache, const std::vector<double>& state)
+  {
+    Core::LinAlg::Matrix<2, 3>* od = cache.begin_evaluation(state);
+    if (od == nullptr) return false;
+
+    EXPECT_EQ(od->norm_inf(), 0.0);
+    for (int i = 0; i < 2; ++i)
+      for (int j = 0; j < 3; ++j) (*od)(i, j) += state[1] * (i + 1) + j;
+    return true;
+  }
+
+  TEST(OffDiagonalMatrixCacheTest, AllocatedOnFirstRequest)
+  {
+    Cache cache;
+    EXPECT_FALSE(cache.is_allocated());
+
+    // nothing is evaluated alongside before the matrix has been requested
+    EXPECT_FALSE(evaluate_diagonal_block(cache, state_1));
+    EXPECT_FALSE(cache.is_allocated());
+
+    EXPECT_EQ(cache.request(state_1), nullptr);
+    EXPECT_TRUE(cache.is_allocated());
+  }
+
+  TEST(OffDiagonalMatrixCacheTest, ReusedAtSameState)
+  {
+    Cache cache;
+    EXPECT_EQ(cache.request(state_1), nullptr);
+
+    for (int step = 0; step < 3; ++step)
+    {
+      EXPECT_TRUE(evaluate_diagonal_block(cache, state_1));
+
+      const Core::LinAlg::Matrix<2, 3>* od = cache.request(state_1);
+      ASSERT_NE(od, nullptr);
+      EXPECT_EQ((*od)(1, 2), 2.0 * 2.0 + 2.0);
+
+      // the matrix is taken only once
+      EXPECT_EQ(cache.request(state_1), nullptr);
+      EXPECT_TRUE(cache.is_allocated());
+    }
+  }
+
+  TEST(OffDiagonalMatrixCacheTest, NotReusedAtChangedState)
+  {
+    Cache cache;
+    EXPECT_EQ(cache.request(state_1), nullptr);
+
+    EXPECT_TRUE(evaluate_diagonal_block(cache, state_1));
+    EXPECT_EQ(cache.request(state_2), nullptr);
+    EXPECT_TRUE(cache.is_allocated());
+
+    // the next evaluation starts from a zero matrix at the new state
+    EXPECT_TRUE(evaluate_diagonal_block(cache, state_2));
+    const Core::LinAlg::Matrix<2, 3>* od = cache.request(state_2);
+    ASSERT_NE(od, nullptr);
+    EXPECT_EQ((*od)(1, 2), 2.0 * 2.5 + 2.0);
+  }
+
+  TEST(OffDiagonalMatrixCacheTest, ReleasedIfNotRequested)
+  {
+    Cache cache;
+    EXPECT_EQ(cache.request(state_1), nullptr);
+
+    EXPECT_TRUE(evaluate_diagonal_block(cache, state_1));
+
+    // the matrix of the last evaluation has not been requested
+    EXPECT_FALSE(evaluate_diagonal_block(cache, state_1));
+    EXPECT_FALSE(cache.is_allocated());
+    EXPECT_FALSE(evaluate_diagonal_block(cache, state_1));
+
+    // the next request turns the evaluation alongside the diagonal block on again
+    EXPECT_EQ(cache.request(state_1), nullptr);
+    EXPECT_TRUE(evaluate_diagonal_block(cache, state_1));
+    EXPECT_NE(cache.request(state_1), nullptr);
+  }
+
+  TEST(OffDiagonalMatrixCacheTest, CopiesStartWithoutStorage)
+  {
+    Cache cache;
+    EXPECT_EQ(cache.request(state_1), nullptr);
+    EXPECT_TRUE(evaluate_diagonal_block(cache, state_1));
+
+    Cache copy(cache);
+    EXPECT_FALSE(copy.is_allocated());
+    EXPECT_EQ(copy.request(state_1), nullptr);
+
+    Cache assigned;
+    EXPECT_EQ(assigned.request(state_2), nullptr);
+    assigned = cache;
+    EXPECT_FALSE(assigned.is_allocated());
+
+    // the original keeps its matrix
+    EXPECT_NE(cache.request(state_1), nullptr);
+  }
+}  // namespace
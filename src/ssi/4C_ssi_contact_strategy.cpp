@@ -90,7 +90,6 @@ void SSI::ContactStrategySparse::apply_contact_to_scatra_structure(
 {
   auto scatra_structure_matrix_sparse =
       Core::LinAlg::cast_to_sparse_matrix_and_check_success(scatra_structure_matrix);
-  scatra_structure_matrix_sparse->un_complete();
 
   const auto& scatra_struct_matrix =
       nitsche_strategy_ssi()->get_matrix_block_ptr(CONTACT::MatBlockType::scatra_displ);
@@ -125,7 +124,6 @@ void SSI::ContactStrategySparse::apply_contact_to_structure_scatra(
 {
   auto structure_scatra_matrix_sparse =
       Core::LinAlg::cast_to_sparse_matrix_and_check_success(structure_scatra_matrix);
-  structure_scatra_matrix_sparse->un_complete();
 
   const auto& struct_scatra_matrix =
       nitsche_strategy_ssi()->get_matrix_block_ptr(CONTACT::MatBlockType::displ_scatra);
@@ -70,13 +70,8 @@ SSI::SsiMono::SsiMono(MPI_Comm comm, const Teuchos::ParameterList& globaltimepar
  *-------------------------------------------------------------------------------*/
 void SSI::SsiMono::apply_contact_to_sub_problems()
 {
-  // uncomplete matrices; we need to do this here since in contact simulations the dofs that
-  // interact with each other can change and thus the graph of the matrix can also change.
-  ssi_matrices_->scatra_matrix()->un_complete();
-  ssi_matrices_->scatra_structure_matrix()->un_complete();
-  ssi_matrices_->structure_scatra_matrix()->un_complete();
-
-  // add contributions
+  // add contributions; the dofs that are in contact can change, but the matrices are only
+  // uncompleted by add() if the contact contributions do not fit into their current graph
   strategy_contact_->apply_contact_to_scatra_residual(ssi_vectors_->scatra_residual());
   strategy_contact_->apply_contact_to_scatra_scatra(ssi_matrices_->scatra_matrix());
   strategy_contact_->apply_contact_to_scatra_structure(ssi_matrices_->scatra_structure_matrix());
@@ -119,8 +114,9 @@ bool SSI::SsiMono::is_uncomplete_of_matrices_necessary_for_mesh_tying() const
     }
   }
 
-  // if we have at least one contact interface the dofs that are in contact can change and therefore
-  // also the matrices have to be uncompleted
+  // if we have at least one contact interface the dofs that are in contact can change. The
+  // meshtying condensation sums into the graph of the target matrices and cannot extend it, so the
+  // matrices have to be uncompleted
   return ssi_interface_contact();
 }
 
@@ -183,7 +183,7 @@ namespace SSI
 
     /*!
      * @note This is only necessary in the first iteration of the simulation, since only there the
-     * graph of the matrix changes
+     * graph of the matrix changes. Afterwards, the graphs are kept and only extended if needed.
      *
      * @return flag indicating if we need to uncomplete the matrices before adding the mesh tying
      * contributions.
@@ -72,7 +72,6 @@ void SSI::AssembleStrategyBlockBlock::assemble_scatra_scatra(
       Core::LinAlg::cast_to_block_sparse_matrix_base_and_check_success(systemmatrix);
   auto scatra_scatra_matrix_block =
       Core::LinAlg::cast_to_const_block_sparse_matrix_base_and_check_success(scatra_scatra_matrix);
-  systemmatrix_block->un_complete();
 
   // assemble blocks of scalar transport system matrix into global system matrix
   for (int iblock = 0; iblock < static_cast<int>(block_position_scatra().size()); ++iblock)
@@ -193,8 +192,6 @@ void SSI::AssembleStrategyBlockSparse::assemble_scatra_structure(
 
   auto& systemmatrix_block_scatra_struct =
       systemmatrix_block->matrix(block_position_scatra().at(0), position_structure());
-  systemmatrix_block_scatra_struct.un_complete();
-
   systemmatrix_block_scatra_struct.add(*scatra_structure_matrix_sparse, false, 1.0, 1.0);
 }
 
@@ -298,7 +295,6 @@ void SSI::AssembleStrategyBlockSparse::assemble_structure_scatra(
 
   auto& systemmatrix_block_struct_scatra =
       systemmatrix_block->matrix(position_structure(), block_position_scatra().at(0));
-  systemmatrix_block_struct_scatra.un_complete();
   systemmatrix_block_struct_scatra.add(*structure_scatra_matrix_sparse, false, 1.0, 1.0);
 }
 
@@ -504,7 +504,8 @@ std::shared_ptr<Core::LinAlg::BlockSparseMatrixBase> SSI::Utils::SSIMatrices::se
 {
   const int expected_entries_per_row = 81;
   const bool explicitdirichlet = false;
-  const bool savegraph = true;
+  // Dirichlet conditions do not remove entries, so the graph survives zero() without a copy
+  const bool savegraph = false;
 
   return std::make_shared<
       Core::LinAlg::BlockSparseMatrix<Core::LinAlg::DefaultBlockMatrixStrategy>>(
@@ -518,7 +519,8 @@ std::shared_ptr<Core::LinAlg::SparseMatrix> SSI::Utils::SSIMatrices::setup_spars
 {
   const int expected_entries_per_row = 27;
   const bool explicitdirichlet = false;
-  const bool savegraph = true;
+  // Dirichlet conditions do not remove entries, so the graph survives zero() without a copy
+  const bool savegraph = false;
 
   return std::make_shared<Core::LinAlg::SparseMatrix>(
       row_map, expected_entries_per_row, explicitdirichlet, savegraph);
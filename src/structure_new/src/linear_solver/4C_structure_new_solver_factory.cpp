@@ -429,6 +429,11 @@ std::shared_ptr<Core::LinAlg::Solver> Solid::SOLVER::Factory::build_cardiovascul
       actdis.compute_null_space_if_necessary(linsolver->params().sublist("Inverse2"), true);
       break;
     }
+    case Inpar::Cardiovascular0D::cardvasc0dsolve_schur:
+      FOUR_C_THROW(
+          "The Schur complement solver for 0D cardiovascular-structural problems is only "
+          "available with INT_STRATEGY Old!");
+      break;
     default:
       FOUR_C_THROW("Unknown 0D cardiovascular-structural solution technique!");
   }
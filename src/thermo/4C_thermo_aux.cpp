@@ -7,6 +7,12 @@
 
 #include "4C_thermo_aux.hpp"
 
+#include "4C_comm_mpi_utils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 FOUR_C_NAMESPACE_OPEN
 
 
@@ -52,6 +58,55 @@ double Thermo::Aux::calculate_vector_norm(
 }  // calculate_vector_norm()
 
 
+/*----------------------------------------------------------------------*
+ | Gershgorin bound of the critical time step of forward Euler          |
+ *----------------------------------------------------------------------*/
+double Thermo::Aux::critical_time_step_forward_euler(const Core::LinAlg::SparseMatrix& conductivity,
+    const Core::LinAlg::Vector<double>& invcapa, const Epetra_Map& freedofs)
+{
+  if (not conductivity.filled()) FOUR_C_THROW("The conductivity matrix has to be completed.");
+
+  const Epetra_CrsMatrix& matrix = *conductivity.epetra_matrix();
+
+  double mylambda = 0.0;
+  for (int lid = 0; lid < matrix.NumMyRows(); ++lid)
+  {
+    const int gid = matrix.RowMap().GID(lid);
+    if (not freedofs.MyGID(gid)) continue;
+
+    const int capalid = invcapa.Map().LID(gid);
+    if (capalid < 0) FOUR_C_THROW("Dof %d is not part of the capacity vector.", gid);
+
+    int numentries = 0;
+    double* values = nullptr;
+    matrix.ExtractMyRowView(lid, numentries, values);
+
+    double rowsum = 0.0;
+    for (int entry = 0; entry < numentries; ++entry) rowsum += std::abs(values[entry]);
+
+    mylambda = std::max(mylambda, std::abs(invcapa[capalid]) * rowsum);
+  }
+
+  double lambda = 0.0;
+  Core::Communication::max_all(&mylambda, &lambda, 1, invcapa.Comm());
+
+  if (lambda <= 0.0) return std::numeric_limits<double>::max();
+  return 2.0 / lambda;
+}  // critical_time_step_forward_euler()
+
+
+/*----------------------------------------------------------------------*
+ | number of substeps below the critical time step                      |
+ *----------------------------------------------------------------------*/
+int Thermo::Aux::number_of_substeps(
+    const double interval, const double dtcrit, const double stabfactor)
+{
+  const double dtmax = stabfactor * dtcrit;
+  if (interval <= dtmax) return 1;
+  return static_cast<int>(std::ceil(interval / dtmax));
+}  // number_of_substeps()
+
+
 /*----------------------------------------------------------------------*/
 
 FOUR_C_NAMESPACE_CLOSE
@@ -15,6 +15,7 @@
 #include "4C_config.hpp"
 
 #include "4C_inpar_thermo.hpp"
+#include "4C_linalg_sparsematrix.hpp"
 #include "4C_linalg_vector.hpp"
 
 #include <memory>
@@ -35,6 +36,27 @@ namespace Thermo
         Core::LinAlg::Vector<double>& vect  //!< the vector of interest
     );
 
+    /*!
+     * \brief Lower bound of the critical time step of the forward Euler scheme
+     *
+     * The scheme is stable for \f$\Delta t < 2/\lambda_{max}\f$ with the largest eigenvalue of
+     * \f$C^{-1} K\f$. With the lumped capacity \f$C\f$ the Gershgorin circle theorem bounds it
+     * by \f$\lambda_{max} \le \max_i C_{ii}^{-1} \sum_j |K_{ij}|\f$, where only the rows of the
+     * free dofs are considered.
+     *
+     * \return the bound of the critical time step, or the largest double if the bound of
+     *         \f$\lambda_{max}\f$ vanishes
+     */
+    double critical_time_step_forward_euler(
+        const Core::LinAlg::SparseMatrix& conductivity,  //!< conductivity matrix K
+        const Core::LinAlg::Vector<double>& invcapa,     //!< inverse of lumped capacity
+        const Epetra_Map& freedofs                       //!< dofs without Dirichlet condition
+    );
+
+    //! Number of equal substeps of an interval, such that each of them is at most
+    //! stabfactor * dtcrit
+    int number_of_substeps(double interval, double dtcrit, double stabfactor);
+
   }  // namespace Aux
 
 }  // namespace Thermo
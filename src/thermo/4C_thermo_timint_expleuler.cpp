@@ -10,8 +10,11 @@
 #include "4C_io.hpp"
 #include "4C_linalg_utils_sparse_algebra_math.hpp"
 #include "4C_linear_solver_method_linalg.hpp"
+#include "4C_thermo_aux.hpp"
 #include "4C_thermo_ele_action.hpp"
 
+#include <limits>
+
 FOUR_C_NAMESPACE_OPEN
 
 
@@ -24,22 +27,51 @@ Thermo::TimIntExplEuler::TimIntExplEuler(const Teuchos::ParameterList& ioparams,
     std::shared_ptr<Core::IO::DiscretizationWriter> output)
     : TimIntExpl(ioparams, tdynparams, xparams, actdis, solver, output),
       fextn_(nullptr),
-      fintn_(nullptr)
+      fintn_(nullptr),
+      frimpn_(nullptr),
+      tempinc_(nullptr),
+      invcapa_(nullptr),
+      capasolverready_(false),
+      subcycling_(tdynparams.get<bool>("EXPLICIT_SUBCYCLING")),
+      stabfactor_(tdynparams.get<double>("EXPLICIT_STABILITY_FACTOR")),
+      dtcrit_(std::numeric_limits<double>::max()),
+      stabtempchange_(tdynparams.get<double>("EXPLICIT_STABILITY_TEMP_CHANGE")),
+      tempcrit_(nullptr)
 {
   // info to user
   if (myrank_ == 0)
   {
     std::cout << "with forward Euler" << std::endl
               << "lumping activated: " << (lumpcapa_ ? "true" : "false") << std::endl
+              << "subcycling activated: " << (subcycling_ ? "true" : "false") << std::endl
               << std::endl;
   }
 
+  if (subcycling_ and not lumpcapa_)
+    FOUR_C_THROW("Subcycling of the explicit Euler scheme requires a lumped capacity matrix.");
+  if (stabfactor_ <= 0.0 or stabfactor_ > 1.0)
+    FOUR_C_THROW("The stability factor has to be in (0,1], got %f.", stabfactor_);
+  if (stabtempchange_ < 0.0)
+    FOUR_C_THROW("The temperature change has to be non-negative, got %f.", stabtempchange_);
+
   // determine capacity
   determine_capa_consist_temp_rate();
 
   // allocate force vectors
   fextn_ = Core::LinAlg::create_vector(*discret_->dof_row_map(), true);
   fintn_ = Core::LinAlg::create_vector(*discret_->dof_row_map(), true);
+  frimpn_ = Core::LinAlg::create_vector(*discret_->dof_row_map(), true);
+  tempinc_ = Core::LinAlg::create_vector(*discret_->dof_row_map(), true);
+
+  // the capacity matrix is constant, hence the inverse of its lumped version is stored once and
+  // every step only needs the evaluation of the internal force vector
+  if (lumpcapa_ and tang_ != nullptr)
+  {
+    invcapa_ = Core::LinAlg::create_vector(tang_->row_map(), true);
+    tang_->extract_diagonal_copy(*invcapa_);
+    if (invcapa_->Reciprocal(*invcapa_) != 0)
+      FOUR_C_THROW("The lumped capacity matrix has zero entries on its diagonal.");
+  }
 
   // let it rain
   return;
@@ -53,80 +85,147 @@ Thermo::TimIntExplEuler::TimIntExplEuler(const Teuchos::ParameterList& ioparams,
 void Thermo::TimIntExplEuler::integrate_step()
 {
   const double dt = (*dt_)[0];  // \f$\Delta t_{n}\f$
+  const double timeend = (*time_)[0] + dt;
 
-  // new displacements \f$D_{n+}\f$
-  // T_{n+1} = T_n + dt * r_n
   tempn_->Update(1.0, *(*temp_)(0), 0.0);
-  tempn_->Update(dt, *(*rate_)(0), 1.0);
+  raten_->Update(1.0, *(*rate_)(0), 0.0);
+
+  // split the step into substeps below the critical time step of the scheme
+  int numsubsteps = 1;
+  if (subcycling_)
+  {
+    update_critical_time_step((*time_)[0], dt);
+    numsubsteps = Aux::number_of_substeps(dt, dtcrit_, stabfactor_);
+  }
+
+  double timesub = (*time_)[0];
+  for (int substep = 0; substep < numsubsteps; ++substep)
+  {
+    // the critical time step depends on the temperature via the material parameters, hence the
+    // remaining interval is split anew whenever the critical time step is estimated again
+    if (subcycling_ and substep > 0 and update_critical_time_step(timesub, dt))
+      numsubsteps = substep + Aux::number_of_substeps(timeend - timesub, dtcrit_, stabfactor_);
+
+    const double dtsub = (timeend - timesub) / (numsubsteps - substep);
+    timesub += dtsub;
+
+    // new temperatures
+    // T_{n+1} = T_n + dt * r_n
+    tempinc_->Update(-1.0, *tempn_, 0.0);
+    tempn_->Update(dtsub, *raten_, 1.0);
+
+    // apply Dirichlet BCs
+    apply_dirichlet_bc(timesub, tempn_, nullptr, false);
+
+    // temperature increment in substep
+    tempinc_->Update(1.0, *tempn_, 1.0);
+
+    evaluate_temperature_rate(timesub, dtsub);
+  }
+
+  // wassup?
+  return;
+
+}  // IntegrateStep()
 
-  // apply Dirichlet BCs
-  apply_dirichlet_bc(timen_, tempn_, raten_, false);
 
+/*----------------------------------------------------------------------*
+ | temperature rate at the current temperature                          |
+ *----------------------------------------------------------------------*/
+void Thermo::TimIntExplEuler::evaluate_temperature_rate(const double time, const double dt)
+{
   // build new external forces
   fextn_->PutScalar(0.0);
-  apply_force_external(timen_, tempn_, *fextn_);
+  apply_force_external(time, tempn_, *fextn_);
 
   // interface forces to external forces
   fextn_->Update(1.0, *fifc_, 1.0);
 
-  // TIMING
-  // double dtcpu = timer_->WallTime();
-
   // initialise internal forces
   fintn_->PutScalar(0.0);
 
-  // ordinary internal force and conductivity matrix
+  // ordinary internal force, no conductivity matrix is assembled
   {
-    // temperature increment in step
-    std::shared_ptr<Core::LinAlg::Vector<double>> tempinc =
-        std::make_shared<Core::LinAlg::Vector<double>>(*tempn_);
-    tempinc->Update(-1.0, *(*temp_)(0), 1.0);
     // create an empty parameter list for the discretisation
     Teuchos::ParameterList p;
     // internal force
-    apply_force_internal(p, timen_, dt, tempn_, tempinc, fintn_);
+    apply_force_internal(p, time, dt, tempn_, tempinc_, fintn_);
   }
 
   // determine time derivative of capacity vector, ie \f$\dot{P} = C . \dot{T}_{n=1}\f$
-  std::shared_ptr<Core::LinAlg::Vector<double>> frimpn =
-      Core::LinAlg::create_vector(*discret_->dof_row_map(), true);
-  frimpn->Update(1.0, *fextn_, -1.0, *fintn_, 0.0);
+  frimpn_->Update(1.0, *fextn_, -1.0, *fintn_, 0.0);
 
   // obtain new temperature rates \f$R_{n+1}\f$
+  if (invcapa_ != nullptr)
+  {
+    // R_{n+1} = C^{-1} . ( -fint + fext )
+    raten_->Multiply(1.0, *invcapa_, *frimpn_, 0.0);
+  }
+  else
   {
     FOUR_C_ASSERT(tang_->filled(), "capacity matrix has to be completed");
-    // get accelerations
     raten_->PutScalar(0.0);
+
+    // the capacity matrix is constant, hence the solver is only set up during the first solve
+    Core::LinAlg::SolverParams solver_params;
+    solver_params.reset = not capasolverready_;
+    solver_->solve(tang_->epetra_operator(), raten_, frimpn_, solver_params);
+    capasolverready_ = true;
   }
 
-  if ((lumpcapa_ == false) or
-      (std::dynamic_pointer_cast<Core::LinAlg::SparseMatrix>(tang_) == nullptr))
+  // apply Dirichlet BCs on temperature rates
+  apply_dirichlet_bc(time, nullptr, raten_, false);
+}  // evaluate_temperature_rate()
+
+
+/*----------------------------------------------------------------------*
+ | estimate the critical time step                                      |
+ *----------------------------------------------------------------------*/
+double Thermo::TimIntExplEuler::estimate_critical_time_step(const double time, const double dt)
+{
+  // conductivity matrix at the current temperature
+  std::shared_ptr<Core::LinAlg::SparseMatrix> conductivity =
+      std::make_shared<Core::LinAlg::SparseMatrix>(*discret_->dof_row_map(), 81, true, true);
+  std::shared_ptr<Core::LinAlg::Vector<double>> fint =
+      Core::LinAlg::create_vector(*discret_->dof_row_map(), true);
   {
-    // refactor==false: This is not necessary, because we always
-    // use the same constant capacity matrix, which was firstly factorised
-    // in TimInt::determine_capa_consist_temp_rate
-    Core::LinAlg::SolverParams solver_params;
-    solver_params.reset = true;
-    solver_->solve(tang_->epetra_operator(), raten_, frimpn, solver_params);
+    Teuchos::ParameterList p;
+    apply_force_tang_internal(p, time, dt, tempn_, zeros_, fint, conductivity);
+  }
+  conductivity->complete();
+
+  // prescribed temperatures do not take part in the explicit update
+  return Aux::critical_time_step_forward_euler(*conductivity, *invcapa_, *dbcmaps_->other_map());
+}  // estimate_critical_time_step()
+
+
+/*----------------------------------------------------------------------*
+ | estimate the critical time step again if necessary                   |
+ *----------------------------------------------------------------------*/
+bool Thermo::TimIntExplEuler::update_critical_time_step(const double time, const double dt)
+{
+  if (tempcrit_ == nullptr)
+  {
+    tempcrit_ = Core::LinAlg::create_vector(*discret_->dof_row_map(), true);
   }
-  // direct inversion based on lumped capacity matrix
   else
   {
-    // extract the diagonal values of the mass matrix
-    std::shared_ptr<Core::LinAlg::Vector<double>> diag = Core::LinAlg::create_vector(
-        (std::dynamic_pointer_cast<Core::LinAlg::SparseMatrix>(tang_))->row_map());
-    (std::dynamic_pointer_cast<Core::LinAlg::SparseMatrix>(tang_))->extract_diagonal_copy(*diag);
-    // R_{n+1} = C^{-1} . ( -fint + fext )
-    raten_->ReciprocalMultiply(1.0, *diag, *frimpn, 0.0);
+    // relative change of the temperature since the last estimate
+    Core::LinAlg::Vector<double> tempchange(*tempn_);
+    tempchange.Update(-1.0, *tempcrit_, 1.0);
+    double changenorm = 0.0;
+    double tempnorm = 0.0;
+    tempchange.NormInf(&changenorm);
+    tempcrit_->NormInf(&tempnorm);
+    if (changenorm <= stabtempchange_ * (1.0 + tempnorm)) return false;
   }
 
-  // apply Dirichlet BCs on temperature rates
-  apply_dirichlet_bc(timen_, nullptr, raten_, false);
-
-  // wassup?
-  return;
+  tempcrit_->Update(1.0, *tempn_, 0.0);
+  dtcrit_ = estimate_critical_time_step(time, dt);
+  if (myrank_ == 0) std::cout << "estimated critical time step: " << dtcrit_ << std::endl;
 
-}  // IntegrateStep()
+  return true;
+}  // update_critical_time_step()
 
 
 /*----------------------------------------------------------------------*
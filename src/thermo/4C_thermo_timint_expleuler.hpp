@@ -75,6 +75,18 @@ namespace Thermo
     //! Update Element
     void update_step_element() override;
 
+    //! Evaluate the temperature rate \f$R = C^{-1} (F_{ext} - F_{int})\f$ at the current
+    //! temperature #tempn_
+    void evaluate_temperature_rate(double time, double dt);
+
+    //! Estimate the critical time step of the scheme with the lumped capacity matrix at the
+    //! current temperature #tempn_
+    double estimate_critical_time_step(double time, double dt);
+
+    //! Estimate the critical time step again if the temperature changed by more than the
+    //! prescribed relative amount since the last estimate, return true if it was estimated
+    bool update_critical_time_step(double time, double dt);
+
     //@}
 
     //! @name Attribute access functions
@@ -130,6 +142,23 @@ namespace Thermo
                                                            //!< \f$F_{int;n+1}\f$
     std::shared_ptr<Core::LinAlg::Vector<double>> fintn_;  //!< internal force
                                                            //!< \f$F_{int;n+1}\f$
+    std::shared_ptr<Core::LinAlg::Vector<double>> frimpn_;   //!< F_{ext;n+1} - F_{int;n+1}
+    std::shared_ptr<Core::LinAlg::Vector<double>> tempinc_;  //!< temperature increment
+    //@}
+
+    //! @name Capacity
+    //@{
+    std::shared_ptr<Core::LinAlg::Vector<double>> invcapa_;  //!< inverse of lumped capacity
+    bool capasolverready_;  //!< solver of consistent capacity matrix is set up
+    //@}
+
+    //! @name Subcycling
+    //@{
+    bool subcycling_;        //!< split steps into substeps below the critical time step
+    double stabfactor_;      //!< safety factor on the critical time step
+    double dtcrit_;          //!< estimated critical time step
+    double stabtempchange_;  //!< relative temperature change triggering a new estimate
+    std::shared_ptr<Core::LinAlg::Vector<double>> tempcrit_;  //!< temperature at last estimate
     //@}
 
   };  // class TimIntExplEuler
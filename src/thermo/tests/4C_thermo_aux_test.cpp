@@ -0,0 +1,130 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_thermo_aux.hpp"
+
+#include "4C_comm_mpi_utils.hpp"
+
+#include <Epetra_Map.h>
+
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  /** Bar of linear elements with conductivity k, capacity c and element length h, the
+   *  temperature is prescribed at the first node.
+   *
+   *  The element matrices are K_e = k/h |  1 -1 |, the lumped capacity is c h at the interior
+   *                                     | -1  1 |
+   *  nodes and c h / 2 at the end nodes. Hence, every free row of C^{-1} K sums up to 4 k / (c h^2)
+   *  in absolute value.
+   */
+  class ForwardEulerBarTest : public testing::Test
+  {
+   protected:
+    static constexpr int numele = 20;
+    static constexpr double k = 2.0;
+    static constexpr double c = 3.0;
+    static constexpr double h = 0.1;
+
+    ForwardEulerBarTest()
+        : rowmap_(numele + 1, 0, Core::Communication::as_epetra_comm(MPI_COMM_WORLD)),
+          conductivity_(rowmap_, 3, false, true),
+          invcapa_(rowmap_, true)
+    {
+      for (int ele = 0; ele < numele; ++ele)
+      {
+        for (int i = 0; i < 2; ++i)
+        {
+          const int row = ele + i;
+          if (not rowmap_.MyGID(row)) continue;
+          conductivity_.assemble(k / h, row, row);
+          conductivity_.assemble(-k / h, row, ele + 1 - i);
+        }
+      }
+      conductivity_.complete();
+
+      for (int lid = 0; lid < rowmap_.NumMyElements(); ++lid)
+      {
+        const int gid = rowmap_.GID(lid);
+        invcapa_[lid] = (gid == 0 or gid == numele) ? 2.0 / (c * h) : 1.0 / (c * h);
+        if (gid != 0) freegids_.push_back(gid);
+      }
+    }
+
+    //! Dofs without Dirichlet condition
+    Epetra_Map free_dofs() const
+    {
+      return Epetra_Map(-1, freegids_.size(), freegids_.data(), 0, rowmap_.Comm());
+    }
+
+    //! Forward Euler steps T <- T - dt C^{-1} K T starting from an oscillating temperature,
+    //! return the maximum norm of the final temperature
+    double integrate(const double dt, const int numsteps)
+    {
+      Core::LinAlg::Vector<double> temp(rowmap_, true);
+      Core::LinAlg::Vector<double> rate(rowmap_, true);
+      for (int lid = 0; lid < rowmap_.NumMyElements(); ++lid)
+      {
+        const int gid = rowmap_.GID(lid);
+        temp[lid] = (gid == 0) ? 0.0 : (gid % 2 == 0 ? 1.0 : -1.0);
+      }
+
+      for (int step = 0; step < numsteps; ++step)
+      {
+        conductivity_.multiply(false, temp, rate);
+        rate.Multiply(-1.0, invcapa_, rate, 0.0);
+        temp.Update(dt, rate, 1.0);
+        if (rowmap_.MyGID(0)) temp[rowmap_.LID(0)] = 0.0;
+      }
+
+      double norm = 0.0;
+      temp.NormInf(&norm);
+      return norm;
+    }
+
+    Epetra_Map rowmap_;
+    Core::LinAlg::SparseMatrix conductivity_;
+    Core::LinAlg::Vector<double> invcapa_;
+    std::vector<int> freegids_;
+  };
+
+  TEST_F(ForwardEulerBarTest, GershgorinBoundOfCriticalTimeStep)
+  {
+    const Epetra_Map freedofs = free_dofs();
+
+    // dt_crit = 2 / (4 k / (c h^2))
+    const double dtcrit =
+        Thermo::Aux::critical_time_step_forward_euler(conductivity_, invcapa_, freedofs);
+    EXPECT_NEAR(dtcrit, c * h * h / (2.0 * k), 1.0e-14);
+  }
+
+  TEST_F(ForwardEulerBarTest, SubstepsOfUnstableStepAreStable)
+  {
+    const Epetra_Map freedofs = free_dofs();
+    const double dtcrit =
+        Thermo::Aux::critical_time_step_forward_euler(conductivity_, invcapa_, freedofs);
+
+    // steps below the scaled critical time step are not split
+    EXPECT_EQ(Thermo::Aux::number_of_substeps(0.5 * dtcrit, dtcrit, 0.8), 1);
+    EXPECT_EQ(Thermo::Aux::number_of_substeps(0.8 * dtcrit, dtcrit, 0.8), 1);
+
+    // a step of three times the critical time step amplifies the oscillation ...
+    const double dt = 3.0 * dtcrit;
+    EXPECT_GT(integrate(dt, 5), 1.0e2);
+
+    // ... while its substeps of 0.75 dt_crit are a convex combination of neighboring temperatures
+    // and the oscillation decays
+    const int numsubsteps = Thermo::Aux::number_of_substeps(dt, dtcrit, 0.8);
+    EXPECT_EQ(numsubsteps, 4);
+    EXPECT_LT(integrate(dt / numsubsteps, 5 * numsubsteps), 1.0);
+  }
+}  // namespace
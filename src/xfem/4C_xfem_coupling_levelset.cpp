@@ -487,11 +487,17 @@ bool XFEM::LevelSetCoupling::set_level_set_field(const double time)
       std::dynamic_pointer_cast<XFEM::DiscretizationXFEM>(cutter_dis_)
           ->set_initial_state(0, "pres", modphinp);
 
+      // the mass matrix of the cutter discretization is assembled and factorized only once
+      if (gradphi_projection_ == nullptr)
+      {
+        gradphi_projection_ = std::make_shared<Core::FE::NodalL2Projection>(
+            Global::Problem::instance()->solver_params(l2_proj_num),
+            Global::Problem::instance()->solver_params_callback());
+      }
+
       // Lives on NodeRow-map!!!
-      const auto& solverparams = Global::Problem::instance()->solver_params(l2_proj_num);
       std::shared_ptr<Core::LinAlg::MultiVector<double>> gradphinp_smoothed_rownode =
-          Core::FE::compute_nodal_l2_projection(*cutter_dis_, "pres", 3, eleparams, solverparams,
-              Global::Problem::instance()->solver_params_callback());
+          gradphi_projection_->project(*cutter_dis_, "pres", 3, eleparams);
       if (gradphinp_smoothed_rownode == nullptr)
         FOUR_C_THROW("A smoothed grad phi is required, but an empty one is provided!");
 
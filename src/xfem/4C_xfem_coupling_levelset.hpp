@@ -23,6 +23,11 @@ namespace Cut
   class CutWizard;
 }
 
+namespace Core::FE
+{
+  class NodalL2Projection;
+}
+
 namespace XFEM
 {
   /*!
@@ -133,6 +138,9 @@ namespace XFEM
     std::shared_ptr<Core::LinAlg::MultiVector<double>> gradphinp_smoothed_node_;
     // std::shared_ptr<Core::LinAlg::MultiVector<double>>   gradphi2np_smoothed_node_;
 
+    //! L2 projection of the smoothed gradient (keeps the mass matrix of the fixed cutter-dis)
+    std::shared_ptr<Core::FE::NodalL2Projection> gradphi_projection_;
+
     //! and column versions
     std::shared_ptr<Core::LinAlg::Vector<double>> curvaturenp_node_col_;
     std::shared_ptr<Core::LinAlg::MultiVector<double>> gradphinp_smoothed_node_col_;
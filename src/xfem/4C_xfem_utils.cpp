@@ -17,6 +17,8 @@
 #include "4C_material_base.hpp"
 #include "4C_rebalance_binning_based.hpp"
 
+#include <algorithm>
+
 FOUR_C_NAMESPACE_OPEN
 
 void XFEM::Utils::extract_node_vectors(Core::FE::Discretization& dis,
@@ -185,4 +187,42 @@ void XFEM::Utils::extract_quantity_at_node(Core::LinAlg::SerialDenseMatrix::Base
   Core::LinAlg::copy(local_vector.data(), element_vector);
 }
 
+
+//! Enlarged bounding box of nodal positions
+void XFEM::Utils::enlarged_bounding_box(const Core::LinAlg::SerialDenseMatrix& xyz,
+    const int numnode, const double enlargement, double* box)
+{
+  if (numnode < 1) FOUR_C_THROW("bounding box of %d nodes requested", numnode);
+
+  double size = 0.0;
+  for (int idim = 0; idim < 3; ++idim)
+  {
+    box[2 * idim] = xyz(idim, 0);
+    box[2 * idim + 1] = xyz(idim, 0);
+    for (int inode = 1; inode < numnode; ++inode)
+    {
+      box[2 * idim] = std::min(box[2 * idim], xyz(idim, inode));
+      box[2 * idim + 1] = std::max(box[2 * idim + 1], xyz(idim, inode));
+    }
+    size = std::max(size, box[2 * idim + 1] - box[2 * idim]);
+  }
+
+  for (int idim = 0; idim < 3; ++idim)
+  {
+    box[2 * idim] -= enlargement * size;
+    box[2 * idim + 1] += enlargement * size;
+  }
+}
+
+
+//! Check if a point lies in a bounding box
+bool XFEM::Utils::in_bounding_box(const double* box, const Core::LinAlg::Matrix<3, 1>& x)
+{
+  for (int idim = 0; idim < 3; ++idim)
+  {
+    if (x(idim) < box[2 * idim] or x(idim) > box[2 * idim + 1]) return false;
+  }
+  return true;
+}
+
 FOUR_C_NAMESPACE_CLOSE
@@ -68,6 +68,19 @@ namespace XFEM
         const Core::Nodes::Node* node, const Core::LinAlg::MultiVector<double>& global_col_vector,
         Core::FE::Discretization& dis, const int nds_vector, const unsigned int nsd);
 
+    /*!
+    \brief Bounding box (xmin,xmax,ymin,ymax,zmin,zmax) of the first numnode nodal positions xyz
+           (3 x numnode), enlarged in each direction by a fraction of the maximal extent
+
+    The nodes of quadratic elements do not bound the element, the enlargement covers the parts of
+    the element outside of the nodal box.
+     */
+    void enlarged_bounding_box(const Core::LinAlg::SerialDenseMatrix& xyz, const int numnode,
+        const double enlargement, double* box);
+
+    //! check if a point lies in a bounding box given as (xmin,xmax,ymin,ymax,zmin,zmax)
+    bool in_bounding_box(const double* box, const Core::LinAlg::Matrix<3, 1>& x);
+
   }  // namespace Utils
 }  // namespace XFEM
 
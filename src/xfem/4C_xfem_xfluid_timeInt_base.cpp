@@ -9,6 +9,7 @@
 
 #include "4C_bele_bele3.hpp"
 #include "4C_comm_exporter.hpp"
+#include "4C_comm_mpi_utils.hpp"
 #include "4C_comm_pack_helpers.hpp"
 #include "4C_cut_cutwizard.hpp"
 #include "4C_cut_elementhandle.hpp"
@@ -24,6 +25,9 @@
 #include "4C_io_gmsh.hpp"
 #include "4C_linalg_utils_sparse_algebra_math.hpp"
 #include "4C_xfem_dofset.hpp"
+#include "4C_xfem_utils.hpp"
+
+#include <algorithm>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -469,7 +473,24 @@ void XFEM::XfluidTimeintBase::call_x_to_xi_coords(
     bool& pointInDomain                  /// lies point in element ?
 ) const
 {
-  Core::LinAlg::SerialDenseMatrix xyz(3, ele->num_node(), true);
+  Core::LinAlg::SerialDenseMatrix xyz;
+  element_position_array(ele, state, xyz);
+
+  call_x_to_xi_coords(xyz, ele->shape(), x, xi, pointInDomain);
+}  // end function call_x_to_xi_coords
+
+
+
+/*------------------------------------------------------------------------------------------------*
+ * node coordinates of an element w.r.t. the given state                                          *
+ *------------------------------------------------------------------------------------------------*/
+void XFEM::XfluidTimeintBase::element_position_array(
+    const Core::Elements::Element* ele,   /// pointer to element
+    const std::string state,              ///< state dispn or dispnp?
+    Core::LinAlg::SerialDenseMatrix& xyz  /// node coordinates of element
+) const
+{
+  xyz.shape(3, ele->num_node());
   Core::Geo::fill_initial_position_array(ele, xyz);
 
   // add ale displacements to initial position
@@ -492,7 +513,7 @@ void XFEM::XfluidTimeintBase::call_x_to_xi_coords(
     else if (state == "dispn")
       Core::FE::extract_my_values(*dispn_, mydispnp, la[0].lm_);
     else
-      FOUR_C_THROW("XFEM::XfluidTimeintBase::call_x_to_xi_coords: Undefined state!");
+      FOUR_C_THROW("XFEM::XfluidTimeintBase::element_position_array: Undefined state!");
 
     for (int inode = 0; inode < nen; ++inode)  // number of nodes
     {
@@ -504,9 +525,7 @@ void XFEM::XfluidTimeintBase::call_x_to_xi_coords(
       }
     }
   }
-
-  call_x_to_xi_coords(xyz, ele->shape(), x, xi, pointInDomain);
-}  // end function call_x_to_xi_coords
+}  // end function element_position_array
 
 
 
@@ -813,6 +832,46 @@ void XFEM::XfluidTimeintBase::send_data(Core::Communication::PackBuffer& dataSen
 
 
 
+/*------------------------------------------------------------------------------------------------*
+ * send individual data to all procs and receive the data of all procs                            *
+ *------------------------------------------------------------------------------------------------*/
+void XFEM::XfluidTimeintBase::send_data_to_all(
+    std::vector<Core::Communication::PackBuffer>& dataSend, std::vector<char>& dataRecv) const
+{
+  if (static_cast<int>(dataSend.size()) != numproc_)
+    FOUR_C_THROW("expected one send buffer per processor, got %d", (int)dataSend.size());
+
+  MPI_Comm comm = discret_->get_comm();
+
+  // concatenate the blocks for all procs
+  std::vector<int> sendcounts(numproc_);
+  std::vector<int> sdispls(numproc_ + 1, 0);
+  std::vector<char> sendbuf;
+  for (int proc = 0; proc < numproc_; ++proc)
+  {
+    sendcounts[proc] = static_cast<int>(dataSend[proc]().size());
+    sdispls[proc + 1] = sdispls[proc] + sendcounts[proc];
+    sendbuf.insert(sendbuf.end(), dataSend[proc]().begin(), dataSend[proc]().end());
+  }
+
+  // communicate the sizes of the blocks
+  std::vector<int> recvcounts(numproc_);
+  int status = MPI_Alltoall(sendcounts.data(), 1, MPI_INT, recvcounts.data(), 1, MPI_INT, comm);
+  if (status != MPI_SUCCESS) FOUR_C_THROW("MPI_Alltoall returned status=%d", status);
+
+  std::vector<int> rdispls(numproc_ + 1, 0);
+  for (int proc = 0; proc < numproc_; ++proc) rdispls[proc + 1] = rdispls[proc] + recvcounts[proc];
+
+  // communicate the blocks
+  dataRecv.clear();
+  dataRecv.resize(rdispls.back());
+  status = MPI_Alltoallv(sendbuf.data(), sendcounts.data(), sdispls.data(), MPI_CHAR,
+      dataRecv.data(), recvcounts.data(), rdispls.data(), MPI_CHAR, comm);
+  if (status != MPI_SUCCESS) FOUR_C_THROW("MPI_Alltoallv returned status=%d", status);
+}  // end send_data_to_all
+
+
+
 /*------------------------------------------------------------------------------------------------*
  * packing a node for parallel communication only with the basic nodal data                       *
  * without an underlying discretization fitting to the node's new prozessor          schott 07/12 *
@@ -1024,6 +1083,12 @@ void XFEM::XfluidStd::element_search(
 {
   // REMARK: if ele!= nullptr, then check that element first, before loop all row elements
 
+  found = false;
+
+  // use the bounding boxes only if they fit to the current row elements
+  const bool use_boxes =
+      (ele_boxes_.size() == 6 * static_cast<std::size_t>(discret_->num_my_row_elements()));
+
   int startid;  // local row element id
   if (ele == nullptr)
     startid = 0;  // start with first local row element
@@ -1044,7 +1109,12 @@ void XFEM::XfluidStd::element_search(
       ele = nullptr;  // reset ele, ele will be set if an element is found finally
     }
     else
+    {
+      // skip all elements whose bounding box does not contain the point
+      if (use_boxes and !XFEM::Utils::in_bounding_box(&ele_boxes_[6 * ieleid], x)) continue;
+
       currele = discret_->l_row_element(ieleid);
+    }
 
     call_x_to_xi_coords(currele, x, xi, "dispn", found);
 
@@ -1060,6 +1130,89 @@ void XFEM::XfluidStd::element_search(
 
 
 
+/*------------------------------------------------------------------------------------------------*
+ * compute the bounding boxes of the row elements and of all processors                           *
+ *------------------------------------------------------------------------------------------------*/
+void XFEM::XfluidStd::setup_element_search_boxes()
+{
+  // the nodes of quadratic elements do not bound the element and points within the tolerance of
+  // the local coordinates are accepted, hence the boxes are enlarged by a part of the element size
+  const double enlargement = 0.1;
+
+  const int numele = discret_->num_my_row_elements();
+  ele_boxes_.assign(6 * numele, 0.0);
+
+  // box of all row elements of this proc (empty if there are no row elements)
+  std::vector<double> procbox;
+
+  Core::LinAlg::SerialDenseMatrix xyz;
+  for (int iele = 0; iele < numele; ++iele)
+  {
+    const Core::Elements::Element* ele = discret_->l_row_element(iele);
+    element_position_array(ele, "dispn", xyz);
+
+    double* box = &ele_boxes_[6 * iele];
+    XFEM::Utils::enlarged_bounding_box(xyz, ele->num_node(), enlargement, box);
+
+    if (procbox.empty())
+      procbox.assign(box, box + 6);
+    else
+    {
+      for (int idim = 0; idim < 3; ++idim)
+      {
+        procbox[2 * idim] = std::min(procbox[2 * idim], box[2 * idim]);
+        procbox[2 * idim + 1] = std::max(procbox[2 * idim + 1], box[2 * idim + 1]);
+      }
+    }
+  }
+
+  proc_boxes_ = Core::Communication::all_gather(procbox, discret_->get_comm());
+}  // end setup_element_search_boxes
+
+
+
+/*------------------------------------------------------------------------------------------------*
+ * remove the bounding boxes of the element search                                                *
+ *------------------------------------------------------------------------------------------------*/
+void XFEM::XfluidStd::clear_element_search_boxes()
+{
+  ele_boxes_.clear();
+  proc_boxes_.clear();
+}  // end clear_element_search_boxes
+
+
+
+/*------------------------------------------------------------------------------------------------*
+ * next processor in ring order that might contain a point not found on this proc                 *
+ *------------------------------------------------------------------------------------------------*/
+int XFEM::XfluidStd::next_search_proc(
+    const Core::LinAlg::Matrix<3, 1>& x,  /// point to be found
+    int& searchedProcs                    /// searched procs including the next proc
+) const
+{
+  // the next numcandidates procs in ring order have not searched the point yet
+  const int numcandidates = numproc_ - searchedProcs + 1;
+
+  if (static_cast<int>(proc_boxes_.size()) != numproc_) return (myrank_ + 1) % numproc_;
+
+  for (int offset = 1; offset <= numcandidates; ++offset)
+  {
+    const int proc = (myrank_ + offset) % numproc_;
+    if (!proc_boxes_[proc].empty() and XFEM::Utils::in_bounding_box(proc_boxes_[proc].data(), x))
+    {
+      // the skipped procs cannot contain the point and count as searched
+      searchedProcs += offset - 1;
+      return proc;
+    }
+  }
+
+  // no proc contains the point, the last candidate searches it and reports the failure
+  searchedProcs = numproc_;
+  return (myrank_ + numcandidates) % numproc_;
+}  // end next_search_proc
+
+
+
 /*------------------------------------------------------------------------------------------------*
  * interpolate velocity and derivatives for a point in an element                    schott 06/12 *
  *------------------------------------------------------------------------------------------------*/
@@ -514,6 +514,10 @@ namespace XFEM
     void send_data(Core::Communication::PackBuffer& dataSend, int& dest, int& source,
         std::vector<char>& dataRecv) const;
 
+    //! send individual data to each processor and receive the data of all processors
+    void send_data_to_all(std::vector<Core::Communication::PackBuffer>& dataSend,
+        std::vector<char>& dataRecv) const;
+
     //! packing a node
     void pack_node(Core::Communication::PackBuffer& dataSend, Core::Nodes::Node& node) const;
 
@@ -533,6 +537,12 @@ namespace XFEM
         bool& pointInDomain              /// lies point in element ?
     ) const;
 
+    //! node coordinates of an element w.r.t. the given state (reference, dispn or dispnp)
+    void element_position_array(const Core::Elements::Element* ele,  ///< pointer to element
+        const std::string state,                                    ///< state n or np?
+        Core::LinAlg::SerialDenseMatrix& xyz                        ///< node coordinates
+    ) const;
+
     //! call the computation of local coordinates for a polytop with corners given by the
     //! coordinates
     void call_x_to_xi_coords(
@@ -665,6 +675,13 @@ namespace XFEM
         bool& found                      ///< is element found?
     ) const;
 
+    //! compute the bounding boxes of the row elements at t^n and of all processors used to
+    //! filter the element search and to send points only to processors that might contain them
+    void setup_element_search_boxes();
+
+    //! remove the bounding boxes, the element search checks all row elements again
+    void clear_element_search_boxes();
+
     //! interpolate velocity and derivatives for a point in an element
     void get_gp_values(Core::Elements::Element* ele,  ///< pointer to element
         Core::LinAlg::Matrix<3, 1>& xi,               ///< local coordinates of point w.r.t element
@@ -940,6 +957,11 @@ namespace XFEM
     //! set the final startvalues with respect to a node for finding the Lagrangean origin
     void set_final_data();
 
+    //! next processor in ring order that might contain a point not found on this processor
+    int next_search_proc(const Core::LinAlg::Matrix<3, 1>& x,  ///< point to be found
+        int& searchedProcs  ///< number of searched procs, updated by the skipped procs
+    ) const;
+
     /*========================================================================*/
     //! time-integration variables
     /*========================================================================*/
@@ -952,6 +974,16 @@ namespace XFEM
 
     const double dt_;  //! time step size
 
+    /*========================================================================*/
+    //! element search
+    /*========================================================================*/
+
+    std::vector<double>
+        ele_boxes_;  //! bounding boxes of the row elements at t^n, 6 values per element
+
+    std::vector<std::vector<double>>
+        proc_boxes_;  //! bounding boxes of the row elements of all procs (empty if no elements)
+
   };  // class XFLUID_TIMEINT_STD
 
 }  // namespace XFEM
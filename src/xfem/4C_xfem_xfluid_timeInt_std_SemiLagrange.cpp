@@ -7,6 +7,7 @@
 
 #include "4C_xfem_xfluid_timeInt_std_SemiLagrange.hpp"
 
+#include "4C_comm_mpi_utils.hpp"
 #include "4C_comm_pack_helpers.hpp"
 #include "4C_cut_cutwizard.hpp"
 #include "4C_cut_elementhandle.hpp"
@@ -104,6 +105,9 @@ void XFEM::XfluidSemiLagrange::compute(
       << Core::IO::endl;
 #endif
 
+  // bounding boxes of the elements at t^n, the mesh does not change during the computation
+  setup_element_search_boxes();
+
   /*----------------------------------------------------*
    * first part: get the correct origin for the node    *
    * in a lagrangian point of view using a newton loop  *
@@ -472,6 +476,8 @@ void XFEM::XfluidSemiLagrange::compute(
   // now
   set_final_data();
 
+  clear_element_search_boxes();
+
 #ifdef FOUR_C_ENABLE_ASSERTIONS
   if (counter > 8 * numproc_)  // too much loops shouldnt be if all this works
     std::cout << "WARNING: semiLagrangeExtrapolation seems to run an infinite loop!" << std::endl;
@@ -1896,7 +1902,7 @@ void XFEM::XfluidSemiLagrange::export_alternativ_algo_data()
 
 
 /*------------------------------------------------------------------------------------------------*
- * export data while Newton loop to neighbour proc                                   schott 07/12 *
+ * export data while Newton loop to the next proc that might contain the point       schott 07/12 *
  *------------------------------------------------------------------------------------------------*/
 void XFEM::XfluidSemiLagrange::export_iter_data(bool& procDone)
 {
@@ -1908,74 +1914,55 @@ void XFEM::XfluidSemiLagrange::export_iter_data(bool& procDone)
 
   const int nsd = 3;  // 3 dimensions for a 3d fluid element
 
-  // Initialization
-  int dest = myrank_ + 1;  // destination proc (the "next" one)
-  if (myrank_ == (numproc_ - 1)) dest = 0;
-
-  int source = myrank_ - 1;  // source proc (the "last" one)
-  if (myrank_ == 0) source = numproc_ - 1;
-
-
   /*-------------------------------------------*
-   * first part: send procfinished in order to *
-   * check whether all procs have finished     *
+   * first part: check whether all procs have  *
+   * finished                                  *
    *-------------------------------------------*/
-  for (int iproc = 0; iproc < numproc_ - 1; iproc++)
-  {
-    Core::Communication::PackBuffer dataSend;
-
-    add_to_pack(dataSend, procDone);
-
-    std::vector<char> dataRecv;
-    send_data(dataSend, dest, source, dataRecv);
-
-    // pointer to current position of group of cells in global std::string (counts bytes)
-    bool allProcsDone;
-
-    // unpack received data
-    Core::Communication::UnpackBuffer buffer(dataRecv);
-    extract_from_pack(buffer, allProcsDone);
-
-    if (allProcsDone == false) procDone = false;
-
-    // processors wait for each other
-    Core::Communication::barrier(discret_->get_comm());
-  }
-
-  /*--------------------------------------*
-   * second part: if not all procs have   *
-   * finished send data to neighbour proc *
-   *--------------------------------------*/
+  int myProcDone = procDone ? 1 : 0;
+  int allProcsDone = 0;
+  Core::Communication::min_all(&myProcDone, &allProcsDone, 1, discret_->get_comm());
+  procDone = (allProcsDone == 1);
+
+  /*----------------------------------------*
+   * second part: if not all procs have     *
+   * finished send data to the next proc    *
+   * in ring order whose elements' bounding *
+   * box contains the point to be found     *
+   *----------------------------------------*/
   if (!procDone)
   {
-    Core::Communication::PackBuffer dataSend;
+    std::vector<Core::Communication::PackBuffer> dataSend(numproc_);
 
     for (std::vector<TimeIntData>::iterator data = timeIntData_->begin();
         data != timeIntData_->end(); data++)
     {
       if (data->state_ == TimeIntData::nextSL_)
       {
-        pack_node(dataSend, data->node_);
-        add_to_pack(dataSend, data->nds_np_);
-        add_to_pack(dataSend, data->vel_);
-        add_to_pack(dataSend, data->velDeriv_);
-        add_to_pack(dataSend, data->presDeriv_);
-        add_to_pack(dataSend, data->dispnp_);
-        add_to_pack(dataSend, data->initialpoint_);
-        add_to_pack(dataSend, data->initial_eid_);
-        add_to_pack(dataSend, data->initial_ele_owner_);
-        add_to_pack(dataSend, data->startpoint_);
-        add_to_pack(dataSend, data->searchedProcs_);
-        add_to_pack(dataSend, data->counter_);
-        add_to_pack(dataSend, data->type_);
+        // point that has not been found on this proc
+        const Core::LinAlg::Matrix<nsd, 1>& x =
+            (data->initial_eid_ == -1) ? data->initialpoint_ : data->startpoint_;
+        const int dest = next_search_proc(x, data->searchedProcs_);
+
+        pack_node(dataSend[dest], data->node_);
+        add_to_pack(dataSend[dest], data->nds_np_);
+        add_to_pack(dataSend[dest], data->vel_);
+        add_to_pack(dataSend[dest], data->velDeriv_);
+        add_to_pack(dataSend[dest], data->presDeriv_);
+        add_to_pack(dataSend[dest], data->dispnp_);
+        add_to_pack(dataSend[dest], data->initialpoint_);
+        add_to_pack(dataSend[dest], data->initial_eid_);
+        add_to_pack(dataSend[dest], data->initial_ele_owner_);
+        add_to_pack(dataSend[dest], data->startpoint_);
+        add_to_pack(dataSend[dest], data->searchedProcs_);
+        add_to_pack(dataSend[dest], data->counter_);
+        add_to_pack(dataSend[dest], data->type_);
       }
     }
 
     clear_state(TimeIntData::nextSL_);
 
     std::vector<char> dataRecv;
-    send_data(dataSend, dest, source, dataRecv);
-
+    send_data_to_all(dataSend, dataRecv);
 
     // unpack received data
     Core::Communication::UnpackBuffer buffer(dataRecv);
@@ -2013,9 +2000,6 @@ void XFEM::XfluidSemiLagrange::export_iter_data(bool& procDone)
       timeIntData_->push_back(TimeIntData(node, nds_np, vel, velDeriv, presDeriv, dispnp,
           initialpoint, initial_eid, initial_ele_owner, startpoint, searchedProcs, iter, newtype));
     }  // end loop over number of points to get
-
-    // processors wait for each other
-    Core::Communication::barrier(discret_->get_comm());
   }  // end if procfinished == false
 }  // end export_iter_data
 
@@ -0,0 +1,113 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_xfem_utils.hpp"
+
+#include "4C_fem_general_utils_fem_shapefunctions.hpp"
+#include "4C_fem_general_utils_local_connectivity_matrices.hpp"
+#include "4C_linalg_fixedsizematrix.hpp"
+#include "4C_linalg_serialdensematrix.hpp"
+
+#include <array>
+
+namespace
+{
+  using namespace FourC;
+
+  // curved hex27 element with x = X + 0.2 (Y - Y^2), which bulges beyond its nodes at Y = 0.5
+  Core::LinAlg::SerialDenseMatrix curved_hex27_positions()
+  {
+    Core::LinAlg::SerialDenseMatrix xyz(3, 27);
+    for (int inode = 0; inode < 27; ++inode)
+    {
+      const double* X = Core::FE::eleNodeNumbering_hex27_nodes_reference[inode];
+      xyz(0, inode) = X[0] + 0.2 * (X[1] - X[1] * X[1]);
+      xyz(1, inode) = X[1];
+      xyz(2, inode) = X[2];
+    }
+    return xyz;
+  }
+
+  Core::LinAlg::Matrix<3, 1> hex27_position(
+      const Core::LinAlg::SerialDenseMatrix& xyz, const Core::LinAlg::Matrix<3, 1>& xi)
+  {
+    Core::LinAlg::Matrix<27, 1> funct;
+    Core::FE::shape_function<Core::FE::CellType::hex27>(xi, funct);
+
+    Core::LinAlg::Matrix<3, 1> x(true);
+    for (int inode = 0; inode < 27; ++inode)
+      for (int idim = 0; idim < 3; ++idim) x(idim) += funct(inode) * xyz(idim, inode);
+    return x;
+  }
+
+  TEST(XFEMUtilsTest, EnlargedBoundingBoxHex8)
+  {
+    Core::LinAlg::SerialDenseMatrix xyz(3, 8);
+    for (int inode = 0; inode < 8; ++inode)
+    {
+      xyz(0, inode) = 2.0 * ((inode + 1) / 2 % 2);
+      xyz(1, inode) = (inode / 2) % 2;
+      xyz(2, inode) = inode / 4;
+    }
+
+    // the enlargement scales with the maximal extent of the element in all directions
+    std::array<double, 6> box;
+    XFEM::Utils::enlarged_bounding_box(xyz, 8, 0.1, box.data());
+
+    const std::array<double, 6> expected = {-0.2, 2.2, -0.2, 1.2, -0.2, 1.2};
+    for (int i = 0; i < 6; ++i) EXPECT_NEAR(box[i], expected[i], 1e-14);
+  }
+
+  TEST(XFEMUtilsTest, EnlargedBoundingBoxContainsCurvedHex27)
+  {
+    const Core::LinAlg::SerialDenseMatrix xyz = curved_hex27_positions();
+
+    // the point of the element at xi = (1, 0.5, 0) lies outside of the box of the nodes
+    Core::LinAlg::Matrix<3, 1> xi;
+    xi(0) = 1.0;
+    xi(1) = 0.5;
+    xi(2) = 0.0;
+    const Core::LinAlg::Matrix<3, 1> bulge = hex27_position(xyz, xi);
+    EXPECT_NEAR(bulge(0), 1.05, 1e-14);
+
+    std::array<double, 6> nodebox;
+    XFEM::Utils::enlarged_bounding_box(xyz, 27, 0.0, nodebox.data());
+    EXPECT_NEAR(nodebox[1], 1.0, 1e-14);
+    EXPECT_FALSE(XFEM::Utils::in_bounding_box(nodebox.data(), bulge));
+
+    // the enlargement by 0.1 times the element size covers the whole element
+    std::array<double, 6> box;
+    XFEM::Utils::enlarged_bounding_box(xyz, 27, 0.1, box.data());
+    for (double r = -1.0; r <= 1.0; r += 0.25)
+    {
+      for (double s = -1.0; s <= 1.0; s += 0.125)
+      {
+        for (double t = -1.0; t <= 1.0; t += 0.5)
+        {
+          xi(0) = r;
+          xi(1) = s;
+          xi(2) = t;
+          EXPECT_TRUE(XFEM::Utils::in_bounding_box(box.data(), hex27_position(xyz, xi)));
+        }
+      }
+    }
+
+    // the maximal extent is 2.4 in x-direction, points beyond the enlargement are rejected
+    Core::LinAlg::Matrix<3, 1> x;
+    x(0) = 1.0 + 0.24 - 1e-3;
+    x(1) = 0.0;
+    x(2) = 0.0;
+    EXPECT_TRUE(XFEM::Utils::in_bounding_box(box.data(), x));
+    x(0) = 1.0 + 0.24 + 1e-3;
+    EXPECT_FALSE(XFEM::Utils::in_bounding_box(box.data(), x));
+    x(0) = 0.0;
+    x(2) = -1.0 - 0.24 - 1e-3;
+    EXPECT_FALSE(XFEM::Utils::in_bounding_box(box.data(), x));
+  }
+}  // namespace
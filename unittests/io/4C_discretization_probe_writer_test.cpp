@@ -0,0 +1,149 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_io_discretization_probe_writer.hpp"
+
+#include "4C_fem_discretization.hpp"
+#include "4C_fem_general_node.hpp"
+#include "4C_fem_general_shape_function_type.hpp"
+#include "4C_global_data.hpp"
+#include "4C_io_control.hpp"
+#include "4C_io_gridgenerator.hpp"
+#include "4C_io_pstream.hpp"
+#include "4C_mat_material_factory.hpp"
+#include "4C_mat_par_bundle.hpp"
+#include "4C_material_parameter_base.hpp"
+#include "4C_utils_singleton_owner.hpp"
+
+#include <cmath>
+
+namespace
+{
+  using namespace FourC;
+
+  void create_material_in_global_problem()
+  {
+    Core::IO::InputParameterContainer mat_stvenant;
+    mat_stvenant.add("YOUNG", 1.0);
+    mat_stvenant.add("NUE", 0.1);
+    mat_stvenant.add("DENS", 2.0);
+
+    Global::Problem::instance()->materials()->insert(
+        1, Mat::make_parameter(1, Core::Materials::MaterialType::m_stvenant, mat_stvenant));
+  }
+
+  //! nodal fields, which are reproduced exactly by trilinear shape functions
+  std::array<double, 3> nodal_field(const std::vector<double>& x)
+  {
+    return {1.0 + 2.0 * x[0] - x[1] + 3.0 * x[2], x[0] * x[1] * x[2], 4.0};
+  }
+
+  class DiscretizationProbeWriterTest : public ::testing::Test
+  {
+   protected:
+    void SetUp() override
+    {
+      create_material_in_global_problem();
+      comm_ = MPI_COMM_WORLD;
+      Core::IO::cout.setup(false, false, false, Core::IO::standard, comm_, 0, 0, "dummyFilePrefix");
+
+      output_control_ = std::make_shared<Core::IO::OutputControl>(comm_, "none",
+          Core::FE::ShapeFunctionType::polynomial, "dummy_input",
+          testing::TempDir() + "probe_writer_test", 3, 0, 1000, false);
+
+      // 2 x 2 x 4 hex8 elements on the unit cube
+      Core::IO::GridGenerator::RectangularCuboidInputs inputData{};
+      inputData.bottom_corner_point_ = std::array<double, 3>{0.0, 0.0, 0.0};
+      inputData.top_corner_point_ = std::array<double, 3>{1.0, 1.0, 1.0};
+      inputData.interval_ = std::array<int, 3>{2, 2, 4};
+      inputData.node_gid_of_first_new_node_ = 0;
+      inputData.elementtype_ = "SOLID";
+      inputData.distype_ = "HEX8";
+      inputData.elearguments_ = "MAT 1 KINEM nonlinear";
+
+      discretization_ = std::make_shared<Core::FE::Discretization>("probed", comm_, 3);
+      Core::IO::GridGenerator::create_rectangular_cuboid_discretization(
+          *discretization_, inputData, true);
+      discretization_->fill_complete(true, false, false);
+
+      result_ = std::make_shared<Core::LinAlg::Vector<double>>(*discretization_->dof_row_map());
+      for (int inode = 0; inode < discretization_->num_my_row_nodes(); ++inode)
+      {
+        const Core::Nodes::Node* node = discretization_->l_row_node(inode);
+        const std::array<double, 3> values = nodal_field(node->x());
+        const std::vector<int> dofs = discretization_->dof(0, node);
+        for (int d = 0; d < 3; ++d) result_->ReplaceGlobalValue(dofs[d], 0, values[d]);
+      }
+    }
+
+    void TearDown() override { Core::IO::cout.close(); }
+
+    MPI_Comm comm_;
+    std::shared_ptr<Core::IO::OutputControl> output_control_;
+    std::shared_ptr<Core::FE::Discretization> discretization_;
+    std::shared_ptr<Core::LinAlg::Vector<double>> result_;
+
+    Core::Utils::SingletonOwnerRegistry::ScopeGuard guard;
+  };
+
+  TEST_F(DiscretizationProbeWriterTest, InterpolateAtProbes)
+  {
+    // an interior point, a node, a point on an element face, a corner of the domain and a point
+    // outside of the domain
+    const std::vector<std::array<double, 3>> probes = {{0.3, 0.6, 0.1}, {0.5, 0.5, 0.5},
+        {0.1, 0.8, 0.75}, {1.0, 1.0, 1.0}, {2.0, 0.5, 0.5}};
+
+    Core::IO::DiscretizationProbeWriter probe_writer(
+        discretization_, probes, *output_control_, "probes");
+    EXPECT_EQ(probe_writer.num_located_probes(), 4);
+
+    probe_writer.register_field("all", 0, 3);
+    probe_writer.register_field("product", 1, 1);
+    probe_writer.append_field("all", *result_);
+    probe_writer.append_field("product", *result_);
+    probe_writer.write(0.0, 0);
+
+    const std::vector<double>& all = probe_writer.field_values("all");
+    const std::vector<double>& product = probe_writer.field_values("product");
+    ASSERT_EQ(all.size(), 3 * probes.size());
+    ASSERT_EQ(product.size(), probes.size());
+
+    for (std::size_t iprobe = 0; iprobe < 4; ++iprobe)
+    {
+      const std::vector<double> x(probes[iprobe].begin(), probes[iprobe].end());
+      const std::array<double, 3> expected = nodal_field(x);
+      for (int d = 0; d < 3; ++d) EXPECT_NEAR(all[3 * iprobe + d], expected[d], 1.0e-12);
+      EXPECT_NEAR(product[iprobe], expected[1], 1.0e-12);
+    }
+
+    for (int d = 0; d < 3; ++d) EXPECT_TRUE(std::isnan(all[3 * 4 + d]));
+    EXPECT_TRUE(std::isnan(product[4]));
+  }
+
+  TEST_F(DiscretizationProbeWriterTest, RejectUnregisteredField)
+  {
+    const std::vector<std::array<double, 3>> probes = {{0.3, 0.6, 0.1}};
+    Core::IO::DiscretizationProbeWriter probe_writer(
+        discretization_, probes, *output_control_, "probes");
+
+    EXPECT_FALSE(probe_writer.has_field("all"));
+    EXPECT_THROW(probe_writer.append_field("all", *result_), Core::Exception);
+    EXPECT_THROW(probe_writer.register_field("all", 2, 2), Core::Exception);
+  }
+
+  TEST_F(DiscretizationProbeWriterTest, RejectTwoDimensionalDiscretization)
+  {
+    auto discretization_2d = std::make_shared<Core::FE::Discretization>("planar", comm_, 2);
+    const std::vector<std::array<double, 3>> probes = {{0.3, 0.6, 0.0}};
+
+    EXPECT_THROW(
+        Core::IO::DiscretizationProbeWriter(discretization_2d, probes, *output_control_, "probes"),
+        Core::Exception);
+  }
+}  // namespace
@@ -0,0 +1,142 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_io_discretization_probe_writer.hpp"
+
+#include "4C_fem_discretization.hpp"
+#include "4C_fem_general_node.hpp"
+#include "4C_fem_general_shape_function_type.hpp"
+#include "4C_global_data.hpp"
+#include "4C_io_control.hpp"
+#include "4C_io_gridgenerator.hpp"
+#include "4C_io_pstream.hpp"
+#include "4C_mat_material_factory.hpp"
+#include "4C_mat_par_bundle.hpp"
+#include "4C_material_parameter_base.hpp"
+#include "4C_unittest_utils_assertions_test.hpp"
+#include "4C_utils_singleton_owner.hpp"
+
+namespace
+{
+  using namespace FourC;
+
+  void create_material_in_global_problem()
+  {
+    Core::IO::InputParameterContainer mat_stvenant;
+    mat_stvenant.add("YOUNG", 1.0);
+    mat_stvenant.add("NUE", 0.1);
+    mat_stvenant.add("DENS", 2.0);
+
+    Global::Problem::instance()->materials()->insert(
+        1, Mat::make_parameter(1, Core::Materials::MaterialType::m_stvenant, mat_stvenant));
+  }
+
+  //! nodal fields, which are reproduced exactly by trilinear shape functions
+  std::array<double, 3> nodal_field(const std::vector<double>& x)
+  {
+    return {1.0 + 2.0 * x[0] - x[1] + 3.0 * x[2], x[0] * x[1] * x[2], 4.0};
+  }
+
+  class DiscretizationProbeWriterTest : public ::testing::Test
+  {
+   protected:
+    void SetUp() override
+    {
+      create_material_in_global_problem();
+      comm_ = MPI_COMM_WORLD;
+      Core::IO::cout.setup(false, false, false, Core::IO::standard, comm_, 0, 0, "dummyFilePrefix");
+
+      output_control_ = std::make_shared<Core::IO::OutputControl>(comm_, "none",
+          Core::FE::ShapeFunctionType::polynomial, "dummy_input",
+          testing::TempDir() + "probe_writer_test_np3", 3, 0, 1000, false);
+
+      // 2 x 2 x 4 hex8 elements on the unit cube
+      Core::IO::GridGenerator::RectangularCuboidInputs inputData{};
+      inputData.bottom_corner_point_ = std::array<double, 3>{0.0, 0.0, 0.0};
+      inputData.top_corner_point_ = std::array<double, 3>{1.0, 1.0, 1.0};
+      inputData.interval_ = std::array<int, 3>{2, 2, 4};
+      inputData.node_gid_of_first_new_node_ = 0;
+      inputData.elementtype_ = "SOLID";
+      inputData.distype_ = "HEX8";
+      inputData.elearguments_ = "MAT 1 KINEM nonlinear";
+
+      discretization_ = std::make_shared<Core::FE::Discretization>("probed", comm_, 3);
+      Core::IO::GridGenerator::create_rectangular_cuboid_discretization(
+          *discretization_, inputData, true);
+      discretization_->fill_complete(true, false, false);
+
+      result_ = std::make_shared<Core::LinAlg::Vector<double>>(*discretization_->dof_row_map());
+      for (int inode = 0; inode < discretization_->num_my_row_nodes(); ++inode)
+      {
+        const Core::Nodes::Node* node = discretization_->l_row_node(inode);
+        const std::array<double, 3> values = nodal_field(node->x());
+        const std::vector<int> dofs = discretization_->dof(0, node);
+        for (int d = 0; d < 3; ++d) result_->ReplaceGlobalValue(dofs[d], 0, values[d]);
+      }
+    }
+
+    void TearDown() override { Core::IO::cout.close(); }
+
+    MPI_Comm comm_;
+    std::shared_ptr<Core::IO::OutputControl> output_control_;
+    std::shared_ptr<Core::FE::Discretization> discretization_;
+    std::shared_ptr<Core::LinAlg::Vector<double>> result_;
+
+    Core::Utils::SingletonOwnerRegistry::ScopeGuard guard;
+  };
+
+  TEST_F(DiscretizationProbeWriterTest, ProbesOnProcessorBoundaries)
+  {
+    // points on the faces between the element layers in z-direction, which are distributed over
+    // the processors, alternating with points inside the layers
+    std::vector<std::array<double, 3>> probes;
+    for (int i = 0; i <= 8; ++i) probes.push_back({0.5, 0.25 + 0.5 * (i % 2), 0.125 * i});
+
+    Core::IO::DiscretizationProbeWriter probe_writer(
+        discretization_, probes, *output_control_, "probes");
+    EXPECT_EQ(probe_writer.num_located_probes(), 9);
+
+    probe_writer.register_field("all", 0, 3);
+    probe_writer.append_field("all", *result_);
+    probe_writer.write(0.0, 0);
+
+    // every probe is interpolated by exactly one processor and the values are summed on all
+    const std::vector<double>& all = probe_writer.field_values("all");
+    ASSERT_EQ(all.size(), 3 * probes.size());
+
+    for (std::size_t iprobe = 0; iprobe < probes.size(); ++iprobe)
+    {
+      const std::vector<double> x(probes[iprobe].begin(), probes[iprobe].end());
+      const std::array<double, 3> expected = nodal_field(x);
+      for (int d = 0; d < 3; ++d) EXPECT_NEAR(all[3 * iprobe + d], expected[d], 1.0e-12);
+    }
+  }
+
+  TEST_F(DiscretizationProbeWriterTest, MissingDofsThrowOnAllProcessors)
+  {
+    // a single probe in the lowest element layer, which is located on one processor only
+    const std::vector<std::array<double, 3>> probes = {{0.3, 0.6, 0.05}};
+    Core::IO::DiscretizationProbeWriter probe_writer(
+        discretization_, probes, *output_control_, "probes");
+    EXPECT_EQ(probe_writer.num_located_probes(), 1);
+
+    // the nodes only have 3 dofs, all processors throw instead of waiting for the others
+    FOUR_C_EXPECT_THROW_WITH_MESSAGE(probe_writer.register_field("too_many", 1, 3),
+        Core::Exception, "does not have the dofs 1 to 3");
+    EXPECT_FALSE(probe_writer.has_field("too_many"));
+
+    // the probe writer is still usable on all processors
+    probe_writer.register_field("all", 0, 3);
+    probe_writer.append_field("all", *result_);
+    const std::vector<double> x(probes[0].begin(), probes[0].end());
+    const std::array<double, 3> expected = nodal_field(x);
+    for (int d = 0; d < 3; ++d)
+      EXPECT_NEAR(probe_writer.field_values("all")[d], expected[d], 1.0e-12);
+  }
+}  // namespace
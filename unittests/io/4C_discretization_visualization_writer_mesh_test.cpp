@@ -0,0 +1,180 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_io_discretization_visualization_writer_mesh.hpp"
+
+#include "4C_fem_discretization.hpp"
+#include "4C_fem_general_node.hpp"
+#include "4C_global_data.hpp"
+#include "4C_io_gridgenerator.hpp"
+#include "4C_io_pstream.hpp"
+#include "4C_mat_material_factory.hpp"
+#include "4C_mat_par_bundle.hpp"
+#include "4C_material_parameter_base.hpp"
+#include "4C_utils_singleton_owner.hpp"
+
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  void create_material_in_global_problem()
+  {
+    Core::IO::InputParameterContainer mat_stvenant;
+    mat_stvenant.add("YOUNG", 1.0);
+    mat_stvenant.add("NUE", 0.1);
+    mat_stvenant.add("DENS", 2.0);
+
+    Global::Problem::instance()->materials()->insert(
+        1, Mat::make_parameter(1, Core::Materials::MaterialType::m_stvenant, mat_stvenant));
+  }
+
+  class DiscretizationVisualizationWriterMeshTest : public ::testing::Test
+  {
+   protected:
+    void SetUp() override
+    {
+      create_material_in_global_problem();
+      comm_ = MPI_COMM_WORLD;
+      Core::IO::cout.setup(false, false, false, Core::IO::standard, comm_, 0, 0, "dummyFilePrefix");
+
+      // 2 x 2 x 2 hex8 elements with 27 nodes on the unit cube
+      Core::IO::GridGenerator::RectangularCuboidInputs inputData{};
+      inputData.bottom_corner_point_ = std::array<double, 3>{0.0, 0.0, 0.0};
+      inputData.top_corner_point_ = std::array<double, 3>{1.0, 1.0, 1.0};
+      inputData.interval_ = std::array<int, 3>{2, 2, 2};
+      inputData.node_gid_of_first_new_node_ = 0;
+      inputData.elementtype_ = "SOLID";
+      inputData.distype_ = "HEX8";
+      inputData.elearguments_ = "MAT 1 KINEM nonlinear";
+
+      discretization_ = std::make_shared<Core::FE::Discretization>("visualized", comm_, 3);
+      Core::IO::GridGenerator::create_rectangular_cuboid_discretization(
+          *discretization_, inputData, true);
+      discretization_->fill_complete(true, false, false);
+    }
+
+    void TearDown() override { Core::IO::cout.close(); }
+
+    Core::IO::VisualizationParameters visualization_parameters(bool shared_nodes) const
+    {
+      Core::IO::VisualizationParameters parameters{};
+      parameters.data_format_ = Core::IO::OutputDataFormat::ascii;
+      parameters.directory_name_ = testing::TempDir();
+      parameters.file_name_prefix_ = "visualization_writer_mesh_test";
+      parameters.digits_for_iteration_ = 0;
+      parameters.digits_for_time_step_ = 5;
+      parameters.writer_ = Core::IO::OutputWriter::vtu_per_rank;
+      parameters.shared_nodes_ = shared_nodes;
+      return parameters;
+    }
+
+    //! append the dof gids, the nodal coordinates and the node gids as results
+    void append_results(Core::IO::DiscretizationVisualizationWriterMesh& writer) const
+    {
+      const Epetra_Map& dofcolmap = *discretization_->dof_col_map();
+      Core::LinAlg::MultiVector<double> dofgids(dofcolmap, 1);
+      for (int lid = 0; lid < dofcolmap.NumMyElements(); ++lid)
+        dofgids(0)[lid] = dofcolmap.GID(lid);
+
+      // the gather plans of both dof-based results are reused in the second call
+      for (int call = 0; call < 2; ++call)
+      {
+        writer.append_result_data_vector_with_context(
+            dofgids, Core::IO::OutputEntity::dof, {"dofs", "dofs", "dofs"});
+        writer.append_result_data_vector_with_context(
+            dofgids, Core::IO::OutputEntity::dof, {std::nullopt, std::nullopt, "zdof"});
+      }
+
+      Core::LinAlg::MultiVector<double> coordinates(*discretization_->node_col_map(), 3);
+      for (int lid = 0; lid < discretization_->num_my_col_nodes(); ++lid)
+      {
+        for (int idim = 0; idim < 3; ++idim)
+          coordinates(idim)[lid] = discretization_->l_col_node(lid)->x()[idim];
+      }
+      writer.append_result_data_vector_with_context(
+          coordinates, Core::IO::OutputEntity::node, {"x", "x", "x"});
+
+      writer.append_node_gid("node_gid");
+    }
+
+    MPI_Comm comm_;
+    std::shared_ptr<Core::FE::Discretization> discretization_;
+
+    Core::Utils::SingletonOwnerRegistry::ScopeGuard guard;
+  };
+
+  TEST_F(DiscretizationVisualizationWriterMeshTest, SharedNodesMatchPerElementOutput)
+  {
+    Core::IO::DiscretizationVisualizationWriterMesh element_writer(
+        discretization_, visualization_parameters(false));
+    Core::IO::DiscretizationVisualizationWriterMesh shared_writer(
+        discretization_, visualization_parameters(true));
+    append_results(element_writer);
+    append_results(shared_writer);
+
+    const Core::IO::VisualizationData& element_data = element_writer.get_visualization_data();
+    const Core::IO::VisualizationData& shared_data = shared_writer.get_visualization_data();
+
+    // each node of the row elements is written once
+    std::set<int> element_nodes;
+    for (const Core::Elements::Element* ele : discretization_->my_row_element_range())
+      element_nodes.insert(ele->node_ids(), ele->node_ids() + ele->num_node());
+
+    const std::size_t num_row_elements = discretization_->num_my_row_elements();
+    EXPECT_EQ(element_data.get_point_coordinates_number_of_points(), 8 * num_row_elements);
+    EXPECT_EQ(shared_data.get_point_coordinates_number_of_points(), element_nodes.size());
+    EXPECT_EQ(shared_data.get_cell_types(), element_data.get_cell_types());
+    ASSERT_EQ(shared_data.get_cell_offsets().size(), num_row_elements);
+    ASSERT_EQ(shared_data.get_cell_connectivity().size(), 8 * num_row_elements);
+
+    const std::vector<int>& element_gids = element_data.get_point_data<int>("node_gid");
+    const std::vector<int>& shared_gids = shared_data.get_point_data<int>("node_gid");
+    EXPECT_EQ(std::set<int>(shared_gids.begin(), shared_gids.end()), element_nodes);
+
+    // the point of each cell corner carries the same coordinates and results in both outputs
+    const std::vector<double>& element_x = element_data.get_point_coordinates();
+    const std::vector<double>& shared_x = shared_data.get_point_coordinates();
+    const std::vector<double>& element_dofs = element_data.get_point_data<double>("dofs");
+    const std::vector<double>& shared_dofs = shared_data.get_point_data<double>("dofs");
+    const std::vector<double>& element_zdof = element_data.get_point_data<double>("zdof");
+    const std::vector<double>& shared_zdof = shared_data.get_point_data<double>("zdof");
+    const std::vector<double>& element_nodex = element_data.get_point_data<double>("x");
+    const std::vector<double>& shared_nodex = shared_data.get_point_data<double>("x");
+    ASSERT_EQ(shared_dofs.size(), 3 * shared_gids.size());
+    ASSERT_EQ(shared_zdof.size(), shared_gids.size());
+
+    const auto& connectivity = shared_data.get_cell_connectivity();
+    for (std::size_t ipoint = 0; ipoint < connectivity.size(); ++ipoint)
+    {
+      const int shared_point = connectivity[ipoint];
+      EXPECT_EQ(shared_gids[shared_point], element_gids[ipoint]);
+      EXPECT_EQ(shared_zdof[shared_point], element_zdof[ipoint]);
+      for (int idim = 0; idim < 3; ++idim)
+      {
+        EXPECT_EQ(shared_x[3 * shared_point + idim], element_x[3 * ipoint + idim]);
+        EXPECT_EQ(shared_dofs[3 * shared_point + idim], element_dofs[3 * ipoint + idim]);
+        EXPECT_EQ(shared_nodex[3 * shared_point + idim], element_nodex[3 * ipoint + idim]);
+      }
+    }
+
+    // the dof-based results are gathered from the dofs of the nodes
+    for (std::size_t ipoint = 0; ipoint < shared_gids.size(); ++ipoint)
+    {
+      const std::vector<int> dofs =
+          discretization_->dof(0, discretization_->g_node(shared_gids[ipoint]));
+      for (int idim = 0; idim < 3; ++idim) EXPECT_EQ(shared_dofs[3 * ipoint + idim], dofs[idim]);
+      EXPECT_EQ(shared_zdof[ipoint], dofs[2]);
+    }
+  }
+}  // namespace
@@ -0,0 +1,67 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_mat_myocard_fitzhugh_nagumo.hpp"
+#include "4C_mat_myocard_minimal.hpp"
+
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  constexpr double TOL = 1.0e-12;
+
+  template <typename Model>
+  void expect_batch_matches_pointwise(Model& batched, Model& pointwise,
+      const std::vector<double>& phi, const double dt, const int num_steps)
+  {
+    std::vector<double> reacoeff;
+    for (int step = 0; step < num_steps; ++step)
+    {
+      batched.rea_coeff_batch(phi, dt, reacoeff);
+      ASSERT_EQ(reacoeff.size(), phi.size());
+
+      for (int gp = 0; gp < static_cast<int>(phi.size()); ++gp)
+        EXPECT_NEAR(reacoeff[gp], pointwise.rea_coeff(phi[gp], dt, gp), TOL);
+
+      batched.update(0.0, dt);
+      pointwise.update(0.0, dt);
+    }
+
+    for (int gp = 0; gp < static_cast<int>(phi.size()); ++gp)
+    {
+      for (int k = 0; k < batched.get_number_of_internal_state_variables(); ++k)
+        EXPECT_NEAR(batched.get_internal_state(k, gp), pointwise.get_internal_state(k, gp), TOL);
+      for (int k = 0; k < batched.get_number_of_ionic_currents(); ++k)
+        EXPECT_NEAR(batched.get_ionic_currents(k, gp), pointwise.get_ionic_currents(k, gp), TOL);
+    }
+  }
+
+  TEST(MyocardBatchTest, FitzhughNagumoBatchMatchesPointwiseEvaluation)
+  {
+    const std::vector<double> phi = {0.0, 0.05, 0.3, 0.8, 1.1};
+
+    MyocardFitzhughNagumo batched(1.0e-4, "M", phi.size());
+    MyocardFitzhughNagumo pointwise(1.0e-4, "M", phi.size());
+
+    expect_batch_matches_pointwise(batched, pointwise, phi, 0.1, 3);
+  }
+
+  TEST(MyocardBatchTest, MinimalBatchMatchesPointwiseEvaluation)
+  {
+    // potentials below and above all thresholds of the model
+    const std::vector<double> phi = {0.0, 0.01, 0.2, 0.5, 1.2, 1.5};
+
+    MyocardMinimal batched(1.0e-4, "EPI", phi.size());
+    MyocardMinimal pointwise(1.0e-4, "EPI", phi.size());
+
+    expect_batch_matches_pointwise(batched, pointwise, phi, 0.05, 3);
+  }
+}  // namespace
@@ -0,0 +1,107 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_mat_myocard_lookup_table.hpp"
+#include "4C_mat_myocard_tentusscher.hpp"
+#include "4C_utils_exceptions.hpp"
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  void rate_functions(const double v, double* values)
+  {
+    values[0] = 1.0 / (1.0 + std::exp((v + 20.0) / 7.0));
+    values[1] = 1125.0 * std::exp(-(v + 27.0) * (v + 27.0) / 240.0) + 80.0;
+  }
+
+  TEST(MyocardLookupTableTest, LinearInterpolationIsExactAtSamples)
+  {
+    MyocardLookupTable table(rate_functions, 2, -100.0, 50.0, {.resolution = 0.5, .order = 1});
+
+    EXPECT_EQ(table.num_functions(), 2);
+    EXPECT_EQ(table.num_samples(), 301);
+
+    double values[2], exact[2];
+    table.evaluate(-20.0, values);
+    rate_functions(-20.0, exact);
+    EXPECT_NEAR(values[0], exact[0], 1.0e-14);
+    EXPECT_NEAR(values[1], exact[1], 1.0e-10);
+  }
+
+  TEST(MyocardLookupTableTest, CubicInterpolationIsMoreAccurateThanLinear)
+  {
+    MyocardLookupTable linear(rate_functions, 2, -100.0, 50.0, {.resolution = 0.5, .order = 1});
+    MyocardLookupTable cubic(rate_functions, 2, -100.0, 50.0, {.resolution = 0.5, .order = 3});
+
+    double error_linear = 0.0, error_cubic = 0.0;
+    for (double v = -99.9; v < 50.0; v += 0.37)
+    {
+      double values_linear[2], values_cubic[2], exact[2];
+      linear.evaluate(v, values_linear);
+      cubic.evaluate(v, values_cubic);
+      rate_functions(v, exact);
+
+      error_linear = std::max(error_linear, std::abs(values_linear[0] - exact[0]));
+      error_cubic = std::max(error_cubic, std::abs(values_cubic[0] - exact[0]));
+    }
+
+    EXPECT_LT(error_linear, 1.0e-3);
+    EXPECT_LT(error_cubic, 1.0e-5);
+    EXPECT_LT(error_cubic, error_linear);
+  }
+
+  TEST(MyocardLookupTableTest, ExactEvaluationOutsideOfRange)
+  {
+    MyocardLookupTable table(rate_functions, 2, -100.0, 50.0, {.resolution = 10.0, .order = 1});
+
+    double values[2], exact[2];
+    table.evaluate(120.0, values);
+    rate_functions(120.0, exact);
+    EXPECT_DOUBLE_EQ(values[0], exact[0]);
+    EXPECT_DOUBLE_EQ(values[1], exact[1]);
+  }
+
+  TEST(MyocardLookupTableTest, CheckModeThrowsForCoarseTable)
+  {
+    MyocardLookupTable table(
+        rate_functions, 2, -100.0, 50.0, {.resolution = 10.0, .order = 1, .check_tolerance = 1e-6});
+
+    double values[2];
+    EXPECT_THROW(table.evaluate(-23.0, values), Core::Exception);
+  }
+
+  TEST(MyocardLookupTableTest, TabulatedTenTusscherModelMatchesExactModel)
+  {
+    const int num_gp = 3;
+    const double dt = 0.01;
+    const std::vector<double> phi = {-85.0, -40.0, 10.0};
+
+    MyocardTenTusscher exact(1.0e-4, "M", num_gp);
+    MyocardTenTusscher tabulated(1.0e-4, "M", num_gp, false,
+        MyocardTenTusscher::create_lookup_table({.resolution = 0.01, .order = 3}));
+
+    std::vector<double> reacoeff_exact, reacoeff_tabulated;
+    for (int step = 0; step < 10; ++step)
+    {
+      exact.rea_coeff_batch(phi, dt, reacoeff_exact);
+      tabulated.rea_coeff_batch(phi, dt, reacoeff_tabulated);
+
+      for (int gp = 0; gp < num_gp; ++gp)
+        EXPECT_NEAR(reacoeff_tabulated[gp], reacoeff_exact[gp],
+            1.0e-8 * std::max(1.0, std::abs(reacoeff_exact[gp])));
+
+      exact.update(0.0, dt);
+      tabulated.update(0.0, dt);
+    }
+  }
+}  // namespace
@@ -0,0 +1,73 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_mat_myocard_tentusscher.hpp"
+#include "4C_mat_myocard_tools.hpp"
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  TEST(MyocardTenTusscherTest, BatchedEvaluationMatchesPointwiseEvaluation)
+  {
+    const int num_gp = 5;
+    const double dt = 0.01;
+    const std::vector<double> phi = {-85.0, -60.0, -40.0, 0.0, 20.0};
+
+    MyocardTenTusscher batched(1.0e-4, "M", num_gp);
+    MyocardTenTusscher pointwise(1.0e-4, "M", num_gp);
+
+    std::vector<double> reacoeff;
+    for (int step = 0; step < 3; ++step)
+    {
+      batched.rea_coeff_batch(phi, dt, reacoeff);
+      ASSERT_EQ(reacoeff.size(), phi.size());
+
+      for (int gp = 0; gp < num_gp; ++gp)
+        EXPECT_DOUBLE_EQ(reacoeff[gp], pointwise.rea_coeff(phi[gp], dt, gp));
+
+      batched.update(0.0, dt);
+      pointwise.update(0.0, dt);
+    }
+
+    for (int gp = 0; gp < num_gp; ++gp)
+      for (int k = 0; k < batched.get_number_of_internal_state_variables(); ++k)
+        EXPECT_DOUBLE_EQ(batched.get_internal_state(k, gp), pointwise.get_internal_state(k, gp));
+  }
+
+  TEST(MyocardTenTusscherTest, ResizeStartsNewGaussPointsFromInitialState)
+  {
+    MyocardTenTusscher model(1.0e-4, "EPI", 1);
+    model.set_internal_state(3, 0.5);
+
+    model.resize_internal_state_variables(3);
+
+    EXPECT_EQ(model.get_number_of_gp(), 3);
+    EXPECT_DOUBLE_EQ(model.get_internal_state(3, 0), 0.5);
+    EXPECT_DOUBLE_EQ(model.get_internal_state(3, 2), 0.000126);
+  }
+
+  TEST(MyocardToolsTest, RushLarsenIsExactForFrozenCoefficients)
+  {
+    MyocardTools tools;
+    const double y_0 = 0.2;
+    const double y_inf = 0.9;
+    const double y_tau = 3.0;
+    const double dt = 1.5;
+
+    EXPECT_NEAR(tools.gating_var_calc_rush_larsen(dt, y_0, y_inf, y_tau),
+        y_inf + (y_0 - y_inf) * std::exp(-dt / y_tau), 1.0e-14);
+
+    // the scheme stays bounded for time steps much larger than the time constant
+    EXPECT_NEAR(tools.gating_var_calc_rush_larsen(1.0e3, y_0, y_inf, y_tau), y_inf, 1.0e-14);
+  }
+}  // namespace
@@ -17,6 +17,7 @@
 
 #include <Sacado.hpp>
 
+#include <cmath>
 #include <memory>
 
 namespace
@@ -342,6 +343,71 @@ namespace
     EXPECT_EQ(cm_fiber_adaptive.history_[0].timesteps.size(), cm_fiber_adaptive.window_size);
   }
 
+  TEST_F(FullConstrainedMixtureFiberTest, RecursiveHistoryComparison)
+  {
+    // compare the results of the fully integrated constrained mixture fiber with the recursively
+    // integrated fiber
+    Mixture::FullConstrainedMixtureFiber cm_fiber = generate_fiber<double>();
+    Mixture::FullConstrainedMixtureFiber cm_fiber_recursive =
+        generate_fiber<double>(12.0, 0.1, 1.1, true, Mixture::HistoryAdaptionStrategy::recursive);
+    cm_fiber_recursive.adaptive_tolerance_ = 1e-4;
+
+    const double lambda_f = 1.05;
+    cm_fiber.reinitialize_history(lambda_f, 0.0);
+    cm_fiber_recursive.reinitialize_history(lambda_f, 0.0);
+
+    const double dt = 0.1;
+    for (unsigned timestep = 1; timestep <= 1000; ++timestep)
+    {
+      const double time = timestep * dt;
+      cm_fiber.recompute_state(lambda_f, time, dt);
+      cm_fiber_recursive.recompute_state(lambda_f, time, dt);
+
+      // compare
+      EXPECT_NEAR(cm_fiber.evaluate_current_second_pk_stress(),
+          cm_fiber_recursive.evaluate_current_second_pk_stress(), 1e-6);
+      EXPECT_NEAR(
+          cm_fiber.computed_growth_scalar_, cm_fiber_recursive.computed_growth_scalar_, 1e-6);
+
+      cm_fiber.update();
+      cm_fiber_recursive.update();
+    }
+
+    // the history of a constant fiber stretch is lumped onto a single reference stretch
+    EXPECT_EQ(cm_fiber_recursive.history_[0].timesteps.size(), 1);
+    EXPECT_EQ(cm_fiber_recursive.lumped_history_.size(), 1);
+  }
+
+  TEST_F(FullConstrainedMixtureFiberTest, RecursiveHistoryComparisonVaryingStretch)
+  {
+    Mixture::FullConstrainedMixtureFiber cm_fiber = generate_fiber<double>();
+    Mixture::FullConstrainedMixtureFiber cm_fiber_recursive =
+        generate_fiber<double>(12.0, 0.1, 1.1, true, Mixture::HistoryAdaptionStrategy::recursive);
+    cm_fiber_recursive.adaptive_tolerance_ = 1e-4;
+
+    const auto lambda_f = [](const double time) { return 1.05 + 0.02 * std::sin(time / 5.0); };
+    cm_fiber.reinitialize_history(lambda_f(0.0), 0.0);
+    cm_fiber_recursive.reinitialize_history(lambda_f(0.0), 0.0);
+
+    const double dt = 0.1;
+    for (unsigned timestep = 1; timestep <= 1000; ++timestep)
+    {
+      const double time = timestep * dt;
+      cm_fiber.recompute_state(lambda_f(time), time, dt);
+      cm_fiber_recursive.recompute_state(lambda_f(time), time, dt);
+
+      // compare
+      EXPECT_NEAR(cm_fiber.evaluate_current_second_pk_stress(),
+          cm_fiber_recursive.evaluate_current_second_pk_stress(), 1e-6);
+
+      cm_fiber.update();
+      cm_fiber_recursive.update();
+    }
+
+    EXPECT_LE(
+        cm_fiber_recursive.lumped_history_.size(), 0.25 * cm_fiber.history_[0].timesteps.size());
+  }
+
   TEST_F(FullConstrainedMixtureFiberTest, LocalNewtonHasAnalyticalDerivativeInFirstTimestep)
   {
     Mixture::FullConstrainedMixtureFiber cm_fiber = generate_fiber<FADdouble>();
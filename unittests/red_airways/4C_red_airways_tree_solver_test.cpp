@@ -0,0 +1,145 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_red_airways_tree_solver.hpp"
+
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  using namespace FourC;
+
+  /// small matrix in compressed row storage assembled from single entries
+  struct CrsMatrix
+  {
+    explicit CrsMatrix(const int num_rows) : entries(num_rows) {}
+
+    /// add a resistance-like coupling between two unknowns with a slight unsymmetry
+    void add_edge(const int i, const int j, const double conductance)
+    {
+      entries[i][i] += conductance;
+      entries[j][j] += conductance;
+      entries[i][j] -= conductance;
+      entries[j][i] -= 0.9 * conductance;
+    }
+
+    void finalize()
+    {
+      row_ptr.assign(1, 0);
+      for (const auto& row : entries)
+      {
+        for (const auto& [col, value] : row)
+        {
+          cols.push_back(col);
+          values.push_back(value);
+        }
+        row_ptr.push_back(static_cast<int>(cols.size()));
+      }
+    }
+
+    std::vector<double> apply(const std::vector<double>& x) const
+    {
+      std::vector<double> y(x.size(), 0.0);
+      for (std::size_t row = 0; row + 1 < row_ptr.size(); ++row)
+        for (int k = row_ptr[row]; k < row_ptr[row + 1]; ++k) y[row] += values[k] * x[cols[k]];
+      return y;
+    }
+
+    std::vector<std::map<int, double>> entries;
+    std::vector<int> row_ptr;
+    std::vector<int> cols;
+    std::vector<double> values;
+  };
+
+  /// binary airway tree with 'num_rows' nodes and a pressure condition at the root
+  CrsMatrix make_binary_tree(const int num_rows)
+  {
+    CrsMatrix A(num_rows);
+    for (int node = 1; node < num_rows; ++node) A.add_edge(node, (node - 1) / 2, 1.0 + 0.1 * node);
+    A.entries[0][0] += 1.0;
+    return A;
+  }
+
+  void expect_solution(const CrsMatrix& A, const Airway::TreeSolver& solver)
+  {
+    std::vector<double> x_exact(A.entries.size());
+    for (std::size_t i = 0; i < x_exact.size(); ++i) x_exact[i] = 1.0 + 0.5 * i;
+
+    std::vector<double> x = A.apply(x_exact);
+    solver.solve(x);
+
+    for (std::size_t i = 0; i < x_exact.size(); ++i) EXPECT_NEAR(x[i], x_exact[i], 1.0e-10);
+  }
+
+  TEST(TreeSolverTest, SolvesTreeWithoutSeparators)
+  {
+    CrsMatrix A = make_binary_tree(31);
+    A.finalize();
+
+    Airway::TreeSolver solver;
+    ASSERT_TRUE(solver.setup(A.row_ptr, A.cols));
+    ASSERT_TRUE(solver.factorize(A.values));
+    EXPECT_EQ(solver.num_separators(), 0);
+
+    expect_solution(A, solver);
+  }
+
+  TEST(TreeSolverTest, SolvesLoopsWithSchurComplement)
+  {
+    // inter-acinar links between the leaves close loops in the tree
+    CrsMatrix A = make_binary_tree(31);
+    for (int leaf = 15; leaf < 30; ++leaf) A.add_edge(leaf, leaf + 1, 0.3);
+    A.finalize();
+
+    Airway::TreeSolver solver;
+    ASSERT_TRUE(solver.setup(A.row_ptr, A.cols));
+    ASSERT_TRUE(solver.factorize(A.values));
+    EXPECT_GT(solver.num_separators(), 0);
+
+    expect_solution(A, solver);
+  }
+
+  TEST(TreeSolverTest, DirichletRowsKeepTheirColumns)
+  {
+    CrsMatrix A = make_binary_tree(15);
+    A.entries[7] = {{7, 1.0}};
+    A.finalize();
+
+    Airway::TreeSolver solver;
+    ASSERT_TRUE(solver.setup(A.row_ptr, A.cols));
+    ASSERT_TRUE(solver.factorize(A.values));
+
+    expect_solution(A, solver);
+  }
+
+  TEST(TreeSolverTest, RejectsTooManySeparators)
+  {
+    CrsMatrix A = make_binary_tree(31);
+    for (int leaf = 15; leaf < 30; ++leaf) A.add_edge(leaf, leaf + 1, 0.3);
+    A.finalize();
+
+    Airway::TreeSolver solver(2);
+    EXPECT_FALSE(solver.setup(A.row_ptr, A.cols));
+    EXPECT_FALSE(solver.is_setup());
+  }
+
+  TEST(TreeSolverTest, RejectsVanishingPivot)
+  {
+    CrsMatrix A(2);
+    A.entries[0] = {{0, 1.0}, {1, 1.0}};
+    A.entries[1] = {{0, 1.0}, {1, 1.0}};
+    A.finalize();
+
+    Airway::TreeSolver solver;
+    ASSERT_TRUE(solver.setup(A.row_ptr, A.cols));
+    EXPECT_FALSE(solver.factorize(A.values));
+  }
+}  // namespace